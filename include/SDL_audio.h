@@ -268,7 +268,9 @@ extern DECLSPEC const char *SDLCALL SDL_GetCurrentAudioDriver(void);
  *      to the audio buffer, and the length in bytes of the audio buffer.
  *      This function usually runs in a separate thread, and so you should
  *      protect data structures that it accesses by calling SDL_LockAudio()
- *      and SDL_UnlockAudio() in your code.
+ *      and SDL_UnlockAudio() in your code.  Alternately, you may pass a NULL
+ *      pointer here, and call SDL_QueueAudio() with some frequency, to queue
+ *      more audio samples to be played.
  *    - \c desired->userdata is passed as the first parameter to your callback
  *      function.
  *  
@@ -419,6 +421,71 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ *  \name WAVE streaming functions
+ *
+ *  These read a WAVE file a piece at a time instead of loading all of it,
+ *  so long files take the same small amount of memory as short ones.
+ *  ADPCM data is decoded one block at a time as it's read.
+ */
+/*@{*/
+typedef struct SDL_WAVStream SDL_WAVStream;
+
+/**
+ *  Open a WAVE file for streaming from the data source \c src, which is
+ *  closed with the stream if \c freesrc is non-zero.  \c spec is filled
+ *  in like SDL_LoadWAV_RW() does.  The source needs to support seeking.
+ *
+ *  \return The stream, or NULL on error.  The source is closed on error
+ *          if \c freesrc is non-zero.
+ */
+extern DECLSPEC SDL_WAVStream *SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                            int freesrc,
+                                                            SDL_AudioSpec *
+                                                            spec);
+
+/**
+ *  Opens a WAVE file for streaming.
+ */
+#define SDL_OpenWAVStream(file, spec) \
+	SDL_OpenWAVStream_RW(SDL_RWFromFile(file, "rb"), 1, spec)
+
+/**
+ *  Decode up to \c len bytes of audio into \c buf, in the format of the
+ *  spec the stream was opened with.  Only whole sample frames are read,
+ *  so \c len needs to hold at least one.
+ *
+ *  \return The number of bytes read, 0 at the end of the data, or -1 on
+ *          error.
+ */
+extern DECLSPEC int SDLCALL SDL_ReadWAVStream(SDL_WAVStream * stream,
+                                              Uint8 * buf, int len);
+
+/**
+ *  Move the read position to a sample frame.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SeekWAVStream(SDL_WAVStream * stream,
+                                              Uint32 frame);
+
+/**
+ *  Get the sample frame that will be read next.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_TellWAVStream(SDL_WAVStream * stream);
+
+/**
+ *  Get the number of sample frames in the stream.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetWAVStreamLength(SDL_WAVStream *
+                                                      stream);
+
+/**
+ *  Close a stream, and its data source if it was opened with \c freesrc.
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream * stream);
+/*@}*//*WAVE streaming functions*/
+
 /**
  *  This function takes a source format and rate and a destination format
  *  and rate, and initializes the \c cvt structure with information needed
@@ -448,6 +515,78 @@ extern DECLSPEC int SDLCALL SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
  */
 extern DECLSPEC int SDLCALL SDL_ConvertAudio(SDL_AudioCVT * cvt);
 
+/**
+ *  \brief A streaming audio converter.
+ *
+ *  Unlike ::SDL_AudioCVT, a stream takes any amount of audio in one format
+ *  and hands back exactly as much audio in another format as you ask for,
+ *  carrying partial frames and resampler state from one call to the next.
+ *  It doesn't need an audio device, or even the audio subsystem.
+ *
+ *  \sa SDL_NewAudioStream
+ */
+struct _SDL_AudioStream;
+typedef struct _SDL_AudioStream SDL_AudioStream;
+
+/**
+ *  Create a new audio stream converting from one format, channel count and
+ *  rate to another.
+ *
+ *  \return The new stream, or NULL if the conversion isn't supported.
+ *
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(SDL_AudioFormat src_format,
+                                                             Uint8 src_channels,
+                                                             int src_rate,
+                                                             SDL_AudioFormat dst_format,
+                                                             Uint8 dst_channels,
+                                                             int dst_rate);
+
+/**
+ *  Add \c len bytes of audio in the source format to the stream.  The
+ *  length doesn't have to be a whole number of sample frames.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream * stream,
+                                               const void *buf, int len);
+
+/**
+ *  Get up to \c len bytes of converted audio from the stream.  The length
+ *  has to be a whole number of sample frames in the destination format.
+ *
+ *  \return The number of bytes read, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamGet(SDL_AudioStream * stream,
+                                               void *buf, int len);
+
+/**
+ *  Get the number of converted bytes waiting to be read from the stream.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamAvailable(SDL_AudioStream * stream);
+
+/**
+ *  Convert everything that was put into the stream, padding the end with
+ *  silence where the resampler needs to look ahead.  Call this at the end
+ *  of the input; more audio put afterwards starts a new run.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamFlush(SDL_AudioStream * stream);
+
+/**
+ *  Drop everything in the stream, both converted and unconverted audio.
+ */
+extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream * stream);
+
+/**
+ *  Free an audio stream.
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream * stream);
+
 #define SDL_MIX_MAXVOLUME 128
 /**
  *  This takes two audio buffers of the playing audio format and mixes
@@ -469,6 +608,41 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/**
+ *  \name Audio queue functions
+ *
+ *  Playback devices opened with a NULL callback play audio queued with
+ *  SDL_QueueAudio() instead, and silence when the queue runs out.  The
+ *  queue is kept in fixed size packets that are reused once played, so
+ *  queueing at a steady rate doesn't allocate memory.
+ */
+/*@{*/
+
+/**
+ *  Queue more audio on a device opened without a callback.  The data must
+ *  be in the format the device was opened with and hold whole sample
+ *  frames, and is copied, so \c data can be reused as soon as this returns.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev,
+                                           const void *data, Uint32 len);
+
+/**
+ *  Get the number of bytes of queued audio that haven't been sent to the
+ *  audio hardware yet.  Audio the device has already buffered isn't
+ *  counted.
+ *
+ *  \return The number of queued bytes, or 0 if the device doesn't queue.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
+
+/**
+ *  Drop all queued audio that hasn't been sent to the audio hardware yet.
+ */
+extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
+/*@}*//*Audio queue functions*/
+
 /**
  *  \name Audio lock functions
  *  
@@ -484,12 +658,116 @@ extern DECLSPEC void SDLCALL SDL_UnlockAudio(void);
 extern DECLSPEC void SDLCALL SDL_UnlockAudioDevice(SDL_AudioDeviceID dev);
 /*@}*//*Audio lock functions*/
 
+/**
+ *  \name Audio ring functions
+ *
+ *  These let an application feed a playback device without a callback.
+ *  After SDL_SetAudioDeviceRing() the audio thread stops calling the
+ *  callback and only copies out of a lock-free ring buffer that the
+ *  application fills with SDL_WriteAudioDeviceRing(), so it never waits
+ *  on SDL_LockAudioDevice() or anything else the application holds.
+ *
+ *  The ring has a single writer: any thread may write to it, but only one
+ *  at a time.  Data is in the format the device was opened with, and is
+ *  only accepted in whole sample frames.  If the ring runs dry, the rest
+ *  of the device buffer is filled with silence and an underrun is counted.
+ *
+ *  This isn't available with audio drivers that run the callback from
+ *  their own thread.
+ */
+/*@{*/
+
+/**
+ *  Switch a playback device to reading from a ring buffer of at least
+ *  \c size bytes.  This is best done before the device is unpaused, and
+ *  can only be done once per device.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioDeviceRing(SDL_AudioDeviceID dev,
+                                                   Uint32 size);
+
+/**
+ *  Copy up to \c len bytes of audio into a device's ring buffer.  This
+ *  never blocks, it writes as many whole sample frames as there is room
+ *  for.
+ *
+ *  \return The number of bytes written, 0 if the ring is full or on error.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_WriteAudioDeviceRing(SDL_AudioDeviceID dev,
+                                                        const void *data,
+                                                        Uint32 len);
+
+/**
+ *  \return The number of bytes waiting in a device's ring buffer.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetAudioDeviceRingFill(SDL_AudioDeviceID dev);
+
+/**
+ *  \return The number of device buffers that had to be padded with
+ *          silence because the ring buffer ran dry.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetAudioDeviceUnderruns(SDL_AudioDeviceID dev);
+/*@}*//*Audio ring functions*/
+
 /**
  *  This function shuts down audio processing and closes the audio device.
  */
 extern DECLSPEC void SDLCALL SDL_CloseAudio(void);
 extern DECLSPEC void SDLCALL SDL_CloseAudioDevice(SDL_AudioDeviceID dev);
 
+/**
+ *  Get how much audio the driver buffers after the callback fills it, in
+ *  sample frames of the device.  This is the latency the audio hardware
+ *  adds, not counting the callback's own buffer.
+ *
+ *  \return The number of frames, or 0 if the driver doesn't know.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetAudioDeviceLatency(SDL_AudioDeviceID dev);
+
+/**
+ *  \name Audio thread statistics
+ *
+ *  Timings of the audio thread, for finding out why audio glitches.
+ *  Collecting them is off by default and costs next to nothing until
+ *  SDL_EnableAudioDeviceStats() turns it on.
+ */
+/*@{*/
+typedef struct SDL_AudioDeviceStats
+{
+    Uint32 callbacks;           /**< Buffers the callback has processed */
+    Uint32 callback_usec_p50;   /**< Median time spent in the callback */
+    Uint32 callback_usec_p90;   /**< 90th percentile of callback times */
+    Uint32 callback_usec_p99;   /**< 99th percentile of callback times */
+    Uint32 callback_usec_max;   /**< Longest time spent in the callback */
+    Uint32 missed_deadlines;    /**< Buffers that took longer to produce than to play */
+    Uint32 late_wakeups;        /**< Wakeups more than half a buffer later than due */
+    Uint32 underruns;           /**< Buffers padded because the ring or queue ran dry */
+    Uint32 convert_usec_avg;    /**< Average time spent in SDL_ConvertAudio() */
+    Uint32 convert_usec_max;    /**< Longest time spent in SDL_ConvertAudio() */
+    Uint32 latency;             /**< Same as SDL_GetAudioDeviceLatency() */
+} SDL_AudioDeviceStats;
+
+/**
+ *  Turn collecting statistics for an open device on or off.  Turning it
+ *  on also clears the statistics collected so far.
+ *
+ *  \return 0 on success, or -1 if the device isn't open.
+ */
+extern DECLSPEC int SDLCALL SDL_EnableAudioDeviceStats(SDL_AudioDeviceID dev,
+                                                       int enable);
+
+/**
+ *  Get the statistics collected for an open device.  Percentiles are
+ *  rounded up to the histogram bucket they fall in, within about 12%.
+ *
+ *  \return 0 on success, or -1 if the device isn't open.
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev,
+                                                    SDL_AudioDeviceStats *
+                                                    stats);
+/*@}*//*Audio thread statistics*/
+
 /**
  * \return 1 if audio device is still functioning, zero if not, -1 on error.
  */
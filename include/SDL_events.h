@@ -535,6 +535,19 @@ extern DECLSPEC int SDLCALL SDL_WaitEventTimeout(SDL_Event * event,
  */
 extern DECLSPEC int SDLCALL SDL_PushEvent(SDL_Event * event);
 
+/**
+ *  \brief Add an array of events to the event queue.
+ *  
+ *  The event filter and event watchers see each event in turn, and all of
+ *  the events they accept are added to the queue at once.  Events rejected
+ *  by the filter are removed from the array, and the accepted events are
+ *  packed at the front of it in their original order.
+ *  
+ *  \return The number of events added, 0 if all of the events were filtered,
+ *          or -1 if the event queue was full or there was some other error.
+ */
+extern DECLSPEC int SDLCALL SDL_PushEvents(SDL_Event * events, int numevents);
+
 typedef int (SDLCALL * SDL_EventFilter) (void *userdata, SDL_Event * event);
 
 /**
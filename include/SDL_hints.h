@@ -101,7 +101,7 @@ extern "C" {
  *
  *  This variable can be set to the following values:
  *    "0" or "nearest" - Nearest pixel sampling
- *    "1" or "linear"  - Linear filtering (supported by OpenGL and Direct3D)
+ *    "1" or "linear"  - Linear filtering (supported by OpenGL, Direct3D and software)
  *    "2" or "best"    - Anisotropic filtering (supported by Direct3D)
  *
  *  By default nearest pixel sampling is used
@@ -144,6 +144,142 @@ extern "C" {
  */
 #define SDL_HINT_ORIENTATIONS "SDL_IOS_ORIENTATIONS"
 
+/**
+ *  \brief  A variable controlling which threads run timer callbacks.
+ *
+ *  The timer thread always tracks the deadlines.  With a worker pool, it
+ *  hands expired timers to the workers so one slow callback doesn't hold
+ *  up the others.  A given timer's callback still never runs concurrently
+ *  with itself.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Run all timer callbacks on the timer thread
+ *    "1"       - Run timer callbacks on a pool of threads, one per CPU
+ *                (at least two)
+ *
+ *  By default all callbacks run on the timer thread.  This variable is
+ *  checked when the timer subsystem is initialized.
+ */
+#define SDL_HINT_TIMER_THREADS "SDL_TIMER_THREADS"
+
+/**
+ *  \brief  A variable controlling the quality of audio rate conversion.
+ *
+ *  This variable can be set to the following values:
+ *    "fast" or "0"   - Use the fast, low quality resamplers
+ *    "medium" or "1" - Use a band-limited filter with a short kernel
+ *    "best" or "2"   - Use a band-limited filter with a long kernel
+ *
+ *  The band-limited filter handles 16-bit signed and 32-bit float samples
+ *  in native byte order; other formats always use the fast resamplers.
+ *  Audio streams always use the band-limited filter, "fast" gives them the
+ *  medium quality one.  By default the medium quality filter is used.  This
+ *  variable is checked when an audio conversion or stream is created.
+ */
+#define SDL_HINT_AUDIO_RESAMPLING_MODE "SDL_AUDIO_RESAMPLING_MODE"
+
+/**
+ *  \brief  A variable controlling whether SDL_ConvertAudio() works through
+ *          large buffers a block at a time.
+ *
+ *  When several conversions are needed, each one normally makes a pass over
+ *  the whole buffer.  In blocked mode the sample type and channel
+ *  conversions are done on one cache sized block after another, so the
+ *  buffer only goes through memory once for all of them.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Convert the whole buffer one step at a time
+ *    "1"       - Convert large buffers a block at a time (the default)
+ *
+ *  This variable is checked on every call to SDL_ConvertAudio().
+ */
+#define SDL_HINT_AUDIO_CONVERT_BLOCKED "SDL_AUDIO_CONVERT_BLOCKED"
+
+/**
+ *  \brief  A variable controlling whether ALSA playback writes straight into
+ *          the hardware buffer.
+ *
+ *  With mmap access, the audio callback mixes directly into the device's
+ *  ring buffer and the audio thread sleeps on the PCM's poll descriptors
+ *  until a period is free, instead of blocking in snd_pcm_writei().  This
+ *  saves a copy and lets small buffers run with less latency.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use read/write access (the default)
+ *    "1"       - Use mmap access if the device supports it
+ *
+ *  This variable is checked when a playback device is opened.
+ */
+#define SDL_HINT_AUDIO_ALSA_MMAP "SDL_AUDIO_ALSA_MMAP"
+
+/**
+ *  \brief  Variables requesting exact ALSA period and buffer sizes in frames.
+ *
+ *  When SDL_HINT_AUDIO_ALSA_PERIOD_FRAMES is set, it replaces the sample
+ *  count of the audio spec as the period size, and the device buffer holds
+ *  SDL_HINT_AUDIO_ALSA_BUFFER_FRAMES frames (two periods if that isn't set).
+ *  The hardware may round both; SDL_GetAudioDeviceLatency() reports the
+ *  buffer size that was actually used.
+ *
+ *  These variables are checked when a device is opened.
+ */
+#define SDL_HINT_AUDIO_ALSA_PERIOD_FRAMES "SDL_AUDIO_ALSA_PERIOD_FRAMES"
+#define SDL_HINT_AUDIO_ALSA_BUFFER_FRAMES "SDL_AUDIO_ALSA_BUFFER_FRAMES"
+
+/**
+ *  \brief  A variable controlling how many threads SDL_LoadWAV_RW() may use
+ *          to decode ADPCM data.
+ *
+ *  The blocks of an ADPCM file are independent, so long files can be
+ *  decoded on several threads at once.  This needs the whole encoded data
+ *  chunk in memory while it's decoded.  Files too short to be worth it
+ *  are always decoded on the calling thread.
+ *
+ *  This variable can be set to the following values:
+ *    "1"       - Decode on the calling thread (the default)
+ *    "0"       - Use a thread for each CPU
+ *    "N"       - Use up to N threads
+ */
+#define SDL_HINT_AUDIO_WAVE_THREADS "SDL_AUDIO_WAVE_THREADS"
+
+/**
+ *  \brief  A variable limiting the CPU features the software blitters use.
+ *
+ *  By default every feature the CPU has is used.  Setting this makes it
+ *  possible to compare the plain C, SSE2 and AVX2 blitters on one machine.
+ *  The value is the sum of the features allowed:
+ *    "0"       - Plain C only
+ *    "1"       - MMX
+ *    "2"       - 3DNow!
+ *    "4"       - SSE
+ *    "8"       - SSE2
+ *    "16"      - AltiVec with prefetch
+ *    "32"      - AltiVec without prefetch
+ *    "64"      - AVX2
+ *
+ *  This variable is checked whenever a surface picks its blitter, which
+ *  happens the first time it is blitted to a new destination.
+ */
+#define SDL_HINT_BLIT_CPU_FEATURES "SDL_BLIT_CPU_FEATURES"
+
+/**
+ *  \brief  A variable controlling how many threads a large software blit
+ *          may be split across.
+ *
+ *  Unscaled blits of 65536 pixels or more are split into bands of rows,
+ *  which run at the same time on a pool of threads that is kept until
+ *  SDL_Quit().  The calling thread does one of the bands and returns when
+ *  all of them are finished, so the result is the same as without threads.
+ *
+ *  This variable can be set to the following values:
+ *    "1"       - Blit on the calling thread (the default)
+ *    "0"       - Use a thread for each CPU
+ *    "N"       - Use up to N threads
+ *
+ *  This variable is checked on every blit large enough to split.
+ */
+#define SDL_HINT_BLIT_THREADS "SDL_BLIT_THREADS"
+
 
 /**
  *  \brief  An enumeration of hint priorities
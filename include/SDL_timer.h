@@ -61,6 +61,15 @@ extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceFrequency(void);
  */
 extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
 
+/**
+ * \brief Wait a specified number of nanoseconds before returning.
+ *
+ * \note The actual resolution depends on the platform.  Where the system
+ *       can only sleep in whole milliseconds, the remainder is either
+ *       rounded up or spent polling the performance counter.
+ */
+extern DECLSPEC void SDLCALL SDL_DelayNS(Uint64 ns);
+
 /**
  *  Function prototype for the timer callback function.
  *  
@@ -94,6 +103,37 @@ extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimer(Uint32 interval,
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_RemoveTimer(SDL_TimerID id);
 
+/**
+ * \brief Timer dispatch statistics, see SDL_GetTimerStats().
+ *
+ * Latencies measure how long after its deadline a timer callback started,
+ * in microseconds.
+ */
+typedef struct SDL_TimerStats
+{
+    int num_threads;        /**< The number of threads running callbacks */
+    Uint32 dispatched;      /**< The number of callbacks run */
+    Uint32 latency_p50;     /**< Median dispatch latency */
+    Uint32 latency_p90;     /**< 90th percentile dispatch latency */
+    Uint32 latency_p99;     /**< 99th percentile dispatch latency */
+    Uint32 latency_max;     /**< Worst dispatch latency */
+} SDL_TimerStats;
+
+/**
+ * \brief Get statistics on how promptly timer callbacks are dispatched.
+ *
+ * Percentiles are rounded up to the next power of two microseconds.
+ *
+ * \param stats Filled in with the statistics since the last reset.
+ * \param reset If SDL_TRUE, the statistics are cleared after being read.
+ *
+ * \return 0 on success, or -1 if the timer subsystem isn't running.
+ *
+ * \sa SDL_HINT_TIMER_THREADS
+ */
+extern DECLSPEC int SDLCALL SDL_GetTimerStats(SDL_TimerStats * stats,
+                                              SDL_bool reset);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
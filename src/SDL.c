@@ -35,6 +35,8 @@ extern void SDL_StartTicks(void);
 extern int SDL_TimerInit(void);
 extern void SDL_TimerQuit(void);
 #endif
+extern void SDL_QuitBlitThreads(void);
+extern void SDL_QuitStretch(void);
 #if defined(__WIN32__)
 extern int SDL_HelperWindowCreate(void);
 extern int SDL_HelperWindowDestroy(void);
@@ -213,6 +215,12 @@ SDL_Quit(void)
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
 
+    /* Stop the threads large blits are split across */
+    SDL_QuitBlitThreads();
+
+    /* Free the cached stretch tables */
+    SDL_QuitStretch();
+
     /* Uninstall any parachute signal handlers */
     SDL_UninstallParachute();
 
@@ -0,0 +1,40 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_config.h"
+
+#ifndef _SDL_simd_c_h
+#define _SDL_simd_c_h
+
+/* GCC 4.9 and clang 3.8 can build AVX2 functions in files compiled for
+   plain x86, callers check the CPU before using them. */
+#if (defined(__GNUC__) && !defined(__clang__) && \
+     (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || \
+    (defined(__clang__) && (__clang_major__ > 3 || \
+     (__clang_major__ == 3 && __clang_minor__ >= 8)))
+#if defined(__x86_64__) || defined(__i386__)
+#define HAVE_AVX2_TARGET 1
+#define SDL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#endif /* _SDL_simd_c_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -173,6 +173,12 @@ SDL_AudioGetDeviceBuf_Default(_THIS)
     return NULL;
 }
 
+static int
+SDL_AudioCaptureFromDevice_Default(_THIS, Uint8 ** buffer)
+{
+    return 0;
+}
+
 static void
 SDL_AudioWaitDone_Default(_THIS)
 {                               /* no-op. */
@@ -231,6 +237,7 @@ finalize_audio_entry_points(void)
     FILL_STUB(WaitDevice);
     FILL_STUB(PlayDevice);
     FILL_STUB(GetDeviceBuf);
+    FILL_STUB(CaptureFromDevice);
     FILL_STUB(WaitDone);
     FILL_STUB(CloseDevice);
     FILL_STUB(LockDevice);
@@ -305,6 +312,166 @@ SDL_StreamDeinit(SDL_AudioStreamer * stream)
 #include <android/log.h>
 #endif
 
+/* The callback used for devices opened without one, plays queued audio */
+static void SDLCALL
+SDL_BufferQueueDrainCallback(void *userdata, Uint8 * stream, int _len)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    SDL_AudioBufferQueue *packet;
+    Uint32 len = (Uint32) _len;
+    const SDL_bool had_data = (device->queued_bytes > 0);
+
+    while ((len > 0) && ((packet = device->buffer_queue_head) != NULL)) {
+        const Uint32 avail = packet->datalen - packet->startpos;
+        const Uint32 cpy = SDL_min(len, avail);
+
+        SDL_memcpy(stream, packet->data + packet->startpos, cpy);
+        packet->startpos += cpy;
+        stream += cpy;
+        len -= cpy;
+        device->queued_bytes -= cpy;
+
+        if (packet->startpos == packet->datalen) {
+            /* This packet is done, put it back in the pool */
+            device->buffer_queue_head = packet->next;
+            packet->next = device->buffer_queue_pool;
+            device->buffer_queue_pool = packet;
+        }
+    }
+    if (device->buffer_queue_head == NULL) {
+        device->buffer_queue_tail = NULL;
+    }
+
+    /* Play silence if we ran out */
+    if (len > 0) {
+        SDL_memset(stream, device->callbackspec.silence, len);
+        if (had_data && device->stats_enabled) {
+            /* We're called with the device locked */
+            ++device->stats->underruns;
+        }
+    }
+}
+
+static void
+SDL_FreeBufferQueue(SDL_AudioBufferQueue * packet)
+{
+    while (packet) {
+        SDL_AudioBufferQueue *next = packet->next;
+        SDL_free(packet);
+        packet = next;
+    }
+}
+
+/* Copy the next device buffer out of the application's ring buffer.
+   Returns SDL_FALSE if the device isn't using a ring.
+ */
+static SDL_bool
+SDL_ReadAudioRing(SDL_AudioDevice * device, Uint8 * stream, int len,
+                  int silence)
+{
+    SDL_AudioRing *ring;
+    Uint32 tail, avail, pos, cpy;
+
+    ring = (SDL_AudioRing *) SDL_AtomicGetPtr((void **) &device->ring);
+    if (ring == NULL) {
+        return SDL_FALSE;
+    }
+
+    tail = (Uint32) SDL_AtomicGet(&ring->tail);
+    avail = (Uint32) SDL_AtomicGet(&ring->head) - tail;
+    if (avail > (Uint32) len) {
+        avail = (Uint32) len;
+    } else if (avail < (Uint32) len) {
+        /* Keep the read position on a frame boundary */
+        avail -= avail % ring->frame_size;
+    }
+
+    pos = tail & (ring->size - 1);
+    cpy = SDL_min(avail, ring->size - pos);
+    SDL_memcpy(stream, ring->buffer + pos, cpy);
+    SDL_memcpy(stream + cpy, ring->buffer, avail - cpy);
+    if (avail < (Uint32) len) {
+        SDL_memset(stream + avail, silence, len - avail);
+        SDL_AtomicAdd(&ring->underruns, 1);
+        if (device->stats_enabled) {
+            SDL_mutexP(device->mixer_lock);
+            ++device->stats->underruns;
+            SDL_mutexV(device->mixer_lock);
+        }
+    }
+
+    /* Hand the space back to the writer */
+    SDL_AtomicAdd(&ring->tail, (int) avail);
+    return SDL_TRUE;
+}
+
+/* Histogram bucket for a callback time, 8 buckets per octave */
+static int
+SDL_AudioStatsBucket(Uint32 usec)
+{
+    int octave = 0;
+
+    if (usec < 8) {
+        return (int) usec;
+    }
+    while ((usec >> octave) >= 16) {
+        ++octave;
+    }
+    return 8 + octave * 8 + (int) ((usec >> octave) - 8);
+}
+
+/* The longest callback time that falls in a histogram bucket */
+static Uint32
+SDL_AudioStatsBucketMax(int bucket)
+{
+    if (bucket < 8) {
+        return (Uint32) bucket;
+    }
+    bucket -= 8;
+    return ((Uint32) (8 + (bucket % 8) + 1) << (bucket / 8)) - 1;
+}
+
+static Uint32
+SDL_AudioStatsUsec(const SDL_AudioStats * stats, Uint64 ticks)
+{
+    ticks = (ticks * 1000000) / stats->ticks_per_sec;
+    return (ticks > 0xFFFFFFFF) ? 0xFFFFFFFF : (Uint32) ticks;
+}
+
+/* Add the timings of one buffer to the device statistics.
+   'interval' is the time since the previous wakeup, or 0 if unknown,
+   and 'busy' is how long it took to get the buffer ready.
+ */
+static void
+SDL_UpdateAudioStats(SDL_AudioDevice * device, Uint64 interval, Uint64 busy,
+                     Uint64 callback, Uint64 convert)
+{
+    SDL_AudioStats *stats = device->stats;
+    const Uint64 period =
+        (device->spec.samples * stats->ticks_per_sec) / device->spec.freq;
+
+    SDL_mutexP(device->mixer_lock);
+    ++stats->callbacks;
+    ++stats->histogram[SDL_AudioStatsBucket(SDL_AudioStatsUsec(stats, callback))];
+    if (callback > stats->callback_max) {
+        stats->callback_max = callback;
+    }
+    if (device->convert.needed) {
+        ++stats->converts;
+        stats->convert_total += convert;
+        if (convert > stats->convert_max) {
+            stats->convert_max = convert;
+        }
+    }
+    if (busy > period) {
+        ++stats->missed_deadlines;
+    }
+    if (interval > period + period / 2) {
+        ++stats->late_wakeups;
+    }
+    SDL_mutexV(device->mixer_lock);
+}
+
 /* The general mixing thread function */
 int SDLCALL
 SDL_RunAudio(void *devicep)
@@ -415,9 +582,11 @@ SDL_RunAudio(void *devicep)
                 }
 
                 /* Read from the callback into the _input_ stream */
-                SDL_mutexP(device->mixer_lock);
-                (*fill) (udata, istream, istream_len);
-                SDL_mutexV(device->mixer_lock);
+                if (!SDL_ReadAudioRing(device, istream, istream_len, silence)) {
+                    SDL_mutexP(device->mixer_lock);
+                    (*fill) (udata, istream, istream_len);
+                    SDL_mutexV(device->mixer_lock);
+                }
 
                 /* Convert the audio if necessary and write to the streamer */
                 if (device->convert.needed) {
@@ -465,14 +634,21 @@ SDL_RunAudio(void *devicep)
         }
     } else {
         /* Otherwise, do not use the streamer. This is the old code. */
+        Uint64 last_wake = 0;
 
         /* Loop, filling the audio buffers */
         while (device->enabled) {
+            const int stats = device->stats_enabled;
+            Uint64 wake = 0, mixed = 0, callback = 0, convert = 0;
 
             if (device->paused) {
+                last_wake = 0;
                 SDL_Delay(delay);
                 continue;
             }
+            if (stats) {
+                wake = SDL_GetPerformanceCounter();
+            }
 
             /* Fill the current buffer with sound */
             if (device->convert.needed) {
@@ -488,13 +664,27 @@ SDL_RunAudio(void *devicep)
                 }
             }
 
-            SDL_mutexP(device->mixer_lock);
-            (*fill) (udata, stream, stream_len);
-            SDL_mutexV(device->mixer_lock);
+            if (!SDL_ReadAudioRing(device, stream, stream_len, silence)) {
+                SDL_mutexP(device->mixer_lock);
+                if (stats) {
+                    callback = SDL_GetPerformanceCounter();
+                }
+                (*fill) (udata, stream, stream_len);
+                if (stats) {
+                    mixed = SDL_GetPerformanceCounter();
+                    callback = mixed - callback;
+                }
+                SDL_mutexV(device->mixer_lock);
+            } else if (stats) {
+                mixed = SDL_GetPerformanceCounter();
+            }
 
             /* Convert the audio if necessary */
             if (device->convert.needed) {
                 SDL_ConvertAudio(&device->convert);
+                if (stats) {
+                    convert = SDL_GetPerformanceCounter() - mixed;
+                }
                 stream = current_audio.impl.GetDeviceBuf(device);
                 if (stream == NULL) {
                     stream = device->fake_stream;
@@ -503,6 +693,13 @@ SDL_RunAudio(void *devicep)
                            device->convert.len_cvt);
             }
 
+            if (stats) {
+                SDL_UpdateAudioStats(device, last_wake ? wake - last_wake : 0,
+                                     SDL_GetPerformanceCounter() - wake,
+                                     callback, convert);
+                last_wake = wake;
+            }
+
             /* Ready current buffer for play and change current buffer */
             if (stream != device->fake_stream) {
                 current_audio.impl.PlayDevice(device);
@@ -524,6 +721,91 @@ SDL_RunAudio(void *devicep)
     return (0);
 }
 
+/* The capture thread function.
+   The driver hands us a pointer to its own buffer, which goes straight
+   to the callback unless the audio has to be converted first.
+ */
+static int SDLCALL
+SDL_CaptureAudio(void *devicep)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
+    Uint8 *stream;
+    int stream_len;
+    void *udata;
+    void (SDLCALL * fill) (void *userdata, Uint8 * stream, int len);
+    Uint32 delay;
+    Uint64 last_wake = 0;
+
+    /* The audio mixing is always a high priority thread */
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    /* Perform any thread setup */
+    device->threadid = SDL_ThreadID();
+    current_audio.impl.ThreadInit(device);
+
+    /* Set up the mixing function */
+    fill = device->spec.callback;
+    udata = device->spec.userdata;
+
+    /* The delay if the driver doesn't have anything for us */
+    delay = ((device->spec.samples * 1000) / device->spec.freq);
+
+    while (device->enabled) {
+        const int stats = device->stats_enabled;
+        Uint64 wake = 0, callback = 0, convert = 0;
+
+        stream_len = current_audio.impl.CaptureFromDevice(device, &stream);
+        if (!device->enabled) {
+            break;
+        }
+        if (stream_len <= 0) {
+            SDL_Delay(delay);
+            continue;
+        }
+
+        /* Keep reading while paused, so we don't hand out stale audio */
+        if (device->paused) {
+            last_wake = 0;
+            continue;
+        }
+        if (stats) {
+            wake = SDL_GetPerformanceCounter();
+        }
+
+        if (device->convert.needed) {
+            stream_len = SDL_min(stream_len, device->convert.len);
+            SDL_memcpy(device->convert.buf, stream, stream_len);
+            device->convert.len = stream_len;
+            SDL_ConvertAudio(&device->convert);
+            device->convert.len = device->spec.size;
+            stream = device->convert.buf;
+            stream_len = device->convert.len_cvt;
+            if (stats) {
+                convert = SDL_GetPerformanceCounter() - wake;
+            }
+        }
+
+        SDL_mutexP(device->mixer_lock);
+        if (stats) {
+            callback = SDL_GetPerformanceCounter();
+        }
+        (*fill) (udata, stream, stream_len);
+        if (stats) {
+            callback = SDL_GetPerformanceCounter() - callback;
+        }
+        SDL_mutexV(device->mixer_lock);
+
+        if (stats) {
+            SDL_UpdateAudioStats(device, last_wake ? wake - last_wake : 0,
+                                 SDL_GetPerformanceCounter() - wake,
+                                 callback, convert);
+            last_wake = wake;
+        }
+    }
+
+    return (0);
+}
+
 
 static SDL_AudioFormat
 SDL_ParseAudioFormat(const char *string)
@@ -773,6 +1055,15 @@ close_audio_device(SDL_AudioDevice * device)
     if (device->convert.needed) {
         SDL_FreeAudioMem(device->convert.buf);
     }
+    if (device->ring != NULL) {
+        SDL_free(device->ring->buffer);
+        SDL_free(device->ring);
+    }
+    if (device->stats != NULL) {
+        SDL_free(device->stats);
+    }
+    SDL_FreeBufferQueue(device->buffer_queue_head);
+    SDL_FreeBufferQueue(device->buffer_queue_pool);
     if (device->opened) {
         current_audio.impl.CloseDevice(device);
         device->opened = 0;
@@ -791,11 +1082,6 @@ prepare_audiospec(const SDL_AudioSpec * orig, SDL_AudioSpec * prepared)
 {
     SDL_memcpy(prepared, orig, sizeof(SDL_AudioSpec));
 
-    if (orig->callback == NULL) {
-        SDL_SetError("SDL_OpenAudio() passed a NULL callback");
-        return 0;
-    }
-
     if (orig->freq == 0) {
         const char *env = SDL_getenv("SDL_AUDIO_FREQUENCY");
         if ((!env) || ((prepared->freq = SDL_atoi(env)) == 0)) {
@@ -870,6 +1156,11 @@ open_audio_device(const char *devname, int iscapture,
         return 0;
     }
 
+    if ((iscapture) && (desired->callback == NULL)) {
+        SDL_SetError("Capture devices need a callback");
+        return 0;
+    }
+
     if (!obtained) {
         obtained = &_obtained;
     }
@@ -991,7 +1282,28 @@ open_audio_device(const char *devname, int iscapture,
             build_cvt = SDL_TRUE;
         }
     }
-    if (build_cvt) {
+    if (build_cvt && iscapture) {
+        /* Capture converts from the device format to the application's */
+        if (SDL_BuildAudioCVT(&device->convert,
+                              device->spec.format, device->spec.channels,
+                              device->spec.freq,
+                              obtained->format, obtained->channels,
+                              obtained->freq) < 0) {
+            close_audio_device(device);
+            return 0;
+        }
+        if (device->convert.needed) {
+            device->convert.len = device->spec.size;
+            device->convert.buf =
+                (Uint8 *) SDL_AllocAudioMem(device->convert.len *
+                                            device->convert.len_mult);
+            if (device->convert.buf == NULL) {
+                close_audio_device(device);
+                SDL_OutOfMemory();
+                return 0;
+            }
+        }
+    } else if (build_cvt) {
         /* Build an audio conversion block */
         if (SDL_BuildAudioCVT(&device->convert,
                               obtained->format, obtained->channels,
@@ -1016,6 +1328,29 @@ open_audio_device(const char *devname, int iscapture,
         }
     }
 
+    device->callbackspec = *obtained;
+
+    if (device->spec.callback == NULL) {
+        /* Queue audio instead, pool enough packets for two buffers to start */
+        const Uint32 wantbytes = 2 * SDL_max(device->spec.size, obtained->size);
+        const Uint32 packetlen = SDL_AUDIOBUFFERQUEUE_PACKETLEN;
+        Uint32 wantpackets = (wantbytes + packetlen - 1) / packetlen;
+
+        while (wantpackets--) {
+            SDL_AudioBufferQueue *packet = (SDL_AudioBufferQueue *)
+                SDL_malloc(sizeof(SDL_AudioBufferQueue));
+            if (packet == NULL) {
+                close_audio_device(device);
+                SDL_OutOfMemory();
+                return 0;
+            }
+            packet->next = device->buffer_queue_pool;
+            device->buffer_queue_pool = packet;
+        }
+        device->spec.callback = SDL_BufferQueueDrainCallback;
+        device->spec.userdata = device;
+    }
+
     /* Find an available device ID and store the structure... */
     for (id = min_id - 1; id < SDL_arraysize(open_devices); id++) {
         if (open_devices[id] == NULL) {
@@ -1038,9 +1373,11 @@ open_audio_device(const char *devname, int iscapture,
 /* !!! FIXME: this is nasty. */
 #if (defined(__WIN32__) && !defined(_WIN32_WCE)) && !defined(HAVE_LIBC)
 #undef SDL_CreateThread
-        device->thread = SDL_CreateThread(SDL_RunAudio, name, device, NULL, NULL);
+        device->thread = SDL_CreateThread(iscapture ? SDL_CaptureAudio : SDL_RunAudio,
+                                          name, device, NULL, NULL);
 #else
-        device->thread = SDL_CreateThread(SDL_RunAudio, name, device);
+        device->thread = SDL_CreateThread(iscapture ? SDL_CaptureAudio : SDL_RunAudio,
+                                          name, device);
 #endif
         if (device->thread == NULL) {
             SDL_CloseAudioDevice(id + 1);
@@ -1161,6 +1498,326 @@ SDL_UnlockAudio(void)
     SDL_UnlockAudioDevice(1);
 }
 
+int
+SDL_QueueAudio(SDL_AudioDeviceID devid, const void *_data, Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    const Uint8 *data = (const Uint8 *) _data;
+    SDL_AudioBufferQueue *packet;
+    int retval = 0;
+
+    if (!device) {
+        return -1;
+    }
+    if (device->spec.callback != SDL_BufferQueueDrainCallback) {
+        SDL_SetError("Audio device has a callback, queueing not allowed");
+        return -1;
+    }
+    if (len % ((SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) *
+               device->callbackspec.channels) != 0) {
+        SDL_SetError("Queued audio must be a whole number of sample frames");
+        return -1;
+    }
+
+    current_audio.impl.LockDevice(device);
+
+    /* Top up the last packet first */
+    packet = device->buffer_queue_tail;
+    while (len > 0) {
+        Uint32 cpy;
+
+        if (!packet || (packet->datalen >= SDL_AUDIOBUFFERQUEUE_PACKETLEN)) {
+            /* Take a packet from the pool, allocating only if it's empty */
+            packet = device->buffer_queue_pool;
+            if (packet) {
+                device->buffer_queue_pool = packet->next;
+            } else {
+                packet = (SDL_AudioBufferQueue *)
+                    SDL_malloc(sizeof(SDL_AudioBufferQueue));
+                if (packet == NULL) {
+                    SDL_OutOfMemory();
+                    retval = -1;
+                    break;
+                }
+            }
+            packet->datalen = 0;
+            packet->startpos = 0;
+            packet->next = NULL;
+            if (device->buffer_queue_tail) {
+                device->buffer_queue_tail->next = packet;
+            } else {
+                device->buffer_queue_head = packet;
+            }
+            device->buffer_queue_tail = packet;
+        }
+
+        cpy = SDL_min(len, SDL_AUDIOBUFFERQUEUE_PACKETLEN - packet->datalen);
+        SDL_memcpy(packet->data + packet->datalen, data, cpy);
+        packet->datalen += cpy;
+        data += cpy;
+        len -= cpy;
+        device->queued_bytes += cpy;
+    }
+
+    current_audio.impl.UnlockDevice(device);
+
+    return retval;
+}
+
+Uint32
+SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint32 retval = 0;
+
+    if (device && (device->spec.callback == SDL_BufferQueueDrainCallback)) {
+        current_audio.impl.LockDevice(device);
+        retval = device->queued_bytes;
+        current_audio.impl.UnlockDevice(device);
+    }
+    return retval;
+}
+
+void
+SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioBufferQueue *packet;
+
+    if (!device || (device->spec.callback != SDL_BufferQueueDrainCallback)) {
+        return;
+    }
+
+    /* Keep the packets in the pool for the next SDL_QueueAudio() */
+    current_audio.impl.LockDevice(device);
+    packet = device->buffer_queue_tail;
+    if (packet) {
+        packet->next = device->buffer_queue_pool;
+        device->buffer_queue_pool = device->buffer_queue_head;
+    }
+    device->buffer_queue_head = NULL;
+    device->buffer_queue_tail = NULL;
+    device->queued_bytes = 0;
+    current_audio.impl.UnlockDevice(device);
+}
+
+int
+SDL_SetAudioDeviceRing(SDL_AudioDeviceID devid, Uint32 size)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioRing *ring;
+    Uint32 min_size;
+
+    if (!device) {
+        return -1;
+    }
+    if (device->iscapture) {
+        SDL_SetError("Audio ring buffers are only for playback devices");
+        return -1;
+    }
+    if (current_audio.impl.ProvidesOwnCallbackThread) {
+        SDL_SetError("Audio ring buffers aren't supported by this audio driver");
+        return -1;
+    }
+    if (device->ring != NULL) {
+        SDL_SetError("Audio device already has a ring buffer");
+        return -1;
+    }
+
+    /* Hold at least two device buffers, rounded up to a power of 2 */
+    min_size = SDL_max(size, 2 * device->spec.size);
+    for (size = 1; size < min_size; size <<= 1) {
+        if (size >= 0x40000000) {
+            SDL_SetError("Audio ring buffer is too large");
+            return -1;
+        }
+    }
+
+    ring = (SDL_AudioRing *) SDL_calloc(1, sizeof(*ring));
+    if (ring == NULL) {
+        SDL_OutOfMemory();
+        return -1;
+    }
+    ring->buffer = (Uint8 *) SDL_malloc(size);
+    if (ring->buffer == NULL) {
+        SDL_free(ring);
+        SDL_OutOfMemory();
+        return -1;
+    }
+    ring->size = size;
+    ring->frame_size = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) *
+        device->callbackspec.channels;
+
+    /* From here on the audio thread reads the ring instead of the callback */
+    (void) SDL_AtomicSetPtr((void **) &device->ring, ring);
+    return 0;
+}
+
+Uint32
+SDL_WriteAudioDeviceRing(SDL_AudioDeviceID devid, const void *data,
+                         Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioRing *ring;
+    Uint32 head, pos, cpy;
+
+    if (!device) {
+        return 0;
+    }
+    ring = device->ring;
+    if (ring == NULL) {
+        SDL_SetError("Audio device doesn't have a ring buffer");
+        return 0;
+    }
+
+    /* Only we move the head, so only the free space can change under us */
+    head = (Uint32) SDL_AtomicGet(&ring->head);
+    len = SDL_min(len, ring->size - (head - (Uint32) SDL_AtomicGet(&ring->tail)));
+    len -= len % ring->frame_size;
+
+    pos = head & (ring->size - 1);
+    cpy = SDL_min(len, ring->size - pos);
+    SDL_memcpy(ring->buffer + pos, data, cpy);
+    SDL_memcpy(ring->buffer, (const Uint8 *) data + cpy, len - cpy);
+
+    /* Publish the data to the audio thread */
+    SDL_AtomicAdd(&ring->head, (int) len);
+    return len;
+}
+
+Uint32
+SDL_GetAudioDeviceRingFill(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioRing *ring = device ? device->ring : NULL;
+
+    Uint32 tail;
+
+    if (ring == NULL) {
+        return 0;
+    }
+    /* Both ends may be moving, don't report more than the ring holds */
+    tail = (Uint32) SDL_AtomicGet(&ring->tail);
+    return SDL_min((Uint32) SDL_AtomicGet(&ring->head) - tail, ring->size);
+}
+
+Uint32
+SDL_GetAudioDeviceUnderruns(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioRing *ring = device ? device->ring : NULL;
+
+    if (ring == NULL) {
+        return 0;
+    }
+    return (Uint32) SDL_AtomicGet(&ring->underruns);
+}
+
+Uint32
+SDL_GetAudioDeviceLatency(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return 0;
+    }
+    return device->latency;
+}
+
+int
+SDL_EnableAudioDeviceStats(SDL_AudioDeviceID devid, int enable)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;
+    }
+
+    if (!enable) {
+        device->stats_enabled = 0;
+        return 0;
+    }
+
+    /* The audio thread may be using the old statistics, so they stay
+       allocated until the device is closed */
+    if (device->stats == NULL) {
+        device->stats = (SDL_AudioStats *) SDL_malloc(sizeof (SDL_AudioStats));
+        if (device->stats == NULL) {
+            SDL_OutOfMemory();
+            return -1;
+        }
+    }
+    SDL_mutexP(device->mixer_lock);
+    SDL_zerop(device->stats);
+    device->stats->ticks_per_sec = SDL_GetPerformanceFrequency();
+    device->stats_enabled = 1;
+    SDL_mutexV(device->mixer_lock);
+    return 0;
+}
+
+/* The callback time at a percentile of the histogram */
+static Uint32
+SDL_AudioStatsPercentile(const SDL_AudioStats * stats, int percent)
+{
+    const Uint32 max = SDL_AudioStatsUsec(stats, stats->callback_max);
+    const Uint32 target =
+        (Uint32) (((Uint64) stats->callbacks * percent + 99) / 100);
+    Uint32 count = 0;
+    int i;
+
+    for (i = 0; i < SDL_AUDIOSTATS_BUCKETS; ++i) {
+        count += stats->histogram[i];
+        if (count >= target) {
+            const Uint32 usec = SDL_AudioStatsBucketMax(i);
+            return (usec < max) ? usec : max;
+        }
+    }
+    return max;
+}
+
+int
+SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid,
+                        SDL_AudioDeviceStats * stats)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;
+    }
+    if (stats == NULL) {
+        SDL_SetError("SDL_GetAudioDeviceStats() passed a NULL stats");
+        return -1;
+    }
+
+    SDL_zerop(stats);
+    stats->latency = device->latency;
+    if (device->stats == NULL) {
+        return 0;
+    }
+
+    SDL_mutexP(device->mixer_lock);
+    stats->callbacks = device->stats->callbacks;
+    if (stats->callbacks > 0) {
+        stats->callback_usec_p50 = SDL_AudioStatsPercentile(device->stats, 50);
+        stats->callback_usec_p90 = SDL_AudioStatsPercentile(device->stats, 90);
+        stats->callback_usec_p99 = SDL_AudioStatsPercentile(device->stats, 99);
+        stats->callback_usec_max =
+            SDL_AudioStatsUsec(device->stats, device->stats->callback_max);
+    }
+    stats->missed_deadlines = device->stats->missed_deadlines;
+    stats->late_wakeups = device->stats->late_wakeups;
+    stats->underruns = device->stats->underruns;
+    if (device->stats->converts > 0) {
+        stats->convert_usec_avg =
+            SDL_AudioStatsUsec(device->stats, device->stats->convert_total /
+                               device->stats->converts);
+        stats->convert_usec_max =
+            SDL_AudioStatsUsec(device->stats, device->stats->convert_max);
+    }
+    SDL_mutexV(device->mixer_lock);
+    return 0;
+}
+
 void
 SDL_CloseAudioDevice(SDL_AudioDeviceID devid)
 {
@@ -1191,6 +1848,8 @@ SDL_AudioQuit(void)
                      &current_audio.outputDeviceCount);
     free_device_list(&current_audio.inputDevices,
                      &current_audio.inputDeviceCount);
+    SDL_FreeResampleFilters();
+    SDL_FreeAudioCVTPlans();
     SDL_memset(&current_audio, '\0', sizeof(current_audio));
     SDL_memset(open_devices, '\0', sizeof(open_devices));
 }
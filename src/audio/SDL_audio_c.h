@@ -20,6 +20,8 @@
 */
 #include "SDL_config.h"
 
+#include "../SDL_simd_c.h"
+
 /* Functions and variables exported from SDL_audio.c for SDL_sysaudio.c */
 
 /* Functions to get a list of "close" audio formats */
@@ -41,6 +43,12 @@ typedef struct
 } SDL_AudioTypeFilters;
 extern const SDL_AudioTypeFilters sdl_audio_type_filters[];
 
+/* Free the resampler filter tables no audio stream is using */
+extern void SDL_FreeResampleFilters(void);
+
+/* Free the filter chains SDL_BuildAudioCVT() kept */
+extern void SDL_FreeAudioCVTPlans(void);
+
 /* this is used internally to access some autogenerated code. */
 typedef struct
 {
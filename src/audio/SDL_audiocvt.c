@@ -26,6 +26,16 @@
 #include "SDL_audio_c.h"
 
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2_TARGET
+#include <immintrin.h>
+#endif
 
 /* #define DEBUG_CONVERT */
 
@@ -39,7 +49,8 @@ SDL_ConvertMono(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #ifdef DEBUG_CONVERT
     fprintf(stderr, "Converting to mono\n");
 #endif
-    switch (format & (SDL_AUDIO_MASK_SIGNED | SDL_AUDIO_MASK_BITSIZE)) {
+    switch (format & (SDL_AUDIO_MASK_DATATYPE | SDL_AUDIO_MASK_SIGNED |
+                      SDL_AUDIO_MASK_BITSIZE)) {
     case AUDIO_U8:
         {
             Uint8 *src, *dst;
@@ -293,10 +304,9 @@ SDL_ConvertStereo(SDL_AudioCVT * cvt, SDL_AudioFormat format)
         const type *src = (const type *) (cvt->buf + cvt->len_cvt); \
         type *dst = (type *) (cvt->buf + cvt->len_cvt * 2); \
         for (i = cvt->len_cvt / sizeof(type); i; --i) { \
-            const type val = *src; \
             src -= 1; \
             dst -= 2; \
-            dst[0] = dst[1] = val; \
+            dst[0] = dst[1] = *src; \
         } \
     }
 
@@ -332,14 +342,15 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     fprintf(stderr, "Converting stereo to surround\n");
 #endif
 
-    switch (format & (SDL_AUDIO_MASK_SIGNED | SDL_AUDIO_MASK_BITSIZE)) {
+    switch (format & (SDL_AUDIO_MASK_DATATYPE | SDL_AUDIO_MASK_SIGNED |
+                      SDL_AUDIO_MASK_BITSIZE)) {
     case AUDIO_U8:
         {
             Uint8 *src, *dst, lf, rf, ce;
 
             src = (Uint8 *) (cvt->buf + cvt->len_cvt);
             dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 3);
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 6;
                 src -= 2;
                 lf = src[0];
@@ -361,7 +372,7 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Sint8 *) cvt->buf + cvt->len_cvt;
             dst = (Sint8 *) cvt->buf + cvt->len_cvt * 3;
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 6;
                 src -= 2;
                 lf = src[0];
@@ -500,8 +511,8 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     case AUDIO_S32:
         {
             Sint32 lf, rf, ce;
-            const Uint32 *src = (const Uint32 *) cvt->buf + cvt->len_cvt;
-            Uint32 *dst = (Uint32 *) cvt->buf + cvt->len_cvt * 3;
+            const Uint32 *src = (const Uint32 *) (cvt->buf + cvt->len_cvt);
+            Uint32 *dst = (Uint32 *) (cvt->buf + cvt->len_cvt * 3);
 
             if (SDL_AUDIO_ISBIGENDIAN(format)) {
                 for (i = cvt->len_cvt / 8; i; --i) {
@@ -538,8 +549,8 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     case AUDIO_F32:
         {
             float lf, rf, ce;
-            const float *src = (const float *) cvt->buf + cvt->len_cvt;
-            float *dst = (float *) cvt->buf + cvt->len_cvt * 3;
+            const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+            float *dst = (float *) (cvt->buf + cvt->len_cvt * 3);
 
             if (SDL_AUDIO_ISBIGENDIAN(format)) {
                 for (i = cvt->len_cvt / 8; i; --i) {
@@ -589,14 +600,15 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     fprintf(stderr, "Converting stereo to quad\n");
 #endif
 
-    switch (format & (SDL_AUDIO_MASK_SIGNED | SDL_AUDIO_MASK_BITSIZE)) {
+    switch (format & (SDL_AUDIO_MASK_DATATYPE | SDL_AUDIO_MASK_SIGNED |
+                      SDL_AUDIO_MASK_BITSIZE)) {
     case AUDIO_U8:
         {
             Uint8 *src, *dst, lf, rf, ce;
 
             src = (Uint8 *) (cvt->buf + cvt->len_cvt);
             dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 2);
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 4;
                 src -= 2;
                 lf = src[0];
@@ -616,7 +628,7 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Sint8 *) cvt->buf + cvt->len_cvt;
             dst = (Sint8 *) cvt->buf + cvt->len_cvt * 2;
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 4;
                 src -= 2;
                 lf = src[0];
@@ -763,6 +775,40 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
             }
         }
         break;
+
+    case AUDIO_F32:
+        {
+            const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+            float *dst = (float *) (cvt->buf + cvt->len_cvt * 2);
+            float lf, rf, ce;
+
+            if (SDL_AUDIO_ISBIGENDIAN(format)) {
+                for (i = cvt->len_cvt / 8; i; --i) {
+                    dst -= 4;
+                    src -= 2;
+                    lf = SDL_SwapFloatBE(src[0]);
+                    rf = SDL_SwapFloatBE(src[1]);
+                    ce = (lf * 0.5f) + (rf * 0.5f);
+                    dst[0] = src[0];
+                    dst[1] = src[1];
+                    dst[2] = SDL_SwapFloatBE(lf - ce);
+                    dst[3] = SDL_SwapFloatBE(rf - ce);
+                }
+            } else {
+                for (i = cvt->len_cvt / 8; i; --i) {
+                    dst -= 4;
+                    src -= 2;
+                    lf = SDL_SwapFloatLE(src[0]);
+                    rf = SDL_SwapFloatLE(src[1]);
+                    ce = (lf * 0.5f) + (rf * 0.5f);
+                    dst[0] = src[0];
+                    dst[1] = src[1];
+                    dst[2] = SDL_SwapFloatLE(lf - ce);
+                    dst[3] = SDL_SwapFloatLE(rf - ce);
+                }
+            }
+        }
+        break;
     }
     cvt->len_cvt *= 2;
     if (cvt->filters[++cvt->filter_index]) {
@@ -771,6 +817,120 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 
 
+/*
+ * Blocked conversion.
+ *
+ * Everything but rate conversion works on each sample frame by itself, so
+ *  those filters can be run on a small block of the buffer at a time while
+ *  it's in the cache, instead of each one making a trip through memory.
+ *  The blocks are copied to a scratch buffer, converted there and copied
+ *  to where their output goes in (cvt->buf).  When the data grows, the
+ *  blocks are done from the end of the buffer, like the filters do it
+ *  themselves, so no block is overwritten before it's read.
+ */
+
+/* A block is a whole number of frames for every layout SDL converts:
+   1, 2, 4 and 6 channels of 1, 2 and 4 byte samples */
+#define SDL_CONVERT_UNIT        96
+#define SDL_CONVERT_BLOCK       (SDL_CONVERT_UNIT * 64)
+/* Below this the buffer stays in the cache anyway */
+#define SDL_CONVERT_BLOCKED_MIN (256 * 1024)
+
+/* Returns -1 if the conversion should be done the usual way */
+static int
+SDL_ConvertAudioBlocked(SDL_AudioCVT * cvt)
+{
+    const char *hint;
+    SDL_AudioCVT block;
+    Uint8 *scratch;
+    int stages, traffic, unit_in, unit_out, len, offset;
+    int i;
+
+    /* Small buffers are the common case, don't look up the hint for them */
+    if (cvt->len < SDL_CONVERT_BLOCKED_MIN) {
+        return -1;
+    }
+    hint = SDL_GetHint(SDL_HINT_AUDIO_CONVERT_BLOCKED);
+    if (hint && *hint == '0') {
+        return -1;
+    }
+
+    /* Rate conversion is always last, and it can't be split up */
+    for (stages = 0; cvt->filters[stages]; ++stages) {
+        /* just counting */
+    }
+    if (cvt->rate_incr != 1.0) {
+        --stages;
+    }
+    if (stages < 2) {
+        return -1;              /* nothing to save */
+    }
+
+    scratch = (Uint8 *) SDL_malloc(SDL_CONVERT_BLOCK * cvt->len_mult);
+    if (scratch == NULL) {
+        return -1;
+    }
+    block = *cvt;
+    block.buf = scratch;
+
+    /* Every whole unit of input makes the same amount of output.  Run the
+       steps on a unit of silence to see how much data each one moves. */
+    traffic = 0;
+    unit_in = SDL_CONVERT_UNIT;
+    for (i = 1; i <= stages; ++i) {
+        block.filters[i] = NULL;
+        SDL_memset(scratch, '\0', SDL_CONVERT_UNIT);
+        block.len_cvt = SDL_CONVERT_UNIT;
+        block.filter_index = 0;
+        block.filters[0] (&block, cvt->src_format);
+        traffic += unit_in + block.len_cvt;
+        unit_in = block.len_cvt;
+        block.filters[i] = cvt->filters[i];
+    }
+    block.filters[stages] = NULL;
+    unit_out = block.len_cvt;
+
+    /* Copying the blocks in and out isn't free, this only pays off when
+       the steps go through a lot more data than the input and output */
+    if (traffic <= 3 * (SDL_CONVERT_UNIT + unit_out)) {
+        SDL_free(scratch);
+        return -1;
+    }
+
+    len = cvt->len;
+    cvt->len_cvt = 0;
+    if (unit_out > SDL_CONVERT_UNIT) {
+        offset = ((len - 1) / SDL_CONVERT_BLOCK) * SDL_CONVERT_BLOCK;
+    } else {
+        offset = 0;
+    }
+    while (offset >= 0 && offset < len) {
+        const int size = SDL_min(SDL_CONVERT_BLOCK, len - offset);
+
+        SDL_memcpy(scratch, cvt->buf + offset, size);
+        block.len_cvt = size;
+        block.filter_index = 0;
+        block.filters[0] (&block, cvt->src_format);
+        SDL_memcpy(cvt->buf + (offset / SDL_CONVERT_UNIT) * unit_out,
+                   scratch, block.len_cvt);
+        cvt->len_cvt += block.len_cvt;
+
+        if (unit_out > SDL_CONVERT_UNIT) {
+            offset -= SDL_CONVERT_BLOCK;
+        } else {
+            offset += SDL_CONVERT_BLOCK;
+        }
+    }
+    SDL_free(scratch);
+
+    /* Finish with the rate conversion, on the whole buffer */
+    cvt->filter_index = stages;
+    if (cvt->filters[stages]) {
+        cvt->filters[stages] (cvt, cvt->dst_format);
+    }
+    return 0;
+}
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -790,11 +950,308 @@ SDL_ConvertAudio(SDL_AudioCVT * cvt)
 
     /* Set up the conversion and go! */
     cvt->filter_index = 0;
-    cvt->filters[0] (cvt, cvt->src_format);
+    if (SDL_ConvertAudioBlocked(cvt) < 0) {
+        cvt->filters[0] (cvt, cvt->src_format);
+    }
     return (0);
 }
 
 
+/*
+ * Vectorized converters between the native byte order 16-bit, 32-bit and
+ *  float formats.  They compute the same values as the generated ones,
+ *  except that out of range floats saturate when converted to 16-bit.
+ *  Converters that grow the data work from the end of the buffer, like
+ *  the generated ones, so nothing is overwritten before it's read.
+ */
+
+#define DIVBY32767 3.05185094759972e-05f
+#define DIVBY2147483647 4.6566128752458e-10f
+
+static __inline__ Sint16
+SDL_FloatToS16(float sample)
+{
+    const float val = sample * 32767.0f;
+    if (val >= 32767.0f) {
+        return 32767;
+    } else if (val <= -32768.0f) {
+        return -32768;
+    }
+    return (Sint16) val;
+}
+
+#ifdef __SSE2__
+static void
+SDL_Convert_S16_to_F32_SSE2(const Sint16 * src, float *dst, int num)
+{
+    const __m128 scale = _mm_set1_ps(DIVBY32767);
+    int i = num;
+
+    while (i & 7) {
+        --i;
+        dst[i] = ((float) src[i]) * DIVBY32767;
+    }
+    while (i) {
+        __m128i ints = _mm_loadu_si128((const __m128i *) &src[i -= 8]);
+        /* Sign extend by unpacking into the high half and shifting down */
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(ints, ints), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(ints, ints), 16);
+        _mm_storeu_ps(&dst[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+        _mm_storeu_ps(&dst[i], _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+    }
+}
+
+static void
+SDL_Convert_F32_to_S16_SSE2(const float *src, Sint16 * dst, int num)
+{
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(&src[i]), scale));
+        __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(&src[i + 4]), scale));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packs_epi32(lo, hi));
+    }
+    for (; i < num; ++i) {
+        dst[i] = SDL_FloatToS16(src[i]);
+    }
+}
+
+static void
+SDL_Convert_S32_to_F32_SSE2(const Sint32 * src, float *dst, int num)
+{
+    const __m128 scale = _mm_set1_ps(DIVBY2147483647);
+    int i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        __m128i ints = _mm_loadu_si128((const __m128i *) &src[i]);
+        _mm_storeu_ps(&dst[i], _mm_mul_ps(_mm_cvtepi32_ps(ints), scale));
+    }
+    for (; i < num; ++i) {
+        dst[i] = ((float) src[i]) * DIVBY2147483647;
+    }
+}
+
+static void
+SDL_Convert_F32_to_S32_SSE2(const float *src, Sint32 * dst, int num)
+{
+    /* The generated converter scales in double precision */
+    const __m128d scale = _mm_set1_pd(2147483647.0);
+    int i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        __m128 floats = _mm_loadu_ps(&src[i]);
+        __m128d lo = _mm_mul_pd(_mm_cvtps_pd(floats), scale);
+        __m128d hi = _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(floats, floats)), scale);
+        _mm_storeu_si128((__m128i *) &dst[i],
+                         _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo),
+                                            _mm_cvttpd_epi32(hi)));
+    }
+    for (; i < num; ++i) {
+        dst[i] = (Sint32) (src[i] * 2147483647.0);
+    }
+}
+
+static void
+SDL_Convert_S16_to_S32_SSE2(const Sint16 * src, Sint32 * dst, int num)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i = num;
+
+    while (i & 7) {
+        --i;
+        dst[i] = ((Sint32) src[i]) << 16;
+    }
+    while (i) {
+        __m128i ints = _mm_loadu_si128((const __m128i *) &src[i -= 8]);
+        _mm_storeu_si128((__m128i *) &dst[i + 4], _mm_unpackhi_epi16(zero, ints));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_unpacklo_epi16(zero, ints));
+    }
+}
+
+static void
+SDL_Convert_S32_to_S16_SSE2(const Sint32 * src, Sint16 * dst, int num)
+{
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        __m128i lo = _mm_srai_epi32(_mm_loadu_si128((const __m128i *) &src[i]), 16);
+        __m128i hi = _mm_srai_epi32(_mm_loadu_si128((const __m128i *) &src[i + 4]), 16);
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packs_epi32(lo, hi));
+    }
+    for (; i < num; ++i) {
+        dst[i] = (Sint16) (src[i] >> 16);
+    }
+}
+#endif /* __SSE2__ */
+
+#ifdef HAVE_AVX2_TARGET
+static void SDL_TARGET_AVX2
+SDL_Convert_S16_to_F32_AVX2(const Sint16 * src, float *dst, int num)
+{
+    const __m256 scale = _mm256_set1_ps(DIVBY32767);
+    int i = num;
+
+    while (i & 15) {
+        --i;
+        dst[i] = ((float) src[i]) * DIVBY32767;
+    }
+    while (i) {
+        __m128i lo = _mm_loadu_si128((const __m128i *) &src[i -= 16]);
+        __m128i hi = _mm_loadu_si128((const __m128i *) &src[i + 8]);
+        __m256 flo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(lo));
+        __m256 fhi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(hi));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_mul_ps(fhi, scale));
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(flo, scale));
+    }
+}
+
+static void SDL_TARGET_AVX2
+SDL_Convert_F32_to_S16_AVX2(const float *src, Sint16 * dst, int num)
+{
+    const __m256 scale = _mm256_set1_ps(32767.0f);
+    int i;
+
+    for (i = 0; i + 16 <= num; i += 16) {
+        __m256i lo = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), scale));
+        __m256i hi = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), scale));
+        /* The pack works within 128-bit lanes, put the halves back in order */
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256((__m256i *) &dst[i], packed);
+    }
+    for (; i < num; ++i) {
+        dst[i] = SDL_FloatToS16(src[i]);
+    }
+}
+
+static void SDL_TARGET_AVX2
+SDL_Convert_S32_to_F32_AVX2(const Sint32 * src, float *dst, int num)
+{
+    const __m256 scale = _mm256_set1_ps(DIVBY2147483647);
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        __m256i ints = _mm256_loadu_si256((const __m256i *) &src[i]);
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(ints), scale));
+    }
+    for (; i < num; ++i) {
+        dst[i] = ((float) src[i]) * DIVBY2147483647;
+    }
+}
+
+static void SDL_TARGET_AVX2
+SDL_Convert_F32_to_S32_AVX2(const float *src, Sint32 * dst, int num)
+{
+    const __m256d scale = _mm256_set1_pd(2147483647.0);
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        __m256d lo = _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(&src[i])), scale);
+        __m256d hi = _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(&src[i + 4])), scale);
+        _mm_storeu_si128((__m128i *) &dst[i], _mm256_cvttpd_epi32(lo));
+        _mm_storeu_si128((__m128i *) &dst[i + 4], _mm256_cvttpd_epi32(hi));
+    }
+    for (; i < num; ++i) {
+        dst[i] = (Sint32) (src[i] * 2147483647.0);
+    }
+}
+
+static void SDL_TARGET_AVX2
+SDL_Convert_S16_to_S32_AVX2(const Sint16 * src, Sint32 * dst, int num)
+{
+    int i = num;
+
+    while (i & 15) {
+        --i;
+        dst[i] = ((Sint32) src[i]) << 16;
+    }
+    while (i) {
+        __m128i lo = _mm_loadu_si128((const __m128i *) &src[i -= 16]);
+        __m128i hi = _mm_loadu_si128((const __m128i *) &src[i + 8]);
+        __m256i ilo = _mm256_slli_epi32(_mm256_cvtepi16_epi32(lo), 16);
+        __m256i ihi = _mm256_slli_epi32(_mm256_cvtepi16_epi32(hi), 16);
+        _mm256_storeu_si256((__m256i *) &dst[i + 8], ihi);
+        _mm256_storeu_si256((__m256i *) &dst[i], ilo);
+    }
+}
+
+static void SDL_TARGET_AVX2
+SDL_Convert_S32_to_S16_AVX2(const Sint32 * src, Sint16 * dst, int num)
+{
+    int i;
+
+    for (i = 0; i + 16 <= num; i += 16) {
+        __m256i lo = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *) &src[i]), 16);
+        __m256i hi = _mm256_srai_epi32(_mm256_loadu_si256((const __m256i *) &src[i + 8]), 16);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256((__m256i *) &dst[i], packed);
+    }
+    for (; i < num; ++i) {
+        dst[i] = (Sint16) (src[i] >> 16);
+    }
+}
+#endif /* HAVE_AVX2_TARGET */
+
+#define TYPECVT_FILTER(kernel, srctype, dsttype, dst_fmt) \
+static void SDLCALL \
+SDL_Filter_##kernel(SDL_AudioCVT * cvt, SDL_AudioFormat format) \
+{ \
+    const int num = cvt->len_cvt / sizeof (srctype); \
+    SDL_##kernel((const srctype *) cvt->buf, (dsttype *) cvt->buf, num); \
+    cvt->len_cvt = num * sizeof (dsttype); \
+    if (cvt->filters[++cvt->filter_index]) { \
+        cvt->filters[cvt->filter_index] (cvt, dst_fmt); \
+    } \
+}
+
+#ifdef __SSE2__
+TYPECVT_FILTER(Convert_S16_to_F32_SSE2, Sint16, float, AUDIO_F32SYS)
+TYPECVT_FILTER(Convert_F32_to_S16_SSE2, float, Sint16, AUDIO_S16SYS)
+TYPECVT_FILTER(Convert_S32_to_F32_SSE2, Sint32, float, AUDIO_F32SYS)
+TYPECVT_FILTER(Convert_F32_to_S32_SSE2, float, Sint32, AUDIO_S32SYS)
+TYPECVT_FILTER(Convert_S16_to_S32_SSE2, Sint16, Sint32, AUDIO_S32SYS)
+TYPECVT_FILTER(Convert_S32_to_S16_SSE2, Sint32, Sint16, AUDIO_S16SYS)
+#endif
+#ifdef HAVE_AVX2_TARGET
+TYPECVT_FILTER(Convert_S16_to_F32_AVX2, Sint16, float, AUDIO_F32SYS)
+TYPECVT_FILTER(Convert_F32_to_S16_AVX2, float, Sint16, AUDIO_S16SYS)
+TYPECVT_FILTER(Convert_S32_to_F32_AVX2, Sint32, float, AUDIO_F32SYS)
+TYPECVT_FILTER(Convert_F32_to_S32_AVX2, float, Sint32, AUDIO_S32SYS)
+TYPECVT_FILTER(Convert_S16_to_S32_AVX2, Sint16, Sint32, AUDIO_S32SYS)
+TYPECVT_FILTER(Convert_S32_to_S16_AVX2, Sint32, Sint16, AUDIO_S16SYS)
+#endif
+
+#undef TYPECVT_FILTER
+
+static const struct
+{
+    SDL_AudioFormat src_fmt;
+    SDL_AudioFormat dst_fmt;
+    SDL_AudioFilter sse2;
+    SDL_AudioFilter avx2;
+} sdl_simd_type_filters[] = {
+#if defined(__SSE2__) && defined(HAVE_AVX2_TARGET)
+#define SIMD_TYPE_FILTER(src, dst, name) \
+    { src, dst, SDL_Filter_##name##_SSE2, SDL_Filter_##name##_AVX2 },
+#elif defined(__SSE2__)
+#define SIMD_TYPE_FILTER(src, dst, name) \
+    { src, dst, SDL_Filter_##name##_SSE2, NULL },
+#elif defined(HAVE_AVX2_TARGET)
+#define SIMD_TYPE_FILTER(src, dst, name) \
+    { src, dst, NULL, SDL_Filter_##name##_AVX2 },
+#else
+#define SIMD_TYPE_FILTER(src, dst, name)
+#endif
+    SIMD_TYPE_FILTER(AUDIO_S16SYS, AUDIO_F32SYS, Convert_S16_to_F32)
+    SIMD_TYPE_FILTER(AUDIO_F32SYS, AUDIO_S16SYS, Convert_F32_to_S16)
+    SIMD_TYPE_FILTER(AUDIO_S32SYS, AUDIO_F32SYS, Convert_S32_to_F32)
+    SIMD_TYPE_FILTER(AUDIO_F32SYS, AUDIO_S32SYS, Convert_F32_to_S32)
+    SIMD_TYPE_FILTER(AUDIO_S16SYS, AUDIO_S32SYS, Convert_S16_to_S32)
+    SIMD_TYPE_FILTER(AUDIO_S32SYS, AUDIO_S16SYS, Convert_S32_to_S16)
+#undef SIMD_TYPE_FILTER
+    { 0, 0, NULL, NULL }
+};
+
 static SDL_AudioFilter
 SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
 {
@@ -802,6 +1259,20 @@ SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
      * Fill in any future conversions that are specialized to a
      *  processor, platform, compiler, or library here.
      */
+    int i;
+
+    for (i = 0; sdl_simd_type_filters[i].src_fmt != 0; i++) {
+        if ((sdl_simd_type_filters[i].src_fmt == src_fmt) &&
+            (sdl_simd_type_filters[i].dst_fmt == dst_fmt)) {
+            if (sdl_simd_type_filters[i].avx2 && SDL_HasAVX2()) {
+                return sdl_simd_type_filters[i].avx2;
+            }
+            if (sdl_simd_type_filters[i].sse2 && SDL_HasSSE2()) {
+                return sdl_simd_type_filters[i].sse2;
+            }
+            break;
+        }
+    }
 
     return NULL;                /* no specialized converter code available. */
 }
@@ -856,78 +1327,755 @@ SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
 }
 
 
-static SDL_AudioFilter
-SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                         int src_rate, int dst_rate)
-{
-    /*
-     * Fill in any future conversions that are specialized to a
-     *  processor, platform, compiler, or library here.
-     */
+/*
+ * Fused converters that change the sample type and go between mono and
+ *  stereo in the same pass over the buffer.  The samples come out the same
+ *  as running the type converter and then SDL_ConvertStereo() or
+ *  SDL_ConvertMono() in the destination format.
+ */
 
-    return NULL;                /* no specialized converter code available. */
+#define DIVBY127 0.0078740157480315f
+
+#define CVT_U8_TO_S16(x)    ((Sint16) (((Sint16) ((x) ^ 0x80)) << 8))
+#define CVT_U8_TO_S32(x)    (((Sint32) ((x) ^ 0x80)) << 24)
+#define CVT_U8_TO_F32(x)    ((((float) (x)) * DIVBY127) - 1.0f)
+#define CVT_S8_TO_S16(x)    ((Sint16) (((Sint16) (x)) << 8))
+#define CVT_S8_TO_S32(x)    (((Sint32) (x)) << 24)
+#define CVT_S8_TO_F32(x)    (((float) (x)) * DIVBY127)
+#define CVT_S16_TO_S32(x)   (((Sint32) (x)) << 16)
+#define CVT_S16_TO_F32(x)   (((float) (x)) * DIVBY32767)
+#define CVT_S32_TO_S16(x)   ((Sint16) ((x) >> 16))
+#define CVT_S32_TO_F32(x)   (((float) (x)) * DIVBY2147483647)
+#define CVT_F32_TO_S16(x)   SDL_FloatToS16(x)
+#define CVT_F32_TO_S32(x)   ((Sint32) ((x) * 2147483647.0))
+
+/* The same rounding as SDL_ConvertMono() */
+#define MIX_S16(a, b)   ((Sint16) ((((Sint32) (a)) + (b)) / 2))
+#define MIX_S32(a, b)   ((Sint32) ((((Sint64) (a)) + (b)) / 2))
+#define MIX_F32(a, b)   ((float) ((((double) (a)) + ((double) (b))) * 0.5))
+
+#define FUSED_FILTERS(name, srctype, dsttype, dst_fmt, convert, mix) \
+static void SDLCALL \
+SDL_Filter_##name##_Stereo(SDL_AudioCVT * cvt, SDL_AudioFormat format) \
+{ \
+    const int num = cvt->len_cvt / sizeof (srctype); \
+    const srctype *src = ((const srctype *) cvt->buf) + num; \
+    dsttype *dst = ((dsttype *) cvt->buf) + num * 2; \
+    int i; \
+    /* This always grows the data, so work from the end */ \
+    for (i = num; i; --i) { \
+        const dsttype val = convert(*--src); \
+        dst -= 2; \
+        dst[0] = dst[1] = val; \
+    } \
+    cvt->len_cvt = num * 2 * sizeof (dsttype); \
+    if (cvt->filters[++cvt->filter_index]) { \
+        cvt->filters[cvt->filter_index] (cvt, dst_fmt); \
+    } \
+} \
+static void SDLCALL \
+SDL_Filter_##name##_Mono(SDL_AudioCVT * cvt, SDL_AudioFormat format) \
+{ \
+    const int num = cvt->len_cvt / (sizeof (srctype) * 2); \
+    const srctype *src = (const srctype *) cvt->buf; \
+    dsttype *dst = (dsttype *) cvt->buf; \
+    int i; \
+    if (sizeof (dsttype) > sizeof (srctype) * 2) { \
+        for (i = num - 1; i >= 0; --i) { \
+            dst[i] = mix(convert(src[i * 2]), convert(src[i * 2 + 1])); \
+        } \
+    } else { \
+        for (i = 0; i < num; ++i) { \
+            dst[i] = mix(convert(src[i * 2]), convert(src[i * 2 + 1])); \
+        } \
+    } \
+    cvt->len_cvt = num * sizeof (dsttype); \
+    if (cvt->filters[++cvt->filter_index]) { \
+        cvt->filters[cvt->filter_index] (cvt, dst_fmt); \
+    } \
 }
 
-static int
-SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
+FUSED_FILTERS(U8_to_S16, Uint8, Sint16, AUDIO_S16SYS, CVT_U8_TO_S16, MIX_S16)
+FUSED_FILTERS(U8_to_S32, Uint8, Sint32, AUDIO_S32SYS, CVT_U8_TO_S32, MIX_S32)
+FUSED_FILTERS(U8_to_F32, Uint8, float, AUDIO_F32SYS, CVT_U8_TO_F32, MIX_F32)
+FUSED_FILTERS(S8_to_S16, Sint8, Sint16, AUDIO_S16SYS, CVT_S8_TO_S16, MIX_S16)
+FUSED_FILTERS(S8_to_S32, Sint8, Sint32, AUDIO_S32SYS, CVT_S8_TO_S32, MIX_S32)
+FUSED_FILTERS(S8_to_F32, Sint8, float, AUDIO_F32SYS, CVT_S8_TO_F32, MIX_F32)
+FUSED_FILTERS(S16_to_S32, Sint16, Sint32, AUDIO_S32SYS, CVT_S16_TO_S32, MIX_S32)
+FUSED_FILTERS(S16_to_F32, Sint16, float, AUDIO_F32SYS, CVT_S16_TO_F32, MIX_F32)
+FUSED_FILTERS(S32_to_S16, Sint32, Sint16, AUDIO_S16SYS, CVT_S32_TO_S16, MIX_S16)
+FUSED_FILTERS(S32_to_F32, Sint32, float, AUDIO_F32SYS, CVT_S32_TO_F32, MIX_F32)
+FUSED_FILTERS(F32_to_S16, float, Sint16, AUDIO_S16SYS, CVT_F32_TO_S16, MIX_S16)
+FUSED_FILTERS(F32_to_S32, float, Sint32, AUDIO_S32SYS, CVT_F32_TO_S32, MIX_S32)
+
+#undef FUSED_FILTERS
+
+static const struct
 {
-    int retval = 0;
-
-    /* If we only built with the arbitrary resamplers, ignore multiples. */
-#if !LESS_RESAMPLERS
-    int lo, hi;
-    int div;
+    SDL_AudioFormat src_fmt;
+    SDL_AudioFormat dst_fmt;
+    SDL_AudioFilter stereo;     /* replaces the type filter + SDL_ConvertStereo */
+    SDL_AudioFilter mono;       /* replaces the type filter + SDL_ConvertMono */
+} sdl_fused_type_filters[] = {
+#define FUSED_TYPE_FILTER(src, dst, name) \
+    { src, dst, SDL_Filter_##name##_Stereo, SDL_Filter_##name##_Mono },
+    FUSED_TYPE_FILTER(AUDIO_U8, AUDIO_S16SYS, U8_to_S16)
+    FUSED_TYPE_FILTER(AUDIO_U8, AUDIO_S32SYS, U8_to_S32)
+    FUSED_TYPE_FILTER(AUDIO_U8, AUDIO_F32SYS, U8_to_F32)
+    FUSED_TYPE_FILTER(AUDIO_S8, AUDIO_S16SYS, S8_to_S16)
+    FUSED_TYPE_FILTER(AUDIO_S8, AUDIO_S32SYS, S8_to_S32)
+    FUSED_TYPE_FILTER(AUDIO_S8, AUDIO_F32SYS, S8_to_F32)
+    FUSED_TYPE_FILTER(AUDIO_S16SYS, AUDIO_S32SYS, S16_to_S32)
+    FUSED_TYPE_FILTER(AUDIO_S16SYS, AUDIO_F32SYS, S16_to_F32)
+    FUSED_TYPE_FILTER(AUDIO_S32SYS, AUDIO_S16SYS, S32_to_S16)
+    FUSED_TYPE_FILTER(AUDIO_S32SYS, AUDIO_F32SYS, S32_to_F32)
+    FUSED_TYPE_FILTER(AUDIO_F32SYS, AUDIO_S16SYS, F32_to_S16)
+    FUSED_TYPE_FILTER(AUDIO_F32SYS, AUDIO_S32SYS, F32_to_S32)
+#undef FUSED_TYPE_FILTER
+    { 0, 0, NULL, NULL }
+};
+
+/* If (cvt) starts with a type conversion followed by a mono/stereo
+   conversion, replace the pair with a fused converter. */
+static void
+SDL_FuseAudioTypeCVT(SDL_AudioCVT * cvt,
+                     SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
+{
+    SDL_AudioFilter fused = NULL;
+    int i;
 
-    SDL_assert(src_rate != 0);
-    SDL_assert(dst_rate != 0);
-    SDL_assert(src_rate != dst_rate);
+    if (src_fmt == dst_fmt || cvt->filter_index < 2) {
+        return;
+    }
+    /* The vectorized float converters plus a separate channel pass still
+       beat the scalar float to integer conversion */
+    if (SDL_AUDIO_ISFLOAT(src_fmt) &&
+        SDL_HandTunedTypeCVT(src_fmt, dst_fmt) != NULL) {
+        return;
+    }
+    for (i = 0; sdl_fused_type_filters[i].src_fmt != 0; i++) {
+        if ((sdl_fused_type_filters[i].src_fmt == src_fmt) &&
+            (sdl_fused_type_filters[i].dst_fmt == dst_fmt)) {
+            if (cvt->filters[1] == SDL_ConvertStereo) {
+                fused = sdl_fused_type_filters[i].stereo;
+            } else if (cvt->filters[1] == SDL_ConvertMono) {
+                fused = sdl_fused_type_filters[i].mono;
+            }
+            break;
+        }
+    }
+    if (fused == NULL) {
+        return;
+    }
 
-    if (src_rate < dst_rate) {
-        lo = src_rate;
-        hi = dst_rate;
-    } else {
-        lo = dst_rate;
-        hi = src_rate;
+    /* The buffer size multipliers stay the same, it's still both steps */
+    cvt->filters[0] = fused;
+    for (i = 1; i < cvt->filter_index - 1; i++) {
+        cvt->filters[i] = cvt->filters[i + 1];
     }
+    --cvt->filter_index;
+}
 
-    /* zero means "not a supported multiple" ... we only do 2x and 4x. */
-    if ((hi % lo) != 0)
-        return 0;               /* not a multiple. */
 
-    div = hi / lo;
-    retval = ((div == 2) || (div == 4)) ? div : 0;
-#endif
+/*
+ * Band-limited polyphase resampler.
+ *
+ * Each output frame is a Kaiser windowed sinc interpolation of the input
+ *  around the output frame's position in the source.  The filter is
+ *  precomputed for a fixed number of fractional positions ("phases") and
+ *  linearly interpolated between neighbouring phases, so any rate ratio
+ *  works, not just the multiples the generated resamplers special-case.
+ *  A table only depends on the rate ratio and the quality, so converters
+ *  share them; they live until the audio subsystem shuts down.
+ */
 
-    return retval;
+typedef enum
+{
+    SDL_RESAMPLER_FAST,         /* generated resamplers, no filtering */
+    SDL_RESAMPLER_MEDIUM,
+    SDL_RESAMPLER_BEST
+} SDL_ResamplerQuality;
+
+typedef struct
+{
+    int zero_crossings;         /* sinc lobes on each side of the center */
+    int phase_bits;             /* log2 of the number of phases */
+    double rolloff;             /* cutoff, as a fraction of the lower Nyquist */
+    double beta;                /* Kaiser window shape */
+} SDL_ResamplerParams;
+
+static const SDL_ResamplerParams resampler_params[] = {
+    { 0, 0, 0.0, 0.0 },
+    { 8, 7, 0.90, 6.0 },
+    { 24, 9, 0.95, 9.0 },
+};
+
+#define SDL_RESAMPLER_MAX_TAPS  1024
+
+typedef struct SDL_ResampleFilter
+{
+    double rate_incr;
+    SDL_ResamplerQuality quality;
+    int half_taps;              /* taps on either side of the position */
+    int taps;                   /* row length, a multiple of 4 */
+    int phase_bits;
+    float *table;               /* (1 << phase_bits) + 1 rows of taps */
+    int refcount;               /* audio streams using the table */
+    struct SDL_ResampleFilter *next;
+} SDL_ResampleFilter;
+
+static SDL_ResampleFilter *resample_filters = NULL;
+static SDL_SpinLock resample_filters_lock = 0;
+
+/* Modified Bessel function of the first kind, order zero */
+static double
+SDL_BesselI0(double x)
+{
+    const double halfx = x * 0.5;
+    double sum = 1.0;
+    double term = 1.0;
+    int k;
+
+    for (k = 1; k < 64; ++k) {
+        term *= halfx / k;
+        sum += term * term;
+        if (term * term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
 }
 
-static int
-SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                          int src_rate, int dst_rate)
+static SDL_ResampleFilter *
+SDL_CreateResampleFilter(double rate_incr, SDL_ResamplerQuality quality)
 {
-    if (src_rate != dst_rate) {
-        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
-                                                          src_rate, dst_rate);
+    const SDL_ResamplerParams *params = &resampler_params[quality];
+    /* When downsampling, the cutoff has to move down to the new Nyquist */
+    const double scale = (rate_incr < 1.0) ? rate_incr : 1.0;
+    const double cutoff = 0.5 * scale * params->rolloff;
+    const double window_scale = 1.0 / SDL_BesselI0(params->beta);
+    const int phases = (1 << params->phase_bits);
+    SDL_ResampleFilter *filter;
+    int half_taps;
+    int p, k;
+
+    half_taps = (int) SDL_ceil(params->zero_crossings / scale);
+    if (half_taps > SDL_RESAMPLER_MAX_TAPS / 2) {
+        half_taps = SDL_RESAMPLER_MAX_TAPS / 2;
+    }
 
-        /* No hand-tuned converter? Try the autogenerated ones. */
-        if (filter == NULL) {
-            int i;
-            const int upsample = (src_rate < dst_rate) ? 1 : 0;
-            const int multiple =
-                SDL_FindFrequencyMultiple(src_rate, dst_rate);
+    filter = (SDL_ResampleFilter *) SDL_malloc(sizeof(*filter));
+    if (filter == NULL) {
+        return NULL;
+    }
+    filter->rate_incr = rate_incr;
+    filter->quality = quality;
+    filter->half_taps = half_taps;
+    filter->taps = (2 * half_taps + 3) & ~3;
+    filter->phase_bits = params->phase_bits;
+    filter->refcount = 0;
+    filter->next = NULL;
+    filter->table = (float *) SDL_malloc((phases + 1) * filter->taps *
+                                         sizeof(float));
+    if (filter->table == NULL) {
+        SDL_free(filter);
+        return NULL;
+    }
 
-            for (i = 0; sdl_audio_rate_filters[i].filter != NULL; i++) {
-                const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
-                if ((filt->fmt == cvt->dst_format) &&
-                    (filt->channels == dst_channels) &&
-                    (filt->upsample == upsample) &&
-                    (filt->multiple == multiple)) {
-                    filter = filt->filter;
-                    break;
+    for (p = 0; p <= phases; ++p) {
+        float *row = &filter->table[p * filter->taps];
+        const double frac = ((double) p) / phases;
+        double sum = 0.0;
+
+        /* Tap k covers the input frame (k - half_taps + 1) from the
+           integer part of the position. */
+        for (k = 0; k < filter->taps; ++k) {
+            const double x = (k - half_taps + 1) - frac;
+            double h = 0.0;
+
+            if ((k < 2 * half_taps) && (SDL_fabs(x) < half_taps)) {
+                const double w = x / half_taps;
+                if (x == 0.0) {
+                    h = 2.0 * cutoff;
+                } else {
+                    h = SDL_sin(2.0 * M_PI * cutoff * x) / (M_PI * x);
                 }
+                h *= SDL_BesselI0(params->beta * SDL_sqrt(1.0 - w * w)) *
+                    window_scale;
             }
+            row[k] = (float) h;
+            sum += h;
+        }
 
-            if (filter == NULL) {
+        /* Unity gain at DC for every phase */
+        for (k = 0; k < filter->taps; ++k) {
+            row[k] = (float) (row[k] / sum);
+        }
+    }
+
+    return filter;
+}
+
+static SDL_ResampleFilter *
+SDL_GetResampleFilter(double rate_incr, SDL_ResamplerQuality quality)
+{
+    SDL_ResampleFilter *filter;
+    SDL_ResampleFilter *created;
+
+    SDL_AtomicLock(&resample_filters_lock);
+    for (filter = resample_filters; filter; filter = filter->next) {
+        if ((filter->rate_incr == rate_incr) && (filter->quality == quality)) {
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&resample_filters_lock);
+    if (filter) {
+        return filter;
+    }
+
+    /* Build the table without holding the lock, it can take a while */
+    created = SDL_CreateResampleFilter(rate_incr, quality);
+    if (created == NULL) {
+        return NULL;
+    }
+
+    SDL_AtomicLock(&resample_filters_lock);
+    for (filter = resample_filters; filter; filter = filter->next) {
+        if ((filter->rate_incr == rate_incr) && (filter->quality == quality)) {
+            break;
+        }
+    }
+    if (filter == NULL) {
+        created->next = resample_filters;
+        resample_filters = created;
+        filter = created;
+        created = NULL;
+    }
+    SDL_AtomicUnlock(&resample_filters_lock);
+
+    if (created) {
+        /* Somebody else built the same table first */
+        SDL_free(created->table);
+        SDL_free(created);
+    }
+    return filter;
+}
+
+/* Audio streams hold on to their table, so it outlives SDL_AudioQuit() */
+static SDL_ResampleFilter *
+SDL_AcquireResampleFilter(double rate_incr, SDL_ResamplerQuality quality)
+{
+    SDL_ResampleFilter *filter = SDL_GetResampleFilter(rate_incr, quality);
+
+    if (filter) {
+        SDL_AtomicLock(&resample_filters_lock);
+        ++filter->refcount;
+        SDL_AtomicUnlock(&resample_filters_lock);
+    }
+    return filter;
+}
+
+static void
+SDL_ReleaseResampleFilter(SDL_ResampleFilter * filter)
+{
+    SDL_AtomicLock(&resample_filters_lock);
+    --filter->refcount;
+    SDL_AtomicUnlock(&resample_filters_lock);
+}
+
+void
+SDL_FreeResampleFilters(void)
+{
+    SDL_ResampleFilter *filter;
+    SDL_ResampleFilter **prev;
+    SDL_ResampleFilter *unused = NULL;
+
+    SDL_AtomicLock(&resample_filters_lock);
+    prev = &resample_filters;
+    while ((filter = *prev) != NULL) {
+        if (filter->refcount == 0) {
+            *prev = filter->next;
+            filter->next = unused;
+            unused = filter;
+        } else {
+            prev = &filter->next;
+        }
+    }
+    SDL_AtomicUnlock(&resample_filters_lock);
+
+    while (unused) {
+        SDL_ResampleFilter *next = unused->next;
+        SDL_free(unused->table);
+        SDL_free(unused);
+        unused = next;
+    }
+}
+
+static void
+SDL_ResampleInterpolate_Scalar(float *coefs, const float *row, float t,
+                               int taps)
+{
+    const float *next = row + taps;
+    int k;
+
+    for (k = 0; k < taps; ++k) {
+        coefs[k] = row[k] + t * (next[k] - row[k]);
+    }
+}
+
+static float
+SDL_ResampleDot_Scalar(const float *x, const float *coefs, int taps)
+{
+    float sum = 0.0f;
+    int k;
+
+    for (k = 0; k < taps; ++k) {
+        sum += x[k] * coefs[k];
+    }
+    return sum;
+}
+
+#ifdef __SSE2__
+static void
+SDL_ResampleInterpolate_SSE2(float *coefs, const float *row, float t,
+                             int taps)
+{
+    const float *next = row + taps;
+    const __m128 vt = _mm_set1_ps(t);
+    int k;
+
+    for (k = 0; k < taps; k += 4) {
+        const __m128 a = _mm_loadu_ps(&row[k]);
+        const __m128 b = _mm_loadu_ps(&next[k]);
+        _mm_storeu_ps(&coefs[k],
+                      _mm_add_ps(a, _mm_mul_ps(vt, _mm_sub_ps(b, a))));
+    }
+}
+
+static float
+SDL_ResampleDot_SSE2(const float *x, const float *coefs, int taps)
+{
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    float result[4];
+    int k;
+
+    /* Two accumulators to hide the latency of the adds */
+    for (k = 0; k + 8 <= taps; k += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(&x[k]),
+                                           _mm_loadu_ps(&coefs[k])));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(&x[k + 4]),
+                                           _mm_loadu_ps(&coefs[k + 4])));
+    }
+    if (k < taps) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(&x[k]),
+                                           _mm_loadu_ps(&coefs[k])));
+    }
+    sum0 = _mm_add_ps(sum0, sum1);
+    _mm_storeu_ps(result, sum0);
+    return (result[0] + result[1]) + (result[2] + result[3]);
+}
+#endif /* __SSE2__ */
+
+/* Generate 'frames' output frames starting at the fixed point (32.32)
+   input position 'pos'.  'planar' holds one run of 'stride' floats per
+   channel, and has to cover every tap around the positions used. */
+static void
+SDL_ResampleBlock(const SDL_ResampleFilter * filter, const float *planar,
+                  int stride, int channels, SDL_AudioFormat format,
+                  void *output, int frames, Uint64 pos, Uint64 step)
+{
+    void (*interpolate) (float *, const float *, float, int) =
+        SDL_ResampleInterpolate_Scalar;
+    float (*dot) (const float *, const float *, int) = SDL_ResampleDot_Scalar;
+    const int taps = filter->taps;
+    const int phase_shift = 32 - filter->phase_bits;
+    const Uint32 phase_mask = (1u << phase_shift) - 1;
+    const float phase_scale = 1.0f / (float) (1u << phase_shift);
+    float coefs[SDL_RESAMPLER_MAX_TAPS];
+    int i, c;
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        interpolate = SDL_ResampleInterpolate_SSE2;
+        dot = SDL_ResampleDot_SSE2;
+    }
+#endif
+
+    for (i = 0; i < frames; ++i, pos += step) {
+        const int index = (int) (pos >> 32);
+        const Uint32 frac = (Uint32) pos;
+        const float *x = planar + index - filter->half_taps + 1;
+
+        interpolate(coefs, &filter->table[(frac >> phase_shift) * taps],
+                    (float) (frac & phase_mask) * phase_scale, taps);
+
+        if (format == AUDIO_S16SYS) {
+            Sint16 *dst = ((Sint16 *) output) + i * channels;
+            for (c = 0; c < channels; ++c, x += stride) {
+                const float sample = dot(x, coefs, taps);
+                if (sample >= 32767.0f) {
+                    dst[c] = 32767;
+                } else if (sample <= -32768.0f) {
+                    dst[c] = -32768;
+                } else {
+                    dst[c] = (Sint16) (sample + ((sample < 0.0f) ? -0.5f : 0.5f));
+                }
+            }
+        } else {
+            float *dst = ((float *) output) + i * channels;
+            for (c = 0; c < channels; ++c, x += stride) {
+                dst[c] = dot(x, coefs, taps);
+            }
+        }
+    }
+}
+
+/* Copy interleaved frames into planar float runs of 'stride' floats */
+static void
+SDL_DeinterleaveFrames(float *planar, int stride, const void *input,
+                       SDL_AudioFormat format, int channels, int frames)
+{
+    int i, c;
+
+    for (c = 0; c < channels; ++c) {
+        float *x = planar + c * stride;
+        if (format == AUDIO_S16SYS) {
+            const Sint16 *src = ((const Sint16 *) input) + c;
+            for (i = 0; i < frames; ++i, src += channels) {
+                x[i] = (float) *src;
+            }
+        } else {
+            const float *src = ((const float *) input) + c;
+            for (i = 0; i < frames; ++i, src += channels) {
+                x[i] = *src;
+            }
+        }
+    }
+}
+
+static void
+SDL_Resample(SDL_AudioCVT * cvt, SDL_AudioFormat format, int channels,
+             SDL_ResamplerQuality quality)
+{
+    const int framesize = (SDL_AUDIO_BITSIZE(format) / 8) * channels;
+    const int srcframes = cvt->len_cvt / framesize;
+    const int dstframes = (int) (((double) srcframes) * cvt->rate_incr);
+    const Uint64 step = (Uint64) (4294967296.0 / cvt->rate_incr + 0.5);
+    SDL_ResampleFilter *filter;
+    float *planar = NULL;
+    int taps, stride;
+    int i, c;
+
+#ifdef DEBUG_CONVERT
+    fprintf(stderr, "Resample polyphase (x%f) %d channels, quality %d.\n",
+            cvt->rate_incr, channels, (int) quality);
+#endif
+
+    filter = SDL_GetResampleFilter(cvt->rate_incr, quality);
+    if (filter == NULL || srcframes == 0) {
+        goto done;
+    }
+    taps = filter->taps;
+
+    /* The output overwrites the input, so work from a planar float copy
+       padded with the edge frames on both sides. */
+    stride = srcframes + 2 * taps + 4;
+    planar = (float *) SDL_malloc(stride * channels * sizeof(float));
+    if (planar == NULL) {
+        SDL_OutOfMemory();
+        goto done;
+    }
+    SDL_DeinterleaveFrames(planar + taps, stride, cvt->buf, format,
+                           channels, srcframes);
+    for (c = 0; c < channels; ++c) {
+        float *x = planar + c * stride + taps;
+        for (i = 1; i <= taps; ++i) {
+            x[-i] = x[0];
+        }
+        for (i = srcframes; i < stride - taps; ++i) {
+            x[i] = x[srcframes - 1];
+        }
+    }
+
+    SDL_ResampleBlock(filter, planar + taps, stride, channels, format,
+                      cvt->buf, dstframes, 0, step);
+
+  done:
+    if (planar == NULL && dstframes > 0) {
+        /* Couldn't resample, at least don't play garbage */
+        SDL_memset(cvt->buf, '\0', dstframes * framesize);
+    }
+    SDL_free(planar);
+
+    cvt->len_cvt = dstframes * framesize;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+#define RESAMPLE_FILTER(fmt, chans, qual) \
+static void SDLCALL \
+SDL_Resample_##fmt##_##chans##c_##qual(SDL_AudioCVT * cvt, SDL_AudioFormat format) \
+{ \
+    SDL_Resample(cvt, AUDIO_##fmt, chans, SDL_RESAMPLER_##qual); \
+}
+
+RESAMPLE_FILTER(S16SYS, 1, MEDIUM)
+RESAMPLE_FILTER(S16SYS, 2, MEDIUM)
+RESAMPLE_FILTER(S16SYS, 4, MEDIUM)
+RESAMPLE_FILTER(S16SYS, 6, MEDIUM)
+RESAMPLE_FILTER(S16SYS, 8, MEDIUM)
+RESAMPLE_FILTER(F32SYS, 1, MEDIUM)
+RESAMPLE_FILTER(F32SYS, 2, MEDIUM)
+RESAMPLE_FILTER(F32SYS, 4, MEDIUM)
+RESAMPLE_FILTER(F32SYS, 6, MEDIUM)
+RESAMPLE_FILTER(F32SYS, 8, MEDIUM)
+RESAMPLE_FILTER(S16SYS, 1, BEST)
+RESAMPLE_FILTER(S16SYS, 2, BEST)
+RESAMPLE_FILTER(S16SYS, 4, BEST)
+RESAMPLE_FILTER(S16SYS, 6, BEST)
+RESAMPLE_FILTER(S16SYS, 8, BEST)
+RESAMPLE_FILTER(F32SYS, 1, BEST)
+RESAMPLE_FILTER(F32SYS, 2, BEST)
+RESAMPLE_FILTER(F32SYS, 4, BEST)
+RESAMPLE_FILTER(F32SYS, 6, BEST)
+RESAMPLE_FILTER(F32SYS, 8, BEST)
+
+#undef RESAMPLE_FILTER
+
+static const struct
+{
+    SDL_AudioFormat fmt;
+    int channels;
+    SDL_ResamplerQuality quality;
+    SDL_AudioFilter filter;
+} sdl_resample_filters[] = {
+    { AUDIO_S16SYS, 1, SDL_RESAMPLER_MEDIUM, SDL_Resample_S16SYS_1c_MEDIUM },
+    { AUDIO_S16SYS, 2, SDL_RESAMPLER_MEDIUM, SDL_Resample_S16SYS_2c_MEDIUM },
+    { AUDIO_S16SYS, 4, SDL_RESAMPLER_MEDIUM, SDL_Resample_S16SYS_4c_MEDIUM },
+    { AUDIO_S16SYS, 6, SDL_RESAMPLER_MEDIUM, SDL_Resample_S16SYS_6c_MEDIUM },
+    { AUDIO_S16SYS, 8, SDL_RESAMPLER_MEDIUM, SDL_Resample_S16SYS_8c_MEDIUM },
+    { AUDIO_F32SYS, 1, SDL_RESAMPLER_MEDIUM, SDL_Resample_F32SYS_1c_MEDIUM },
+    { AUDIO_F32SYS, 2, SDL_RESAMPLER_MEDIUM, SDL_Resample_F32SYS_2c_MEDIUM },
+    { AUDIO_F32SYS, 4, SDL_RESAMPLER_MEDIUM, SDL_Resample_F32SYS_4c_MEDIUM },
+    { AUDIO_F32SYS, 6, SDL_RESAMPLER_MEDIUM, SDL_Resample_F32SYS_6c_MEDIUM },
+    { AUDIO_F32SYS, 8, SDL_RESAMPLER_MEDIUM, SDL_Resample_F32SYS_8c_MEDIUM },
+    { AUDIO_S16SYS, 1, SDL_RESAMPLER_BEST, SDL_Resample_S16SYS_1c_BEST },
+    { AUDIO_S16SYS, 2, SDL_RESAMPLER_BEST, SDL_Resample_S16SYS_2c_BEST },
+    { AUDIO_S16SYS, 4, SDL_RESAMPLER_BEST, SDL_Resample_S16SYS_4c_BEST },
+    { AUDIO_S16SYS, 6, SDL_RESAMPLER_BEST, SDL_Resample_S16SYS_6c_BEST },
+    { AUDIO_S16SYS, 8, SDL_RESAMPLER_BEST, SDL_Resample_S16SYS_8c_BEST },
+    { AUDIO_F32SYS, 1, SDL_RESAMPLER_BEST, SDL_Resample_F32SYS_1c_BEST },
+    { AUDIO_F32SYS, 2, SDL_RESAMPLER_BEST, SDL_Resample_F32SYS_2c_BEST },
+    { AUDIO_F32SYS, 4, SDL_RESAMPLER_BEST, SDL_Resample_F32SYS_4c_BEST },
+    { AUDIO_F32SYS, 6, SDL_RESAMPLER_BEST, SDL_Resample_F32SYS_6c_BEST },
+    { AUDIO_F32SYS, 8, SDL_RESAMPLER_BEST, SDL_Resample_F32SYS_8c_BEST },
+    { 0, 0, SDL_RESAMPLER_FAST, NULL }
+};
+
+static SDL_ResamplerQuality
+SDL_GetResamplerQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLING_MODE);
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "fast") == 0 || SDL_strcmp(hint, "0") == 0) {
+            return SDL_RESAMPLER_FAST;
+        }
+        if (SDL_strcasecmp(hint, "best") == 0 || SDL_strcmp(hint, "2") == 0) {
+            return SDL_RESAMPLER_BEST;
+        }
+    }
+    return SDL_RESAMPLER_MEDIUM;
+}
+
+static SDL_AudioFilter
+SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
+                         SDL_ResamplerQuality quality)
+{
+    int i;
+
+    if (quality == SDL_RESAMPLER_FAST) {
+        return NULL;            /* use the generated resamplers. */
+    }
+
+    for (i = 0; sdl_resample_filters[i].filter != NULL; i++) {
+        if ((sdl_resample_filters[i].fmt == cvt->dst_format) &&
+            (sdl_resample_filters[i].channels == dst_channels) &&
+            (sdl_resample_filters[i].quality == quality)) {
+            /* Build the table now rather than in the audio callback */
+            if (SDL_GetResampleFilter(cvt->rate_incr, quality) == NULL) {
+                return NULL;
+            }
+            return sdl_resample_filters[i].filter;
+        }
+    }
+
+    return NULL;                /* no specialized converter code available. */
+}
+
+static int
+SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
+{
+    int retval = 0;
+
+    /* If we only built with the arbitrary resamplers, ignore multiples. */
+#if !LESS_RESAMPLERS
+    int lo, hi;
+    int div;
+
+    SDL_assert(src_rate != 0);
+    SDL_assert(dst_rate != 0);
+    SDL_assert(src_rate != dst_rate);
+
+    if (src_rate < dst_rate) {
+        lo = src_rate;
+        hi = dst_rate;
+    } else {
+        lo = dst_rate;
+        hi = src_rate;
+    }
+
+    /* zero means "not a supported multiple" ... we only do 2x and 4x. */
+    if ((hi % lo) != 0)
+        return 0;               /* not a multiple. */
+
+    div = hi / lo;
+    retval = ((div == 2) || (div == 4)) ? div : 0;
+#endif
+
+    return retval;
+}
+
+static int
+SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
+                          int src_rate, int dst_rate,
+                          SDL_ResamplerQuality quality)
+{
+    if (src_rate != dst_rate) {
+        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
+                                                          quality);
+
+        /* No hand-tuned converter? Try the autogenerated ones. */
+        if (filter == NULL) {
+            int i;
+            const int upsample = (src_rate < dst_rate) ? 1 : 0;
+            const int multiple =
+                SDL_FindFrequencyMultiple(src_rate, dst_rate);
+
+            for (i = 0; sdl_audio_rate_filters[i].filter != NULL; i++) {
+                const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
+                if ((filt->fmt == cvt->dst_format) &&
+                    (filt->channels == dst_channels) &&
+                    (filt->upsample == upsample) &&
+                    (filt->multiple == multiple)) {
+                    filter = filt->filter;
+                    break;
+                }
+            }
+
+            if (filter == NULL) {
                 SDL_SetError("No conversion available for these rates");
                 return -1;
             }
@@ -950,15 +2098,14 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
 }
 
 
-/* Creates a set of audio filters to convert from one format to another.
-   Returns -1 if the format conversion is not supported, 0 if there's
-   no conversion needed, or 1 if the audio filter is set up.
-*/
-
-int
-SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
-                  SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
-                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
+/* Fill in (cvt) with the filters for a conversion, after the arguments
+   have been checked.  Returns -1 if the conversion isn't supported. */
+static int
+SDL_BuildAudioCVTFilters(SDL_AudioCVT * cvt,
+                         SDL_AudioFormat src_fmt, Uint8 src_channels,
+                         int src_rate, SDL_AudioFormat dst_fmt,
+                         Uint8 dst_channels, int dst_rate,
+                         SDL_ResamplerQuality quality)
 {
     /*
      * !!! FIXME: reorder filters based on which grow/shrink the buffer.
@@ -968,21 +2115,6 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
      * !!! FIXME: good in practice as it sounds in theory, though.
      */
 
-    /* there are no unsigned types over 16 bits, so catch this up front. */
-    if ((SDL_AUDIO_BITSIZE(src_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(src_fmt))) {
-        SDL_SetError("Invalid source format");
-        return -1;
-    }
-    if ((SDL_AUDIO_BITSIZE(dst_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(dst_fmt))) {
-        SDL_SetError("Invalid destination format");
-        return -1;
-    }
-
-    /* prevent possible divisions by zero, etc. */
-    if ((src_rate == 0) || (dst_rate == 0)) {
-        SDL_SetError("Source or destination rate is zero");
-        return -1;
-    }
 #ifdef DEBUG_CONVERT
     printf("Build format %04x->%04x, channels %u->%u, rate %d->%d\n",
            src_fmt, dst_fmt, src_channels, dst_channels, src_rate, dst_rate);
@@ -1055,9 +2187,13 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
     }
 
+    /* Save a pass over the buffer where the type converter can do the
+       first channel conversion too. */
+    SDL_FuseAudioTypeCVT(cvt, src_fmt, dst_fmt);
+
     /* Do rate conversion, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) ==
-        -1) {
+    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate,
+                                  quality) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
@@ -1074,4 +2210,665 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
 }
 
 
+/*
+ * Built conversion plans.
+ *
+ * Applications tend to build converters for the same few formats over and
+ *  over, one for every sound they load, so finished filter chains are kept
+ *  and copied out instead of being looked up in the filter tables again.
+ *  They only hold pointers to code, so they're cheap to keep until the
+ *  audio subsystem shuts down.
+ */
+
+#define SDL_AUDIOCVT_PLAN_BUCKETS   64
+#define SDL_AUDIOCVT_MAX_PLANS      256
+
+typedef struct SDL_AudioCVTPlan
+{
+    SDL_AudioFormat src_fmt;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_fmt;
+    Uint8 dst_channels;
+    int dst_rate;
+    SDL_ResamplerQuality quality;
+    SDL_AudioCVT cvt;
+    struct SDL_AudioCVTPlan *next;
+} SDL_AudioCVTPlan;
+
+static SDL_AudioCVTPlan *audio_cvt_plans[SDL_AUDIOCVT_PLAN_BUCKETS];
+static int audio_cvt_plan_count = 0;
+static SDL_SpinLock audio_cvt_plans_lock = 0;
+
+static Uint32
+SDL_HashAudioCVTPlan(SDL_AudioFormat src_fmt, Uint8 src_channels,
+                     int src_rate, SDL_AudioFormat dst_fmt,
+                     Uint8 dst_channels, int dst_rate)
+{
+    Uint32 hash = 2166136261u;
+
+    hash = (hash ^ src_fmt) * 16777619u;
+    hash = (hash ^ src_channels) * 16777619u;
+    hash = (hash ^ (Uint32) src_rate) * 16777619u;
+    hash = (hash ^ dst_fmt) * 16777619u;
+    hash = (hash ^ dst_channels) * 16777619u;
+    hash = (hash ^ (Uint32) dst_rate) * 16777619u;
+    return hash % SDL_AUDIOCVT_PLAN_BUCKETS;
+}
+
+void
+SDL_FreeAudioCVTPlans(void)
+{
+    SDL_AudioCVTPlan *unused = NULL;
+    int i;
+
+    SDL_AtomicLock(&audio_cvt_plans_lock);
+    for (i = 0; i < SDL_AUDIOCVT_PLAN_BUCKETS; ++i) {
+        while (audio_cvt_plans[i]) {
+            SDL_AudioCVTPlan *plan = audio_cvt_plans[i];
+            audio_cvt_plans[i] = plan->next;
+            plan->next = unused;
+            unused = plan;
+        }
+    }
+    audio_cvt_plan_count = 0;
+    SDL_AtomicUnlock(&audio_cvt_plans_lock);
+
+    while (unused) {
+        SDL_AudioCVTPlan *next = unused->next;
+        SDL_free(unused);
+        unused = next;
+    }
+}
+
+
+/* Creates a set of audio filters to convert from one format to another.
+   Returns -1 if the format conversion is not supported, 0 if there's
+   no conversion needed, or 1 if the audio filter is set up.
+*/
+
+int
+SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
+                  SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
+                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
+{
+    SDL_ResamplerQuality quality = SDL_RESAMPLER_FAST;
+    SDL_AudioCVTPlan *plan;
+    Uint32 bucket;
+
+    /* there are no unsigned types over 16 bits, so catch this up front. */
+    if ((SDL_AUDIO_BITSIZE(src_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(src_fmt))) {
+        SDL_SetError("Invalid source format");
+        return -1;
+    }
+    if ((SDL_AUDIO_BITSIZE(dst_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(dst_fmt))) {
+        SDL_SetError("Invalid destination format");
+        return -1;
+    }
+
+    /* prevent possible divisions by zero, etc. */
+    if ((src_rate == 0) || (dst_rate == 0)) {
+        SDL_SetError("Source or destination rate is zero");
+        return -1;
+    }
+
+    /* The resampler hint picks the rate converter, so it's in the key */
+    if (src_rate != dst_rate) {
+        quality = SDL_GetResamplerQuality();
+    }
+
+    bucket = SDL_HashAudioCVTPlan(src_fmt, src_channels, src_rate,
+                                  dst_fmt, dst_channels, dst_rate);
+    SDL_AtomicLock(&audio_cvt_plans_lock);
+    for (plan = audio_cvt_plans[bucket]; plan; plan = plan->next) {
+        if ((plan->src_fmt == src_fmt) &&
+            (plan->src_channels == src_channels) &&
+            (plan->src_rate == src_rate) &&
+            (plan->dst_fmt == dst_fmt) &&
+            (plan->dst_channels == dst_channels) &&
+            (plan->dst_rate == dst_rate) && (plan->quality == quality)) {
+            *cvt = plan->cvt;
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&audio_cvt_plans_lock);
+    if (plan) {
+        return (cvt->needed);
+    }
+
+    if (SDL_BuildAudioCVTFilters(cvt, src_fmt, src_channels, src_rate,
+                                 dst_fmt, dst_channels, dst_rate,
+                                 quality) < 0) {
+        return -1;
+    }
+
+    /* Keep it for next time, it's fine to skip this if we're out of memory */
+    plan = (SDL_AudioCVTPlan *) SDL_malloc(sizeof(*plan));
+    if (plan) {
+        plan->src_fmt = src_fmt;
+        plan->src_channels = src_channels;
+        plan->src_rate = src_rate;
+        plan->dst_fmt = dst_fmt;
+        plan->dst_channels = dst_channels;
+        plan->dst_rate = dst_rate;
+        plan->quality = quality;
+        plan->cvt = *cvt;
+
+        SDL_AtomicLock(&audio_cvt_plans_lock);
+        if (audio_cvt_plan_count < SDL_AUDIOCVT_MAX_PLANS) {
+            plan->next = audio_cvt_plans[bucket];
+            audio_cvt_plans[bucket] = plan;
+            ++audio_cvt_plan_count;
+            plan = NULL;
+        }
+        SDL_AtomicUnlock(&audio_cvt_plans_lock);
+        if (plan) {
+            SDL_free(plan);
+        }
+    }
+    return (cvt->needed);
+}
+
+
+/*
+ * Streaming conversion.
+ *
+ * Source audio is converted to the destination channel layout in chunks,
+ *  resampled with the polyphase filter while keeping the filter history
+ *  between calls, converted to the destination format and queued in a
+ *  ring buffer until it's read.
+ */
+
+/* Source frames converted per pass */
+#define SDL_AUDIOSTREAM_CHUNK   4096
+
+struct _SDL_AudioStream
+{
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+    int src_framesize;
+    int dst_framesize;
+
+    /* A partial source frame left over from the last put */
+    Uint8 *staging;
+    int staging_len;
+
+    /* Source format to the resampler's input, or to the destination */
+    SDL_AudioCVT cvt_before;
+    Uint8 *work;
+
+    /* Resampler state, the history is planar with 'history_stride'
+       floats per channel */
+    SDL_ResampleFilter *filter;
+    SDL_AudioFormat resample_format;
+    float *history;
+    int history_stride;
+    int history_frames;
+    Uint64 pos;
+    Uint64 step;
+    Uint64 frames_in;
+    Uint64 frames_out;
+
+    /* Resampler output to the destination format */
+    SDL_AudioCVT cvt_after;
+    Uint8 *resampled;
+
+    /* Converted audio waiting to be read, the size is a power of 2 */
+    Uint8 *ring;
+    int ring_size;
+    int ring_head;
+    int ring_len;
+};
+
+static void
+SDL_ResetAudioStreamResampler(SDL_AudioStream * stream)
+{
+    int c;
+
+    if (stream->filter == NULL) {
+        return;
+    }
+
+    /* Start with silence before the first frame, so the first output
+       frame lines up with the first input frame. */
+    stream->history_frames = stream->filter->half_taps - 1;
+    for (c = 0; c < stream->dst_channels; ++c) {
+        SDL_memset(stream->history + c * stream->history_stride, '\0',
+                   stream->history_frames * sizeof(float));
+    }
+    stream->pos = ((Uint64) stream->history_frames) << 32;
+    stream->frames_in = 0;
+    stream->frames_out = 0;
+}
+
+static int
+SDL_ReserveAudioStreamHistory(SDL_AudioStream * stream, int frames)
+{
+    const int needed = stream->history_frames + frames;
+    float *history;
+    int stride, c;
+
+    if (needed <= stream->history_stride) {
+        return 0;
+    }
+
+    stride = stream->history_stride * 2;
+    while (stride < needed) {
+        stride *= 2;
+    }
+    history = (float *) SDL_malloc(stride * stream->dst_channels *
+                                   sizeof(float));
+    if (history == NULL) {
+        SDL_OutOfMemory();
+        return -1;
+    }
+    for (c = 0; c < stream->dst_channels; ++c) {
+        SDL_memcpy(history + c * stride,
+                   stream->history + c * stream->history_stride,
+                   stream->history_frames * sizeof(float));
+    }
+    SDL_free(stream->history);
+    stream->history = history;
+    stream->history_stride = stride;
+    return 0;
+}
+
+/* Queue converted audio to be read */
+static int
+SDL_WriteAudioStreamRing(SDL_AudioStream * stream, const Uint8 * data,
+                         int len)
+{
+    int tail, first;
+
+    if (stream->ring_len + len > stream->ring_size) {
+        int size = stream->ring_size ? stream->ring_size * 2 : 4096;
+        Uint8 *ring;
+
+        while (size < stream->ring_len + len) {
+            size *= 2;
+        }
+        ring = (Uint8 *) SDL_malloc(size);
+        if (ring == NULL) {
+            SDL_OutOfMemory();
+            return -1;
+        }
+        /* Straighten out the queued data while we're at it */
+        first = SDL_min(stream->ring_len, stream->ring_size - stream->ring_head);
+        if (first > 0) {
+            SDL_memcpy(ring, stream->ring + stream->ring_head, first);
+            SDL_memcpy(ring + first, stream->ring, stream->ring_len - first);
+        }
+        SDL_free(stream->ring);
+        stream->ring = ring;
+        stream->ring_size = size;
+        stream->ring_head = 0;
+    }
+
+    tail = (stream->ring_head + stream->ring_len) & (stream->ring_size - 1);
+    first = SDL_min(len, stream->ring_size - tail);
+    SDL_memcpy(stream->ring + tail, data, first);
+    SDL_memcpy(stream->ring, data + first, len - first);
+    stream->ring_len += len;
+    return 0;
+}
+
+/* Resample as much of the history as possible */
+static int
+SDL_RunAudioStreamResampler(SDL_AudioStream * stream)
+{
+    const SDL_ResampleFilter *filter = stream->filter;
+    const int framesize = (SDL_AUDIO_BITSIZE(stream->resample_format) / 8) *
+        stream->dst_channels;
+    const int lookahead = filter->taps - filter->half_taps;
+    Uint64 limit, count, expected;
+    int first, c;
+
+    /* Every tap of the last output frame has to be in the history */
+    if (stream->history_frames - 1 - lookahead < 0) {
+        return 0;
+    }
+    limit = (((Uint64) (stream->history_frames - 1 - lookahead)) << 32) |
+        0xFFFFFFFF;
+    if (stream->pos > limit) {
+        return 0;
+    }
+    count = ((limit - stream->pos) / stream->step) + 1;
+
+    /* Never run ahead of the input, the step is rounded and the end may
+       be padded with silence */
+    expected = (stream->frames_in * stream->dst_rate) / stream->src_rate;
+    if (stream->frames_out + count > expected) {
+        count = expected - stream->frames_out;
+    }
+
+    while (count > 0) {
+        const int frames = (int) SDL_min(count, SDL_AUDIOSTREAM_CHUNK);
+        int len = frames * framesize;
+
+        SDL_ResampleBlock(filter, stream->history, stream->history_stride,
+                          stream->dst_channels, stream->resample_format,
+                          stream->resampled, frames, stream->pos,
+                          stream->step);
+        stream->pos += frames * stream->step;
+        stream->frames_out += frames;
+        count -= frames;
+
+        if (stream->cvt_after.needed) {
+            stream->cvt_after.buf = stream->resampled;
+            stream->cvt_after.len = len;
+            SDL_ConvertAudio(&stream->cvt_after);
+            len = stream->cvt_after.len_cvt;
+        }
+        if (SDL_WriteAudioStreamRing(stream, stream->resampled, len) < 0) {
+            return -1;
+        }
+    }
+
+    /* Drop the history the next output frame doesn't need anymore */
+    first = (int) (stream->pos >> 32) - filter->half_taps + 1;
+    if (first > 0) {
+        stream->history_frames -= first;
+        for (c = 0; c < stream->dst_channels; ++c) {
+            float *x = stream->history + c * stream->history_stride;
+            SDL_memmove(x, x + first, stream->history_frames * sizeof(float));
+        }
+        stream->pos -= ((Uint64) first) << 32;
+    }
+    return 0;
+}
+
+/* Convert up to SDL_AUDIOSTREAM_CHUNK whole source frames */
+static int
+SDL_ConvertAudioStreamChunk(SDL_AudioStream * stream, const Uint8 * data,
+                            int frames)
+{
+    int len = frames * stream->src_framesize;
+
+    if (stream->cvt_before.needed) {
+        SDL_memcpy(stream->work, data, len);
+        stream->cvt_before.buf = stream->work;
+        stream->cvt_before.len = len;
+        SDL_ConvertAudio(&stream->cvt_before);
+        data = stream->work;
+        len = stream->cvt_before.len_cvt;
+    }
+
+    if (stream->filter == NULL) {
+        return SDL_WriteAudioStreamRing(stream, data, len);
+    }
+
+    if (SDL_ReserveAudioStreamHistory(stream, frames) < 0) {
+        return -1;
+    }
+    SDL_DeinterleaveFrames(stream->history + stream->history_frames,
+                           stream->history_stride, data,
+                           stream->resample_format, stream->dst_channels,
+                           frames);
+    stream->history_frames += frames;
+    stream->frames_in += frames;
+    return SDL_RunAudioStreamResampler(stream);
+}
+
+SDL_AudioStream *
+SDL_NewAudioStream(SDL_AudioFormat src_format, Uint8 src_channels,
+                   int src_rate, SDL_AudioFormat dst_format,
+                   Uint8 dst_channels, int dst_rate)
+{
+    SDL_AudioStream *stream;
+    SDL_AudioFormat before_format;
+    int work_mult;
+
+    if (src_channels == 0 || dst_channels == 0) {
+        SDL_SetError("Invalid number of channels");
+        return NULL;
+    }
+    if (src_rate <= 0 || dst_rate <= 0) {
+        SDL_SetError("Invalid sample rate");
+        return NULL;
+    }
+
+    stream = (SDL_AudioStream *) SDL_calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    stream->src_format = src_format;
+    stream->src_channels = src_channels;
+    stream->src_rate = src_rate;
+    stream->dst_format = dst_format;
+    stream->dst_channels = dst_channels;
+    stream->dst_rate = dst_rate;
+    stream->src_framesize = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    stream->dst_framesize = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+
+    if (src_rate != dst_rate) {
+        /* The resampler works on 16-bit or float samples, use 16-bit if
+           both ends of the stream are. */
+        const double rate_incr = ((double) dst_rate) / ((double) src_rate);
+        SDL_ResamplerQuality quality = SDL_GetResamplerQuality();
+
+        if (quality == SDL_RESAMPLER_FAST) {
+            quality = SDL_RESAMPLER_MEDIUM;
+        }
+        stream->filter = SDL_AcquireResampleFilter(rate_incr, quality);
+        if (stream->filter == NULL) {
+            SDL_OutOfMemory();
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+        stream->step = ((((Uint64) src_rate) << 32) + dst_rate / 2) /
+            dst_rate;
+        if (src_format == AUDIO_S16SYS && dst_format == AUDIO_S16SYS) {
+            stream->resample_format = AUDIO_S16SYS;
+        } else {
+            stream->resample_format = AUDIO_F32SYS;
+        }
+        before_format = stream->resample_format;
+    } else {
+        before_format = dst_format;
+    }
+
+    if (SDL_BuildAudioCVT(&stream->cvt_before, src_format, src_channels,
+                          src_rate, before_format, dst_channels,
+                          src_rate) < 0) {
+        SDL_FreeAudioStream(stream);
+        return NULL;
+    }
+    if (stream->cvt_before.needed) {
+        work_mult = stream->cvt_before.len_mult;
+        stream->work = (Uint8 *) SDL_malloc(SDL_AUDIOSTREAM_CHUNK *
+                                            stream->src_framesize *
+                                            work_mult);
+        if (stream->work == NULL) {
+            SDL_OutOfMemory();
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+    }
+
+    if (stream->filter) {
+        const int framesize =
+            (SDL_AUDIO_BITSIZE(stream->resample_format) / 8) *
+            dst_channels;
+
+        if (SDL_BuildAudioCVT(&stream->cvt_after,
+                              stream->resample_format, dst_channels,
+                              dst_rate, dst_format, dst_channels,
+                              dst_rate) < 0) {
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+        work_mult = stream->cvt_after.needed ? stream->cvt_after.len_mult : 1;
+        stream->resampled = (Uint8 *) SDL_malloc(SDL_AUDIOSTREAM_CHUNK *
+                                                 framesize * work_mult);
+        stream->history_stride = SDL_AUDIOSTREAM_CHUNK +
+            2 * stream->filter->taps;
+        stream->history = (float *) SDL_malloc(stream->history_stride *
+                                               dst_channels * sizeof(float));
+        if (stream->resampled == NULL || stream->history == NULL) {
+            SDL_OutOfMemory();
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+        SDL_ResetAudioStreamResampler(stream);
+    }
+
+    stream->staging = (Uint8 *) SDL_malloc(stream->src_framesize);
+    if (stream->staging == NULL) {
+        SDL_OutOfMemory();
+        SDL_FreeAudioStream(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+int
+SDL_AudioStreamPut(SDL_AudioStream * stream, const void *buf, int len)
+{
+    const Uint8 *data = (const Uint8 *) buf;
+    int frames;
+
+    if (stream == NULL) {
+        SDL_SetError("Passed a NULL audio stream");
+        return -1;
+    }
+    if (buf == NULL || len < 0) {
+        SDL_SetError("Invalid audio buffer");
+        return -1;
+    }
+
+    /* Finish off a partial frame from last time first */
+    if (stream->staging_len > 0) {
+        const int needed = stream->src_framesize - stream->staging_len;
+        const int cpy = SDL_min(needed, len);
+
+        SDL_memcpy(stream->staging + stream->staging_len, data, cpy);
+        stream->staging_len += cpy;
+        data += cpy;
+        len -= cpy;
+        if (stream->staging_len < stream->src_framesize) {
+            return 0;
+        }
+        stream->staging_len = 0;
+        if (SDL_ConvertAudioStreamChunk(stream, stream->staging, 1) < 0) {
+            return -1;
+        }
+    }
+
+    while (len >= stream->src_framesize) {
+        frames = SDL_min(len / stream->src_framesize, SDL_AUDIOSTREAM_CHUNK);
+        if (SDL_ConvertAudioStreamChunk(stream, data, frames) < 0) {
+            return -1;
+        }
+        data += frames * stream->src_framesize;
+        len -= frames * stream->src_framesize;
+    }
+
+    if (len > 0) {
+        SDL_memcpy(stream->staging, data, len);
+        stream->staging_len = len;
+    }
+    return 0;
+}
+
+int
+SDL_AudioStreamFlush(SDL_AudioStream * stream)
+{
+    int padding, c;
+
+    if (stream == NULL) {
+        SDL_SetError("Passed a NULL audio stream");
+        return -1;
+    }
+
+    /* A partial frame can't be converted, drop it */
+    stream->staging_len = 0;
+
+    if (stream->filter) {
+        /* Pad with silence so the last frames have all their taps */
+        padding = stream->filter->taps;
+        if (SDL_ReserveAudioStreamHistory(stream, padding) < 0) {
+            return -1;
+        }
+        for (c = 0; c < stream->dst_channels; ++c) {
+            SDL_memset(stream->history + c * stream->history_stride +
+                       stream->history_frames, '\0',
+                       padding * sizeof(float));
+        }
+        stream->history_frames += padding;
+        if (SDL_RunAudioStreamResampler(stream) < 0) {
+            return -1;
+        }
+        SDL_ResetAudioStreamResampler(stream);
+    }
+    return 0;
+}
+
+int
+SDL_AudioStreamGet(SDL_AudioStream * stream, void *buf, int len)
+{
+    int first;
+
+    if (stream == NULL) {
+        SDL_SetError("Passed a NULL audio stream");
+        return -1;
+    }
+    if (buf == NULL || len < 0) {
+        SDL_SetError("Invalid audio buffer");
+        return -1;
+    }
+    if ((len % stream->dst_framesize) != 0) {
+        SDL_SetError("Can't request partial sample frames");
+        return -1;
+    }
+
+    len = SDL_min(len, stream->ring_len);
+    if (len > 0) {
+        first = SDL_min(len, stream->ring_size - stream->ring_head);
+        SDL_memcpy(buf, stream->ring + stream->ring_head, first);
+        SDL_memcpy(((Uint8 *) buf) + first, stream->ring, len - first);
+        stream->ring_head = (stream->ring_head + len) & (stream->ring_size - 1);
+        stream->ring_len -= len;
+    }
+    return len;
+}
+
+int
+SDL_AudioStreamAvailable(SDL_AudioStream * stream)
+{
+    return stream ? stream->ring_len : 0;
+}
+
+void
+SDL_AudioStreamClear(SDL_AudioStream * stream)
+{
+    if (stream) {
+        stream->staging_len = 0;
+        stream->ring_head = 0;
+        stream->ring_len = 0;
+        SDL_ResetAudioStreamResampler(stream);
+    }
+}
+
+void
+SDL_FreeAudioStream(SDL_AudioStream * stream)
+{
+    if (stream) {
+        if (stream->filter) {
+            SDL_ReleaseResampleFilter(stream->filter);
+        }
+        SDL_free(stream->staging);
+        SDL_free(stream->work);
+        SDL_free(stream->history);
+        SDL_free(stream->resampled);
+        SDL_free(stream->ring);
+        SDL_free(stream);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -26,6 +26,14 @@
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
+#include "SDL_audio_c.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2_TARGET
+#include <immintrin.h>
+#endif
 
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
@@ -85,15 +93,167 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v)	(s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)	(s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+/* Vector versions of the native endian S16 and F32 mixers.
+
+   They give exactly the same results as the C code below: the volume is
+   applied with a 32-bit product divided by 128 rounding toward zero, S16
+   samples are added with saturation, and F32 sums are clamped to the
+   float range.  Each returns the number of samples it mixed, the caller
+   does the rest.
+ */
+#ifdef __SSE2__
+static Uint32
+SDL_Mix_S16_SSE2(Sint16 * dst, const Sint16 * src, Uint32 num, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((short) volume);
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *) &src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *) &dst[i]);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i plo = _mm_mullo_epi16(s, vol);
+            const __m128i phi = _mm_mulhi_epi16(s, vol);
+            __m128i lo = _mm_unpacklo_epi16(plo, phi);
+            __m128i hi = _mm_unpackhi_epi16(plo, phi);
+            lo = _mm_add_epi32(lo, _mm_and_si128(_mm_srai_epi32(lo, 31), bias));
+            hi = _mm_add_epi32(hi, _mm_and_si128(_mm_srai_epi32(hi, 31), bias));
+            s = _mm_packs_epi32(_mm_srai_epi32(lo, 7), _mm_srai_epi32(hi, 7));
+        }
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_adds_epi16(s, d));
+    }
+    return i;
+}
+
+static Uint32
+SDL_Mix_F32_SSE2(float *dst, const float *src, Uint32 num, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    Uint32 i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), fvolume),
+                                    fmaxvolume);
+        __m128 d = _mm_add_ps(s, _mm_loadu_ps(&dst[i]));
+        /* The sum goes second so NaN passes through like in the C code */
+        d = _mm_max_ps(min_audioval, _mm_min_ps(max_audioval, d));
+        _mm_storeu_ps(&dst[i], d);
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#ifdef HAVE_AVX2_TARGET
+static Uint32 SDL_TARGET_AVX2
+SDL_Mix_S16_AVX2(Sint16 * dst, const Sint16 * src, Uint32 num, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((short) volume);
+    const __m256i bias = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; i + 16 <= num; i += 16) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) &src[i]);
+        const __m256i d = _mm256_loadu_si256((const __m256i *) &dst[i]);
+        if (volume != SDL_MIX_MAXVOLUME) {
+            /* Unpack and pack both work within 128-bit lanes, so they
+               put the samples back in order */
+            const __m256i plo = _mm256_mullo_epi16(s, vol);
+            const __m256i phi = _mm256_mulhi_epi16(s, vol);
+            __m256i lo = _mm256_unpacklo_epi16(plo, phi);
+            __m256i hi = _mm256_unpackhi_epi16(plo, phi);
+            lo = _mm256_add_epi32(lo, _mm256_and_si256(_mm256_srai_epi32(lo, 31), bias));
+            hi = _mm256_add_epi32(hi, _mm256_and_si256(_mm256_srai_epi32(hi, 31), bias));
+            s = _mm256_packs_epi32(_mm256_srai_epi32(lo, 7), _mm256_srai_epi32(hi, 7));
+        }
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_adds_epi16(s, d));
+    }
+    return i;
+}
+
+static Uint32 SDL_TARGET_AVX2
+SDL_Mix_F32_AVX2(float *dst, const float *src, Uint32 num, int volume)
+{
+    const __m256 fvolume = _mm256_set1_ps((float) volume);
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m256 max_audioval = _mm256_set1_ps(3.402823466e+38F);
+    const __m256 min_audioval = _mm256_set1_ps(-3.402823466e+38F);
+    Uint32 i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        const __m256 s = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), fvolume),
+                                       fmaxvolume);
+        __m256 d = _mm256_add_ps(s, _mm256_loadu_ps(&dst[i]));
+        d = _mm256_max_ps(min_audioval, _mm256_min_ps(max_audioval, d));
+        _mm256_storeu_ps(&dst[i], d);
+    }
+    return i;
+}
+#endif /* HAVE_AVX2_TARGET */
+
+/* Mix as much as the vector code can, returns the number of bytes mixed */
+static Uint32
+SDL_MixAudio_SIMD(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+                  Uint32 len, int volume)
+{
+    if (volume <= 0 || volume > SDL_MIX_MAXVOLUME) {
+        return 0;
+    }
+
+    switch (format) {
+    case AUDIO_S16SYS:
+#ifdef HAVE_AVX2_TARGET
+        if (SDL_HasAVX2()) {
+            return 2 * SDL_Mix_S16_AVX2((Sint16 *) dst, (const Sint16 *) src,
+                                        len / 2, volume);
+        }
+#endif
+#ifdef __SSE2__
+        if (SDL_HasSSE2()) {
+            return 2 * SDL_Mix_S16_SSE2((Sint16 *) dst, (const Sint16 *) src,
+                                        len / 2, volume);
+        }
+#endif
+        break;
+
+    case AUDIO_F32SYS:
+#ifdef HAVE_AVX2_TARGET
+        if (SDL_HasAVX2()) {
+            return 4 * SDL_Mix_F32_AVX2((float *) dst, (const float *) src,
+                                        len / 4, volume);
+        }
+#endif
+#ifdef __SSE2__
+        if (SDL_HasSSE2()) {
+            return 4 * SDL_Mix_F32_SSE2((float *) dst, (const float *) src,
+                                        len / 4, volume);
+        }
+#endif
+        break;
+    }
+    return 0;
+}
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
                    Uint32 len, int volume)
 {
+    Uint32 mixed;
+
     if (volume == 0) {
         return;
     }
 
+    /* The C code below picks up whatever the vector code leaves over */
+    mixed = SDL_MixAudio_SIMD(dst, src, format, len, volume);
+    dst += mixed;
+    src += mixed;
+    len -= mixed;
+
     switch (format) {
 
     case AUDIO_U8:
@@ -23,6 +23,7 @@
 #ifndef _SDL_sysaudio_h
 #define _SDL_sysaudio_h
 
+#include "SDL_atomic.h"
 #include "SDL_mutex.h"
 #include "SDL_thread.h"
 
@@ -41,6 +42,7 @@ typedef struct SDL_AudioDriverImpl
     void (*WaitDevice) (_THIS);
     void (*PlayDevice) (_THIS);
     Uint8 *(*GetDeviceBuf) (_THIS);
+    int (*CaptureFromDevice) (_THIS, Uint8 ** buffer);   /* Blocks for a buffer */
     void (*WaitDone) (_THIS);
     void (*CloseDevice) (_THIS);
     void (*LockDevice) (_THIS);
@@ -87,7 +89,55 @@ typedef struct
 } SDL_AudioStreamer;
 
 
+/* Lock-free ring the application writes to instead of using a callback.
+   The positions are running byte counts, so the size must be a power of 2.
+ */
+typedef struct
+{
+    Uint8 *buffer;
+    Uint32 size;
+    Uint32 frame_size;          /* the application writes whole frames */
+    SDL_atomic_t head;          /* bytes written, only moved by the writer */
+    SDL_atomic_t tail;          /* bytes read, only moved by the audio thread */
+    SDL_atomic_t underruns;
+} SDL_AudioRing;
+
+
+/* Queued audio is kept in a list of fixed size packets, and drained
+   packets go to a pool to be reused, so steady queueing doesn't allocate.
+ */
+#define SDL_AUDIOBUFFERQUEUE_PACKETLEN (8 * 1024)
+
+typedef struct SDL_AudioBufferQueue
+{
+    Uint8 data[SDL_AUDIOBUFFERQUEUE_PACKETLEN];
+    Uint32 datalen;             /* bytes in use in this packet */
+    Uint32 startpos;            /* bytes already played from this packet */
+    struct SDL_AudioBufferQueue *next;
+} SDL_AudioBufferQueue;
+
+
 /* Define the SDL audio driver structure */
+/* Audio thread statistics, see SDL_GetAudioDeviceStats().
+   Callback times go into a histogram with 8 buckets per octave of
+   microseconds, so percentiles are within about 12% of the real value.
+ */
+#define SDL_AUDIOSTATS_BUCKETS  240
+
+typedef struct SDL_AudioStats
+{
+    Uint64 ticks_per_sec;
+    Uint32 callbacks;
+    Uint32 missed_deadlines;
+    Uint32 late_wakeups;
+    Uint32 underruns;
+    Uint32 converts;
+    Uint64 convert_total;
+    Uint64 convert_max;
+    Uint64 callback_max;
+    Uint32 histogram[SDL_AUDIOSTATS_BUCKETS];
+} SDL_AudioStats;
+
 struct SDL_AudioDevice
 {
     /* * * */
@@ -96,6 +146,9 @@ struct SDL_AudioDevice
     /* The current audio specification (shared with audio thread) */
     SDL_AudioSpec spec;
 
+    /* The audio specification the application sees */
+    SDL_AudioSpec callbackspec;
+
     /* An audio conversion block for audio format emulation */
     SDL_AudioCVT convert;
 
@@ -109,9 +162,26 @@ struct SDL_AudioDevice
     int paused;
     int opened;
 
+    /* Frames buffered by the hardware after the callback, 0 if unknown */
+    Uint32 latency;
+
     /* Fake audio buffer for when the audio hardware is busy */
     Uint8 *fake_stream;
 
+    /* The ring buffer replacing the callback, set once with an atomic write */
+    SDL_AudioRing *ring;
+
+    /* Statistics, only touched by the audio thread while enabled and
+       updated with the device locked */
+    int stats_enabled;
+    SDL_AudioStats *stats;
+
+    /* Audio queued with SDL_QueueAudio(), protected by the device lock */
+    Uint32 queued_bytes;
+    SDL_AudioBufferQueue *buffer_queue_head;
+    SDL_AudioBufferQueue *buffer_queue_tail;
+    SDL_AudioBufferQueue *buffer_queue_pool;
+
     /* A semaphore for locking the mixing buffers */
     SDL_mutex *mixer_lock;
 
@@ -23,10 +23,14 @@
 /* Microsoft WAVE file loading routines */
 
 #include "SDL_audio.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_thread.h"
 #include "SDL_wave.h"
 
 
 static int ReadChunk(SDL_RWops * src, Chunk * chunk);
+static int ReadChunkHeader(SDL_RWops * src, Chunk * chunk);
 
 struct MS_ADPCM_decodestate
 {
@@ -35,409 +39,459 @@ struct MS_ADPCM_decodestate
     Sint16 iSamp1;
     Sint16 iSamp2;
 };
-static struct MS_ADPCM_decoder
+struct MS_ADPCM_decoder
 {
-    WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
     Uint16 wNumCoef;
     Sint16 aCoeff[7][2];
     /* * * */
     struct MS_ADPCM_decodestate state[2];
-} MS_ADPCM_state;
+};
+
+struct IMA_ADPCM_decodestate
+{
+    Sint32 sample;
+    Sint8 index;
+};
+struct IMA_ADPCM_decoder
+{
+    Uint16 wSamplesPerBlock;
+    /* * * */
+    struct IMA_ADPCM_decodestate state[2];
+};
+
+union ADPCM_decoder
+{
+    struct MS_ADPCM_decoder ms;
+    struct IMA_ADPCM_decoder ima;
+};
+
+/* An open WAVE file, decoded as it's read */
+struct SDL_WAVStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveFMT wavefmt;            /* In native byte order */
+    Uint32 frame_size;          /* Bytes in a decoded sample frame */
+    long riff_end;              /* Where the RIFF chunk ends in src */
+    long data_start;            /* Where the audio data starts in src */
+    Uint32 frames;              /* Decoded sample frames in the file */
+    Uint32 position;            /* The next frame to be read */
+
+    /* ADPCM data is decoded a block at a time */
+    Uint32 block_frames;
+    Uint8 *block;
+    Uint8 *decoded;
+    Uint32 decoded_len;
+    Uint32 decoded_pos;
+    union ADPCM_decoder adpcm;
+};
 
 static int
-InitMS_ADPCM(WaveFMT * format)
+InitMS_ADPCM(struct MS_ADPCM_decoder *decoder, const WaveFMT * wavefmt,
+             const Uint8 * format, Uint32 formatlen)
 {
-    Uint8 *rogue_feel;
-    Uint16 extra_info;
+    const Uint8 *rogue_feel;
     int i;
 
-    /* Set the rogue pointer to the MS_ADPCM specific data */
-    MS_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    MS_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    MS_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    MS_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    MS_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    MS_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
-    rogue_feel = (Uint8 *) format + sizeof(*format);
-    if (sizeof(*format) == 16) {
-        extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]);
-        rogue_feel += sizeof(Uint16);
+    /* Set the rogue pointer to the MS_ADPCM specific data, past the
+       size of the extra information */
+    if (formatlen < sizeof(WaveFMT) + 6 + 7 * 4) {
+        SDL_SetError("Truncated MS_ADPCM format chunk");
+        return (-1);
     }
-    MS_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    rogue_feel = format + sizeof(WaveFMT) + sizeof(Uint16);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    MS_ADPCM_state.wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    if (MS_ADPCM_state.wNumCoef != 7) {
+    if (decoder->wNumCoef != 7) {
         SDL_SetError("Unknown set of MS_ADPCM coefficients");
         return (-1);
     }
-    for (i = 0; i < MS_ADPCM_state.wNumCoef; ++i) {
-        MS_ADPCM_state.aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    for (i = 0; i < decoder->wNumCoef; ++i) {
+        decoder->aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
-        MS_ADPCM_state.aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+        decoder->aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
-    return (0);
-}
 
-static Sint32
-MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
-                Uint8 nybble, Sint16 * coeff)
-{
-    const Sint32 max_audioval = ((1 << (16 - 1)) - 1);
-    const Sint32 min_audioval = -(1 << (16 - 1));
-    const Sint32 adaptive[] = {
-        230, 230, 230, 230, 307, 409, 512, 614,
-        768, 614, 512, 409, 307, 230, 230, 230
-    };
-    Sint32 new_sample, delta;
-
-    new_sample = ((state->iSamp1 * coeff[0]) +
-                  (state->iSamp2 * coeff[1])) / 256;
-    if (nybble & 0x08) {
-        new_sample += state->iDelta * (nybble - 0x10);
-    } else {
-        new_sample += state->iDelta * nybble;
-    }
-    if (new_sample < min_audioval) {
-        new_sample = min_audioval;
-    } else if (new_sample > max_audioval) {
-        new_sample = max_audioval;
+    /* Make sure a block holds the header and the samples it claims */
+    if (wavefmt->channels < 1 || wavefmt->channels > 2) {
+        SDL_SetError("MS_ADPCM decoder can only handle 1 or 2 channels");
+        return (-1);
     }
-    delta = ((Sint32) state->iDelta * adaptive[nybble]) / 256;
-    if (delta < 16) {
-        delta = 16;
+    if (decoder->wSamplesPerBlock < 2 ||
+        ((decoder->wSamplesPerBlock - 2) * wavefmt->channels) % 2 != 0 ||
+        7 * wavefmt->channels +
+        (decoder->wSamplesPerBlock - 2) * wavefmt->channels / 2 >
+        wavefmt->blockalign) {
+        SDL_SetError("Invalid MS_ADPCM block size");
+        return (-1);
     }
-    state->iDelta = (Uint16) delta;
-    state->iSamp2 = state->iSamp1;
-    state->iSamp1 = (Sint16) new_sample;
-    return (new_sample);
+    return (0);
 }
 
+/* Decode one MS_ADPCM sample of a channel whose state is in locals */
+#define MS_ADPCM_STEP(nybble, delta, samp1, samp2, coeff, out) \
+    do { \
+        Sint32 new_sample = ((samp1 * coeff[0]) + (samp2 * coeff[1])) / 256 + \
+            delta * ((Sint32) ((nybble) ^ 0x08) - 0x08); \
+        if (new_sample < -32768) { \
+            new_sample = -32768; \
+        } else if (new_sample > 32767) { \
+            new_sample = 32767; \
+        } \
+        delta = (Uint16) ((delta * MS_ADPCM_adaptive[nybble]) / 256); \
+        if (delta < 16) { \
+            delta = 16; \
+        } \
+        samp2 = samp1; \
+        samp1 = new_sample; \
+        (out) = SDL_SwapLE16((Uint16) new_sample); \
+    } while (0)
+
+static const Sint32 MS_ADPCM_adaptive[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614,
+    768, 614, 512, 409, 307, 230, 230, 230
+};
+
+/* Decode one block of MS_ADPCM data.
+   The state of each channel is kept in locals for the whole block, and
+   the two channels of a stereo block don't depend on each other, so their
+   samples are decoded side by side in the same loop.
+ */
 static int
-MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+MS_ADPCM_decode(struct MS_ADPCM_decoder *decoder, int channels,
+                const Uint8 * encoded, Uint8 * decoded)
 {
     struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
-    Sint8 nybble, stereo;
+    const Uint8 *end;
+    Uint16 *out = (Uint16 *) decoded;
+    Sint8 stereo;
     Sint16 *coeff[2];
-    Sint32 new_sample;
-
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
-        MS_ADPCM_state.wSamplesPerBlock *
-        MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        SDL_Error(SDL_ENOMEM);
-        return (-1);
-    }
-    decoded = *audio_buf;
+    Sint32 delta0, samp10, samp20;
+    Sint32 delta1, samp11, samp21;
 
     /* Get ready... Go! */
-    stereo = (MS_ADPCM_state.wavefmt.channels == 2);
-    state[0] = &MS_ADPCM_state.state[0];
-    state[1] = &MS_ADPCM_state.state[stereo];
-    while (encoded_len >= MS_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        state[0]->hPredictor = *encoded++;
-        if (stereo) {
-            state[1]->hPredictor = *encoded++;
-        }
-        state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    stereo = (channels == 2);
+    state[0] = &decoder->state[0];
+    state[1] = &decoder->state[stereo];
+
+    /* Grab the initial information for this block */
+    state[0]->hPredictor = *encoded++;
+    if (stereo) {
+        state[1]->hPredictor = *encoded++;
+    }
+    if (state[0]->hPredictor >= decoder->wNumCoef ||
+        state[1]->hPredictor >= decoder->wNumCoef) {
+        SDL_SetError("Corrupt MS_ADPCM block");
+        return (-1);
+    }
+    state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    }
+    state[0]->iSamp1 = (Sint16) ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp1 = (Sint16) ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    }
+    state[0]->iSamp2 = (Sint16) ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp2 = (Sint16) ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        coeff[0] = MS_ADPCM_state.aCoeff[state[0]->hPredictor];
-        coeff[1] = MS_ADPCM_state.aCoeff[state[1]->hPredictor];
-
-        /* Store the two initial samples we start with */
-        decoded[0] = state[0]->iSamp2 & 0xFF;
-        decoded[1] = state[0]->iSamp2 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp2 & 0xFF;
-            decoded[1] = state[1]->iSamp2 >> 8;
-            decoded += 2;
-        }
-        decoded[0] = state[0]->iSamp1 & 0xFF;
-        decoded[1] = state[0]->iSamp1 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp1 & 0xFF;
-            decoded[1] = state[1]->iSamp1 >> 8;
-            decoded += 2;
-        }
-
-        /* Decode and store the other samples in this block */
-        samplesleft = (MS_ADPCM_state.wSamplesPerBlock - 2) *
-            MS_ADPCM_state.wavefmt.channels;
-        while (samplesleft > 0) {
-            nybble = (*encoded) >> 4;
-            new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            nybble = (*encoded) & 0x0F;
-            new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            ++encoded;
-            samplesleft -= 2;
-        }
-        encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
-    }
-    SDL_free(freeable);
-    return (0);
-}
+    }
+    coeff[0] = decoder->aCoeff[state[0]->hPredictor];
+    coeff[1] = decoder->aCoeff[state[1]->hPredictor];
 
-struct IMA_ADPCM_decodestate
-{
-    Sint32 sample;
-    Sint8 index;
-};
-static struct IMA_ADPCM_decoder
-{
-    WaveFMT wavefmt;
-    Uint16 wSamplesPerBlock;
-    /* * * */
-    struct IMA_ADPCM_decodestate state[2];
-} IMA_ADPCM_state;
+    /* Store the two initial samples we start with */
+    *out++ = SDL_SwapLE16((Uint16) state[0]->iSamp2);
+    if (stereo) {
+        *out++ = SDL_SwapLE16((Uint16) state[1]->iSamp2);
+    }
+    *out++ = SDL_SwapLE16((Uint16) state[0]->iSamp1);
+    if (stereo) {
+        *out++ = SDL_SwapLE16((Uint16) state[1]->iSamp1);
+    }
 
-static int
-InitIMA_ADPCM(WaveFMT * format)
-{
-    Uint8 *rogue_feel;
-    Uint16 extra_info;
-
-    /* Set the rogue pointer to the IMA_ADPCM specific data */
-    IMA_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    IMA_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    IMA_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    IMA_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    IMA_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    IMA_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
-    rogue_feel = (Uint8 *) format + sizeof(*format);
-    if (sizeof(*format) == 16) {
-        extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]);
-        rogue_feel += sizeof(Uint16);
+    /* Decode and store the other samples in this block, each byte has
+       the next sample of both channels, or the next two of a mono one */
+    delta0 = state[0]->iDelta;
+    samp10 = state[0]->iSamp1;
+    samp20 = state[0]->iSamp2;
+    end = encoded + ((decoder->wSamplesPerBlock - 2) * channels) / 2;
+    if (stereo) {
+        delta1 = state[1]->iDelta;
+        samp11 = state[1]->iSamp1;
+        samp21 = state[1]->iSamp2;
+        while (encoded < end) {
+            const Uint8 byte = *encoded++;
+            MS_ADPCM_STEP(byte >> 4, delta0, samp10, samp20, coeff[0], out[0]);
+            MS_ADPCM_STEP(byte & 0x0F, delta1, samp11, samp21, coeff[1], out[1]);
+            out += 2;
+        }
+        state[1]->iDelta = (Uint16) delta1;
+        state[1]->iSamp1 = (Sint16) samp11;
+        state[1]->iSamp2 = (Sint16) samp21;
+    } else {
+        while (encoded < end) {
+            const Uint8 byte = *encoded++;
+            MS_ADPCM_STEP(byte >> 4, delta0, samp10, samp20, coeff[0], out[0]);
+            MS_ADPCM_STEP(byte & 0x0F, delta0, samp10, samp20, coeff[0], out[1]);
+            out += 2;
+        }
     }
-    IMA_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    state[0]->iDelta = (Uint16) delta0;
+    state[0]->iSamp1 = (Sint16) samp10;
+    state[0]->iSamp2 = (Sint16) samp20;
     return (0);
 }
 
-static Sint32
-IMA_ADPCM_nibble(struct IMA_ADPCM_decodestate *state, Uint8 nybble)
+static int
+InitIMA_ADPCM(struct IMA_ADPCM_decoder *decoder, const WaveFMT * wavefmt,
+              const Uint8 * format, Uint32 formatlen)
 {
-    const Sint32 max_audioval = ((1 << (16 - 1)) - 1);
-    const Sint32 min_audioval = -(1 << (16 - 1));
-    const int index_table[16] = {
-        -1, -1, -1, -1,
-        2, 4, 6, 8,
-        -1, -1, -1, -1,
-        2, 4, 6, 8
-    };
-    const Sint32 step_table[89] = {
-        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
-        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
-        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
-        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
-        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
-        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
-        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
-        22385, 24623, 27086, 29794, 32767
-    };
-    Sint32 delta, step;
-
-    /* Compute difference and new sample value */
-    step = step_table[state->index];
-    delta = step >> 3;
-    if (nybble & 0x04)
-        delta += step;
-    if (nybble & 0x02)
-        delta += (step >> 1);
-    if (nybble & 0x01)
-        delta += (step >> 2);
-    if (nybble & 0x08)
-        delta = -delta;
-    state->sample += delta;
-
-    /* Update index value */
-    state->index += index_table[nybble];
-    if (state->index > 88) {
-        state->index = 88;
-    } else if (state->index < 0) {
-        state->index = 0;
-    }
-
-    /* Clamp output sample */
-    if (state->sample > max_audioval) {
-        state->sample = max_audioval;
-    } else if (state->sample < min_audioval) {
-        state->sample = min_audioval;
-    }
-    return (state->sample);
-}
+    const Uint8 *rogue_feel;
 
-/* Fill the decode buffer with a channel block of data (8 samples) */
-static void
-Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
-                     int channel, int numchannels,
-                     struct IMA_ADPCM_decodestate *state)
-{
-    int i;
-    Sint8 nybble;
-    Sint32 new_sample;
-
-    decoded += (channel * 2);
-    for (i = 0; i < 4; ++i) {
-        nybble = (*encoded) & 0x0F;
-        new_sample = IMA_ADPCM_nibble(state, nybble);
-        decoded[0] = new_sample & 0xFF;
-        new_sample >>= 8;
-        decoded[1] = new_sample & 0xFF;
-        decoded += 2 * numchannels;
-
-        nybble = (*encoded) >> 4;
-        new_sample = IMA_ADPCM_nibble(state, nybble);
-        decoded[0] = new_sample & 0xFF;
-        new_sample >>= 8;
-        decoded[1] = new_sample & 0xFF;
-        decoded += 2 * numchannels;
-
-        ++encoded;
+    /* Set the rogue pointer to the IMA_ADPCM specific data, past the
+       size of the extra information */
+    if (formatlen < sizeof(WaveFMT) + 4) {
+        SDL_SetError("Truncated IMA_ADPCM format chunk");
+        return (-1);
     }
-}
-
-static int
-IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
-{
-    struct IMA_ADPCM_decodestate *state;
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
-    unsigned int c, channels;
+    rogue_feel = format + sizeof(WaveFMT) + sizeof(Uint16);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
 
     /* Check to make sure we have enough variables in the state array */
-    channels = IMA_ADPCM_state.wavefmt.channels;
-    if (channels > SDL_arraysize(IMA_ADPCM_state.state)) {
+    if (wavefmt->channels < 1 ||
+        wavefmt->channels > SDL_arraysize(decoder->state)) {
         SDL_SetError("IMA ADPCM decoder can only handle %d channels",
-                     SDL_arraysize(IMA_ADPCM_state.state));
+                     SDL_arraysize(decoder->state));
         return (-1);
     }
-    state = IMA_ADPCM_state.state;
-
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
-        IMA_ADPCM_state.wSamplesPerBlock *
-        IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        SDL_Error(SDL_ENOMEM);
+
+    /* Samples after the first come in groups of 8 per channel */
+    if (decoder->wSamplesPerBlock < 1 ||
+        ((decoder->wSamplesPerBlock - 1) % 8) != 0 ||
+        (4 + (decoder->wSamplesPerBlock - 1) / 2) * wavefmt->channels >
+        wavefmt->blockalign) {
+        SDL_SetError("Invalid IMA_ADPCM block size");
         return (-1);
     }
-    decoded = *audio_buf;
+    return (0);
+}
 
-    /* Get ready... Go! */
-    while (encoded_len >= IMA_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        for (c = 0; c < channels; ++c) {
-            /* Fill the state information for this block */
-            state[c].sample = ((encoded[1] << 8) | encoded[0]);
-            encoded += 2;
-            if (state[c].sample & 0x8000) {
-                state[c].sample -= 0x10000;
-            }
-            state[c].index = *encoded++;
-            /* Reserved byte in buffer header, should be 0 */
-            if (*encoded++ != 0) {
-                /* Uh oh, corrupt data?  Buggy code? */ ;
-            }
+static const Sint8 IMA_ADPCM_index_table[16] = {
+    -1, -1, -1, -1,
+    2, 4, 6, 8,
+    -1, -1, -1, -1,
+    2, 4, 6, 8
+};
+
+static const Sint32 IMA_ADPCM_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+    143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+    1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767
+};
 
-            /* Store the initial sample we start with */
-            decoded[0] = (Uint8) (state[c].sample & 0xFF);
-            decoded[1] = (Uint8) (state[c].sample >> 8);
-            decoded += 2;
+/* Decode one IMA_ADPCM sample of a channel whose state is in locals */
+#define IMA_ADPCM_STEP(nybble, sample, index, out) \
+    do { \
+        const Sint32 step = IMA_ADPCM_step_table[index]; \
+        Sint32 delta = step >> 3; \
+        if ((nybble) & 0x04) \
+            delta += step; \
+        if ((nybble) & 0x02) \
+            delta += (step >> 1); \
+        if ((nybble) & 0x01) \
+            delta += (step >> 2); \
+        if ((nybble) & 0x08) \
+            delta = -delta; \
+        sample += delta; \
+        if (sample > 32767) { \
+            sample = 32767; \
+        } else if (sample < -32768) { \
+            sample = -32768; \
+        } \
+        index += IMA_ADPCM_index_table[nybble]; \
+        if (index > 88) { \
+            index = 88; \
+        } else if (index < 0) { \
+            index = 0; \
+        } \
+        (out) = SDL_SwapLE16((Uint16) sample); \
+    } while (0)
+
+/* Decode one block of IMA_ADPCM data.
+   Each channel's samples come in runs of 8 nibbles, so for stereo the
+   runs of both channels are decoded side by side in the same loop, with
+   the state of each channel kept in locals for the whole block.
+ */
+static int
+IMA_ADPCM_decode(struct IMA_ADPCM_decoder *decoder, int channels,
+                 const Uint8 * encoded, Uint8 * decoded)
+{
+    struct IMA_ADPCM_decodestate *state = decoder->state;
+    Uint16 *out = (Uint16 *) decoded;
+    Sint32 sample0, index0, sample1, index1;
+    int c, group, groups, i;
+
+    /* Grab the initial information for this block */
+    for (c = 0; c < channels; ++c) {
+        /* Fill the state information for this block */
+        state[c].sample = ((encoded[1] << 8) | encoded[0]);
+        encoded += 2;
+        if (state[c].sample & 0x8000) {
+            state[c].sample -= 0x10000;
+        }
+        state[c].index = *encoded++;
+        if (state[c].index < 0 || state[c].index > 88) {
+            SDL_SetError("Corrupt IMA_ADPCM block");
+            return (-1);
         }
+        /* Reserved byte in buffer header, should be 0 */
+        if (*encoded++ != 0) {
+            /* Uh oh, corrupt data?  Buggy code? */ ;
+        }
+
+        /* Store the initial sample we start with */
+        *out++ = SDL_SwapLE16((Uint16) state[c].sample);
+    }
 
-        /* Decode and store the other samples in this block */
-        samplesleft = (IMA_ADPCM_state.wSamplesPerBlock - 1) * channels;
-        while (samplesleft > 0) {
-            for (c = 0; c < channels; ++c) {
-                Fill_IMA_ADPCM_block(decoded, encoded,
-                                     c, channels, &state[c]);
-                encoded += 4;
-                samplesleft -= 8;
+    /* Decode and store the other samples in this block */
+    groups = (decoder->wSamplesPerBlock - 1) / 8;
+    sample0 = state[0].sample;
+    index0 = state[0].index;
+    if (channels == 2) {
+        sample1 = state[1].sample;
+        index1 = state[1].index;
+        for (group = 0; group < groups; ++group) {
+            for (i = 0; i < 4; ++i) {
+                const Uint8 byte0 = encoded[i];
+                const Uint8 byte1 = encoded[i + 4];
+                IMA_ADPCM_STEP(byte0 & 0x0F, sample0, index0, out[0]);
+                IMA_ADPCM_STEP(byte1 & 0x0F, sample1, index1, out[1]);
+                IMA_ADPCM_STEP(byte0 >> 4, sample0, index0, out[2]);
+                IMA_ADPCM_STEP(byte1 >> 4, sample1, index1, out[3]);
+                out += 4;
             }
-            decoded += (channels * 8 * 2);
+            encoded += 8;
+        }
+        state[1].sample = sample1;
+        state[1].index = (Sint8) index1;
+    } else {
+        for (group = 0; group < groups; ++group) {
+            for (i = 0; i < 4; ++i) {
+                const Uint8 byte0 = encoded[i];
+                IMA_ADPCM_STEP(byte0 & 0x0F, sample0, index0, out[0]);
+                IMA_ADPCM_STEP(byte0 >> 4, sample0, index0, out[1]);
+                out += 2;
+            }
+            encoded += 4;
         }
-        encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
     }
-    SDL_free(freeable);
+    state[0].sample = sample0;
+    state[0].index = (Sint8) index0;
     return (0);
 }
 
-SDL_AudioSpec *
-SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
-               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+/* Decode ADPCM blocks with the decoder for the stream's encoding */
+static int
+SDL_DecodeADPCM(const SDL_WAVStream * stream, union ADPCM_decoder *decoder,
+                const Uint8 * encoded, Uint8 * decoded, Uint32 blocks)
 {
+    const int channels = stream->wavefmt.channels;
+    const Uint32 decoded_len = stream->block_frames * stream->frame_size;
+    Uint32 i;
+
+    for (i = 0; i < blocks; ++i) {
+        int status;
+
+        if (stream->wavefmt.encoding == MS_ADPCM_CODE) {
+            status = MS_ADPCM_decode(&decoder->ms, channels, encoded, decoded);
+        } else {
+            status = IMA_ADPCM_decode(&decoder->ima, channels, encoded, decoded);
+        }
+        if (status < 0) {
+            return (-1);
+        }
+        encoded += stream->wavefmt.blockalign;
+        decoded += decoded_len;
+    }
+    return (0);
+}
+
+/* Read and decode the next ADPCM block, returns 0 at the end of the data */
+static int
+SDL_DecodeWAVBlock(SDL_WAVStream * stream)
+{
+    if (SDL_RWread(stream->src, stream->block,
+                   stream->wavefmt.blockalign, 1) != 1) {
+        return (0);
+    }
+    if (SDL_DecodeADPCM(stream, &stream->adpcm, stream->block,
+                        stream->decoded, 1) < 0) {
+        return (-1);
+    }
+    stream->decoded_len = stream->block_frames * stream->frame_size;
+    stream->decoded_pos = 0;
+    return (1);
+}
+
+SDL_WAVStream *
+SDL_OpenWAVStream_RW(SDL_RWops * src, int freesrc, SDL_AudioSpec * spec)
+{
+    SDL_WAVStream *stream = NULL;
     int was_error;
     Chunk chunk;
-    int lenread;
     int IEEE_float_encoded, MS_ADPCM_encoded, IMA_ADPCM_encoded;
-    int samplesize;
+    long riff_start;
 
     /* WAV magic header */
     Uint32 RIFFchunk;
     Uint32 wavelen = 0;
     Uint32 WAVEmagic;
-    Uint32 headerDiff = 0;
 
     /* FMT chunk */
     WaveFMT *format = NULL;
+    Uint32 formatlen;
 
     /* Make sure we are passed a valid data source */
     was_error = 0;
+    chunk.data = NULL;
     if (src == NULL) {
         was_error = 1;
         goto done;
     }
+    stream = (SDL_WAVStream *) SDL_malloc(sizeof(*stream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        was_error = 1;
+        goto done;
+    }
+    SDL_zerop(stream);
+    stream->src = src;
+    stream->freesrc = freesrc;
 
     /* Check the magic header */
+    riff_start = SDL_RWtell(src);
     RIFFchunk = SDL_ReadLE32(src);
     wavelen = SDL_ReadLE32(src);
     if (wavelen == WAVE) {      /* The RIFFchunk has already been read */
         WAVEmagic = wavelen;
         wavelen = RIFFchunk;
         RIFFchunk = RIFF;
+        riff_start -= sizeof(Uint32);
     } else {
         WAVEmagic = SDL_ReadLE32(src);
     }
@@ -446,33 +500,43 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         was_error = 1;
         goto done;
     }
-    headerDiff += sizeof(Uint32);       /* for WAVE */
+    stream->riff_end = riff_start + 2 * sizeof(Uint32) + wavelen;
 
     /* Read the audio data format chunk */
-    chunk.data = NULL;
     do {
         if (chunk.data != NULL) {
             SDL_free(chunk.data);
             chunk.data = NULL;
         }
-        lenread = ReadChunk(src, &chunk);
-        if (lenread < 0) {
+        if (ReadChunk(src, &chunk) < 0) {
             was_error = 1;
             goto done;
         }
-        /* 2 Uint32's for chunk header+len, plus the lenread */
-        headerDiff += lenread + 2 * sizeof(Uint32);
     } while ((chunk.magic == FACT) || (chunk.magic == LIST));
 
     /* Decode the audio data format */
     format = (WaveFMT *) chunk.data;
+    formatlen = chunk.length;
+    chunk.data = NULL;
     if (chunk.magic != FMT) {
         SDL_SetError("Complex WAVE files not supported");
         was_error = 1;
         goto done;
     }
+    if (formatlen < sizeof(*format)) {
+        SDL_SetError("Truncated WAVE format chunk");
+        was_error = 1;
+        goto done;
+    }
+    stream->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    stream->wavefmt.channels = SDL_SwapLE16(format->channels);
+    stream->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    stream->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    stream->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    stream->wavefmt.bitspersample = SDL_SwapLE16(format->bitspersample);
+
     IEEE_float_encoded = MS_ADPCM_encoded = IMA_ADPCM_encoded = 0;
-    switch (SDL_SwapLE16(format->encoding)) {
+    switch (stream->wavefmt.encoding) {
     case PCM_CODE:
         /* We can understand this */
         break;
@@ -482,42 +546,46 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         break;
     case MS_ADPCM_CODE:
         /* Try to understand this */
-        if (InitMS_ADPCM(format) < 0) {
+        if (InitMS_ADPCM(&stream->adpcm.ms, &stream->wavefmt,
+                         (Uint8 *) format, formatlen) < 0) {
             was_error = 1;
             goto done;
         }
+        stream->block_frames = stream->adpcm.ms.wSamplesPerBlock;
         MS_ADPCM_encoded = 1;
         break;
     case IMA_ADPCM_CODE:
         /* Try to understand this */
-        if (InitIMA_ADPCM(format) < 0) {
+        if (InitIMA_ADPCM(&stream->adpcm.ima, &stream->wavefmt,
+                          (Uint8 *) format, formatlen) < 0) {
             was_error = 1;
             goto done;
         }
+        stream->block_frames = stream->adpcm.ima.wSamplesPerBlock;
         IMA_ADPCM_encoded = 1;
         break;
     case MP3_CODE:
         SDL_SetError("MPEG Layer 3 data not supported",
-                     SDL_SwapLE16(format->encoding));
+                     stream->wavefmt.encoding);
         was_error = 1;
         goto done;
     default:
         SDL_SetError("Unknown WAVE data format: 0x%.4x",
-                     SDL_SwapLE16(format->encoding));
+                     stream->wavefmt.encoding);
         was_error = 1;
         goto done;
     }
     SDL_memset(spec, 0, (sizeof *spec));
-    spec->freq = SDL_SwapLE32(format->frequency);
+    spec->freq = stream->wavefmt.frequency;
 
     if (IEEE_float_encoded) {
-        if ((SDL_SwapLE16(format->bitspersample)) != 32) {
+        if (stream->wavefmt.bitspersample != 32) {
             was_error = 1;
         } else {
             spec->format = AUDIO_F32;
         }
     } else {
-        switch (SDL_SwapLE16(format->bitspersample)) {
+        switch (stream->wavefmt.bitspersample) {
         case 4:
             if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
                 spec->format = AUDIO_S16;
@@ -542,60 +610,403 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
 
     if (was_error) {
         SDL_SetError("Unknown %d-bit PCM data format",
-                     SDL_SwapLE16(format->bitspersample));
+                     stream->wavefmt.bitspersample);
         goto done;
     }
-    spec->channels = (Uint8) SDL_SwapLE16(format->channels);
+    if (stream->wavefmt.channels == 0) {
+        SDL_SetError("WAVE file has no audio channels");
+        was_error = 1;
+        goto done;
+    }
+    spec->channels = (Uint8) stream->wavefmt.channels;
     spec->samples = 4096;       /* Good default buffer size */
 
-    /* Read the audio data chunk */
-    *audio_buf = NULL;
-    do {
-        if (*audio_buf != NULL) {
-            SDL_free(*audio_buf);
-            *audio_buf = NULL;
+    /* Find the audio data chunk, skipping anything before it */
+    for (;;) {
+        if (ReadChunkHeader(src, &chunk) < 0) {
+            was_error = 1;
+            goto done;
         }
-        lenread = ReadChunk(src, &chunk);
-        if (lenread < 0) {
+        if (chunk.magic == DATA) {
+            break;
+        }
+        if (SDL_RWseek(src, chunk.length + (chunk.length & 1),
+                       RW_SEEK_CUR) < 0) {
+            SDL_Error(SDL_EFSEEK);
             was_error = 1;
             goto done;
         }
-        *audio_len = lenread;
-        *audio_buf = chunk.data;
-        if (chunk.magic != DATA)
-            headerDiff += lenread + 2 * sizeof(Uint32);
-    } while (chunk.magic != DATA);
-    headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
+    }
+    stream->data_start = SDL_RWtell(src);
 
-    if (MS_ADPCM_encoded) {
-        if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
+    /* Work out how much audio there is, only whole ADPCM blocks count */
+    stream->frame_size =
+        ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
+    if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
+        const Uint32 blocks = chunk.length / stream->wavefmt.blockalign;
+        if (blocks > 0xFFFFFFFF / stream->block_frames) {
+            SDL_SetError("WAVE file has too many sample frames");
             was_error = 1;
             goto done;
         }
-    }
-    if (IMA_ADPCM_encoded) {
-        if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
+        stream->frames = blocks * stream->block_frames;
+        stream->block = (Uint8 *) SDL_malloc(stream->wavefmt.blockalign);
+        stream->decoded = (Uint8 *)
+            SDL_malloc(stream->block_frames * stream->frame_size);
+        if (stream->block == NULL || stream->decoded == NULL) {
+            SDL_OutOfMemory();
             was_error = 1;
             goto done;
         }
+    } else {
+        stream->frames = chunk.length / stream->frame_size;
     }
 
-    /* Don't return a buffer that isn't a multiple of samplesize */
-    samplesize = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
-    *audio_len &= ~(samplesize - 1);
-
   done:
     if (format != NULL) {
         SDL_free(format);
     }
+    if (chunk.data != NULL) {
+        SDL_free(chunk.data);
+    }
+    if (was_error) {
+        if (stream != NULL) {
+            /* This closes the source if we were asked to */
+            SDL_CloseWAVStream(stream);
+        } else if (src && freesrc) {
+            SDL_RWclose(src);
+        }
+        stream = NULL;
+    }
+    return (stream);
+}
+
+int
+SDL_ReadWAVStream(SDL_WAVStream * stream, Uint8 * buf, int len)
+{
+    Uint32 frames, done;
+
+    if (stream == NULL) {
+        SDL_SetError("SDL_ReadWAVStream() passed a NULL stream");
+        return (-1);
+    }
+
+    if (buf == NULL || len < 0) {
+        SDL_SetError("Invalid audio buffer");
+        return (-1);
+    }
+
+    /* Only whole sample frames are handed out */
+    frames = (Uint32) len / stream->frame_size;
+    if (frames > stream->frames - stream->position) {
+        frames = stream->frames - stream->position;
+    }
+
+    if (stream->block == NULL) {
+        /* Plain PCM data goes straight into the caller's buffer */
+        done = (Uint32) SDL_RWread(stream->src, buf, stream->frame_size,
+                                   frames);
+        if (done < frames) {
+            /* The file is shorter than it claims */
+            stream->frames = stream->position + done;
+        }
+        stream->position += done;
+        return (int) (done * stream->frame_size);
+    }
+
+    for (done = 0; done < frames;) {
+        Uint32 cpy;
+
+        if (stream->decoded_pos == stream->decoded_len) {
+            int status = SDL_DecodeWAVBlock(stream);
+            if (status < 0) {
+                return (-1);
+            }
+            if (status == 0) {
+                /* The file is shorter than it claims */
+                stream->frames = stream->position;
+                break;
+            }
+        }
+        cpy = (stream->decoded_len - stream->decoded_pos) /
+            stream->frame_size;
+        if (cpy > frames - done) {
+            cpy = frames - done;
+        }
+        SDL_memcpy(buf, stream->decoded + stream->decoded_pos,
+                   cpy * stream->frame_size);
+        buf += cpy * stream->frame_size;
+        stream->decoded_pos += cpy * stream->frame_size;
+        stream->position += cpy;
+        done += cpy;
+    }
+    return (int) (done * stream->frame_size);
+}
+
+int
+SDL_SeekWAVStream(SDL_WAVStream * stream, Uint32 frame)
+{
+    long offset;
+
+    if (stream == NULL) {
+        SDL_SetError("SDL_SeekWAVStream() passed a NULL stream");
+        return (-1);
+    }
+    if (frame > stream->frames) {
+        SDL_SetError("Seek past the end of the WAVE data");
+        return (-1);
+    }
+
+    if (stream->block == NULL) {
+        offset = (long) (frame * stream->frame_size);
+    } else {
+        /* ADPCM blocks only decode from the start, so decode the one
+           the frame is in and skip ahead */
+        offset = (long) (frame / stream->block_frames) *
+            stream->wavefmt.blockalign;
+    }
+    if (SDL_RWseek(stream->src, stream->data_start + offset,
+                   RW_SEEK_SET) < 0) {
+        SDL_Error(SDL_EFSEEK);
+        return (-1);
+    }
+
+    stream->position = frame;
+    if (stream->block != NULL) {
+        stream->decoded_len = stream->decoded_pos = 0;
+        if (frame < stream->frames) {
+            if (SDL_DecodeWAVBlock(stream) <= 0) {
+                SDL_Error(SDL_EFREAD);
+                return (-1);
+            }
+            stream->decoded_pos =
+                (frame % stream->block_frames) * stream->frame_size;
+        }
+    }
+    return (0);
+}
+
+Uint32
+SDL_TellWAVStream(SDL_WAVStream * stream)
+{
+    return stream ? stream->position : 0;
+}
+
+Uint32
+SDL_GetWAVStreamLength(SDL_WAVStream * stream)
+{
+    return stream ? stream->frames : 0;
+}
+
+void
+SDL_CloseWAVStream(SDL_WAVStream * stream)
+{
+    if (stream == NULL) {
+        return;
+    }
+    if (stream->freesrc) {
+        SDL_RWclose(stream->src);
+    }
+    if (stream->block != NULL) {
+        SDL_free(stream->block);
+    }
+    if (stream->decoded != NULL) {
+        SDL_free(stream->decoded);
+    }
+    SDL_free(stream);
+}
+
+/* ADPCM blocks don't depend on each other, so SDL_LoadWAV_RW() can split
+   a long file between threads, each with its own copy of the decoder */
+typedef struct
+{
+    const SDL_WAVStream *stream;
+    union ADPCM_decoder decoder;
+    const Uint8 *encoded;
+    Uint8 *decoded;
+    Uint32 blocks;
+    int status;
+} SDL_WAVDecodeJob;
+
+/* Give each thread at least this many blocks to make it worthwhile */
+#define SDL_WAV_MIN_THREAD_BLOCKS   64
+
+static int SDLCALL
+SDL_WAVDecodeThread(void *data)
+{
+    SDL_WAVDecodeJob *job = (SDL_WAVDecodeJob *) data;
+
+    job->status = SDL_DecodeADPCM(job->stream, &job->decoder, job->encoded,
+                                  job->decoded, job->blocks);
+    return 0;
+}
+
+static SDL_Thread *
+SDL_CreateWAVDecodeThread(SDL_WAVDecodeJob * job)
+{
+    /* !!! FIXME: this is nasty. */
+#if (defined(__WIN32__) && !defined(_WIN32_WCE)) && !defined(HAVE_LIBC)
+#undef SDL_CreateThread
+    return SDL_CreateThread(SDL_WAVDecodeThread, "SDLWaveDecode", job, NULL, NULL);
+#else
+    return SDL_CreateThread(SDL_WAVDecodeThread, "SDLWaveDecode", job);
+#endif
+}
+
+/* How many threads to decode this many ADPCM blocks with */
+static int
+SDL_GetWAVDecodeThreads(Uint32 blocks)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_WAVE_THREADS);
+    int threads = 1;
+
+    if (hint) {
+        threads = SDL_atoi(hint);
+        if (threads == 0) {
+            threads = SDL_GetCPUCount();
+        }
+    }
+    if (threads < 1) {
+        threads = 1;
+    } else if ((Uint32) threads > blocks / SDL_WAV_MIN_THREAD_BLOCKS) {
+        threads = (int) (blocks / SDL_WAV_MIN_THREAD_BLOCKS);
+    }
+    return (threads > 1) ? threads : 1;
+}
+
+/* Decode all of the stream's ADPCM data into 'decoded' on several threads.
+   Returns the number of frames decoded, or -1 on error.
+ */
+static int
+SDL_DecodeWAVThreaded(SDL_WAVStream * stream, Uint8 * decoded, int threads)
+{
+    const Uint32 blockalign = stream->wavefmt.blockalign;
+    SDL_WAVDecodeJob *jobs;
+    SDL_Thread **thread;
+    Uint8 *encoded;
+    Uint32 blocks, first, per_thread;
+    int i, status = 0;
+
+    /* The encoded data is needed all at once for this */
+    blocks = stream->frames / stream->block_frames;
+    encoded = (Uint8 *) SDL_malloc(blocks * blockalign);
+    jobs = (SDL_WAVDecodeJob *) SDL_malloc(threads * sizeof(*jobs));
+    thread = (SDL_Thread **) SDL_malloc(threads * sizeof(*thread));
+    if (encoded == NULL || jobs == NULL || thread == NULL) {
+        SDL_Error(SDL_ENOMEM);
+        status = -1;
+        goto done;
+    }
+    blocks = (Uint32) SDL_RWread(stream->src, encoded, blockalign, blocks);
+
+    /* The last share is decoded on this thread while the others run */
+    per_thread = (blocks + threads - 1) / threads;
+    for (i = 0, first = 0; i < threads; ++i, first += per_thread) {
+        jobs[i].stream = stream;
+        jobs[i].decoder = stream->adpcm;
+        jobs[i].encoded = encoded + first * blockalign;
+        jobs[i].decoded = decoded + first * stream->block_frames *
+            stream->frame_size;
+        jobs[i].blocks = (first >= blocks) ? 0 :
+            SDL_min(per_thread, blocks - first);
+        jobs[i].status = 0;
+        thread[i] = NULL;
+        if (i < threads - 1) {
+            thread[i] = SDL_CreateWAVDecodeThread(&jobs[i]);
+        }
+        if (thread[i] == NULL) {
+            SDL_WAVDecodeThread(&jobs[i]);
+        }
+    }
+    for (i = 0; i < threads; ++i) {
+        if (thread[i] != NULL) {
+            SDL_WaitThread(thread[i], NULL);
+        }
+        if (jobs[i].status < 0) {
+            /* The decoder's error message stayed on the worker thread */
+            SDL_SetError("Corrupt ADPCM block");
+            status = -1;
+        }
+    }
+
+  done:
+    if (encoded != NULL) {
+        SDL_free(encoded);
+    }
+    if (jobs != NULL) {
+        SDL_free(jobs);
+    }
+    if (thread != NULL) {
+        SDL_free(thread);
+    }
+    if (status < 0) {
+        return (-1);
+    }
+    stream->frames = stream->position = blocks * stream->block_frames;
+    return (int) stream->frames;
+}
+
+SDL_AudioSpec *
+SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
+               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    SDL_WAVStream *stream;
+    Uint32 len;
+    int threads;
+    int was_error = 0;
+
+    /* We close the source ourselves, after seeking past the file */
+    stream = SDL_OpenWAVStream_RW(src, 0, spec);
+    if (stream == NULL) {
+        was_error = 1;
+        goto done;
+    }
+
+    /* Decode everything at once into a buffer of the final size, which
+       has to fit the int length the readers take */
+    if (stream->frames > 0x7FFFFFFF / stream->frame_size) {
+        SDL_SetError("WAVE file is too large to load at once");
+        was_error = 1;
+        goto done;
+    }
+    len = stream->frames * stream->frame_size;
+    *audio_buf = (Uint8 *) SDL_malloc(len);
+    if (*audio_buf == NULL && len > 0) {
+        SDL_Error(SDL_ENOMEM);
+        was_error = 1;
+        goto done;
+    }
+    threads = 1;
+    if (stream->block != NULL) {
+        threads = SDL_GetWAVDecodeThreads(stream->frames /
+                                          stream->block_frames);
+    }
+    if (threads > 1) {
+        if (SDL_DecodeWAVThreaded(stream, *audio_buf, threads) < 0) {
+            SDL_free(*audio_buf);
+            *audio_buf = NULL;
+            was_error = 1;
+            goto done;
+        }
+    } else if (len > 0 &&
+               SDL_ReadWAVStream(stream, *audio_buf, (int) len) < 0) {
+        SDL_free(*audio_buf);
+        *audio_buf = NULL;
+        was_error = 1;
+        goto done;
+    }
+    *audio_len = stream->frames * stream->frame_size;
+
+  done:
     if (src) {
         if (freesrc) {
             SDL_RWclose(src);
-        } else {
+        } else if (stream) {
             /* seek to the end of the file (given by the RIFF chunk) */
-            SDL_RWseek(src, wavelen - chunk.length - headerDiff, RW_SEEK_CUR);
+            SDL_RWseek(src, stream->riff_end, RW_SEEK_SET);
         }
     }
+    SDL_CloseWAVStream(stream);
     if (was_error) {
         spec = NULL;
     }
@@ -613,11 +1024,30 @@ SDL_FreeWAV(Uint8 * audio_buf)
     }
 }
 
+static int
+ReadChunkHeader(SDL_RWops * src, Chunk * chunk)
+{
+    Uint32 header[2];
+
+    if (SDL_RWread(src, header, sizeof(header), 1) != 1) {
+        SDL_Error(SDL_EFREAD);
+        return (-1);
+    }
+    chunk->magic = SDL_SwapLE32(header[0]);
+    chunk->length = SDL_SwapLE32(header[1]);
+    chunk->data = NULL;
+    return (0);
+}
+
 static int
 ReadChunk(SDL_RWops * src, Chunk * chunk)
 {
-    chunk->magic = SDL_ReadLE32(src);
-    chunk->length = SDL_ReadLE32(src);
+    if (ReadChunkHeader(src, chunk) < 0) {
+        return (-1);
+    }
+    if (chunk->length == 0) {
+        return (0);
+    }
     chunk->data = (Uint8 *) SDL_malloc(chunk->length);
     if (chunk->data == NULL) {
         SDL_Error(SDL_ENOMEM);
@@ -629,7 +1059,11 @@ ReadChunk(SDL_RWops * src, Chunk * chunk)
         chunk->data = NULL;
         return (-1);
     }
-    return (chunk->length);
+    /* Chunks are padded to an even length */
+    if (chunk->length & 1) {
+        SDL_RWseek(src, 1, RW_SEEK_CUR);
+    }
+    return (0);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
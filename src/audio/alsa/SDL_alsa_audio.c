@@ -28,7 +28,9 @@
 #include <signal.h>             /* For kill() */
 #include <errno.h>
 #include <string.h>
+#include <poll.h>
 
+#include "SDL_hints.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "../SDL_audiomem.h"
@@ -44,6 +46,8 @@ static int (*ALSA_snd_pcm_open)
 static int (*ALSA_snd_pcm_close) (snd_pcm_t * pcm);
 static snd_pcm_sframes_t(*ALSA_snd_pcm_writei)
   (snd_pcm_t *, const void *, snd_pcm_uframes_t);
+static snd_pcm_sframes_t(*ALSA_snd_pcm_readi)
+  (snd_pcm_t *, void *, snd_pcm_uframes_t);
 static int (*ALSA_snd_pcm_recover) (snd_pcm_t *, int, int);
 static int (*ALSA_snd_pcm_prepare) (snd_pcm_t *);
 static int (*ALSA_snd_pcm_drain) (snd_pcm_t *);
@@ -85,6 +89,19 @@ static int (*ALSA_snd_pcm_nonblock) (snd_pcm_t *, int);
 static int (*ALSA_snd_pcm_wait)(snd_pcm_t *, int);
 static int (*ALSA_snd_pcm_sw_params_set_avail_min)
   (snd_pcm_t *, snd_pcm_sw_params_t *, snd_pcm_uframes_t);
+static int (*ALSA_snd_pcm_mmap_begin)
+  (snd_pcm_t *, const snd_pcm_channel_area_t **, snd_pcm_uframes_t *,
+   snd_pcm_uframes_t *);
+static snd_pcm_sframes_t(*ALSA_snd_pcm_mmap_commit)
+  (snd_pcm_t *, snd_pcm_uframes_t, snd_pcm_uframes_t);
+static snd_pcm_sframes_t(*ALSA_snd_pcm_avail_update) (snd_pcm_t *);
+static snd_pcm_state_t(*ALSA_snd_pcm_state) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_start) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_poll_descriptors_count) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_poll_descriptors)
+  (snd_pcm_t *, struct pollfd *, unsigned int);
+static int (*ALSA_snd_pcm_poll_descriptors_revents)
+  (snd_pcm_t *, struct pollfd *, unsigned int, unsigned short *);
 
 #ifdef SDL_AUDIO_DRIVER_ALSA_DYNAMIC
 #define snd_pcm_hw_params_sizeof ALSA_snd_pcm_hw_params_sizeof
@@ -118,6 +135,7 @@ load_alsa_syms(void)
     SDL_ALSA_SYM(snd_pcm_open);
     SDL_ALSA_SYM(snd_pcm_close);
     SDL_ALSA_SYM(snd_pcm_writei);
+    SDL_ALSA_SYM(snd_pcm_readi);
     SDL_ALSA_SYM(snd_pcm_recover);
     SDL_ALSA_SYM(snd_pcm_prepare);
     SDL_ALSA_SYM(snd_pcm_drain);
@@ -144,6 +162,14 @@ load_alsa_syms(void)
     SDL_ALSA_SYM(snd_pcm_nonblock);
     SDL_ALSA_SYM(snd_pcm_wait);
     SDL_ALSA_SYM(snd_pcm_sw_params_set_avail_min);
+    SDL_ALSA_SYM(snd_pcm_mmap_begin);
+    SDL_ALSA_SYM(snd_pcm_mmap_commit);
+    SDL_ALSA_SYM(snd_pcm_avail_update);
+    SDL_ALSA_SYM(snd_pcm_state);
+    SDL_ALSA_SYM(snd_pcm_start);
+    SDL_ALSA_SYM(snd_pcm_poll_descriptors_count);
+    SDL_ALSA_SYM(snd_pcm_poll_descriptors);
+    SDL_ALSA_SYM(snd_pcm_poll_descriptors_revents);
     return 0;
 }
 
@@ -222,7 +248,45 @@ get_audio_device(int channels)
 static void
 ALSA_WaitDevice(_THIS)
 {
-    /* We're in blocking mode, so there's nothing to do here */
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const int timeout = (int) ((this->spec.samples * 4000) / this->spec.freq) + 1;
+
+    if (!h->mmap) {
+        /* We're in blocking mode, so there's nothing to do here */
+        return;
+    }
+
+    /* Sleep until the hardware has played out a whole period */
+    while (this->enabled) {
+        snd_pcm_sframes_t avail = ALSA_snd_pcm_avail_update(h->pcm_handle);
+        unsigned short revents;
+        int status;
+
+        if (avail < 0) {
+            status = ALSA_snd_pcm_recover(h->pcm_handle, (int) avail, 0);
+            if (status < 0) {
+                fprintf(stderr, "ALSA wait failed (unrecoverable): %s\n",
+                        ALSA_snd_strerror(status));
+                this->enabled = 0;
+                return;
+            }
+            continue;
+        }
+        if ((snd_pcm_uframes_t) avail >= this->spec.samples) {
+            return;
+        }
+
+        status = poll(h->pollfds, h->pollfd_count, timeout);
+        if (status < 0 && errno != EINTR) {
+            this->enabled = 0;
+            return;
+        }
+        if (status > 0) {
+            /* Let ALSA turn the raw events into PCM events */
+            ALSA_snd_pcm_poll_descriptors_revents(h->pcm_handle, h->pollfds,
+                                                  h->pollfd_count, &revents);
+        }
+    }
 }
 
 
@@ -233,7 +297,7 @@ ALSA_WaitDevice(_THIS)
  *  and for Windows DirectX [and CoreAudio], this is FL-FR-C-LFE-RL-RR"
  */
 #define SWIZ6(T) \
-    T *ptr = (T *) this->hidden->mixbuf; \
+    T *ptr = (T *) buf; \
     Uint32 i; \
     for (i = 0; i < this->spec.samples; i++, ptr += 6) { \
         T tmp; \
@@ -242,25 +306,25 @@ ALSA_WaitDevice(_THIS)
     }
 
 static __inline__ void
-swizzle_alsa_channels_6_64bit(_THIS)
+swizzle_alsa_channels_6_64bit(_THIS, void *buf)
 {
     SWIZ6(Uint64);
 }
 
 static __inline__ void
-swizzle_alsa_channels_6_32bit(_THIS)
+swizzle_alsa_channels_6_32bit(_THIS, void *buf)
 {
     SWIZ6(Uint32);
 }
 
 static __inline__ void
-swizzle_alsa_channels_6_16bit(_THIS)
+swizzle_alsa_channels_6_16bit(_THIS, void *buf)
 {
     SWIZ6(Uint16);
 }
 
 static __inline__ void
-swizzle_alsa_channels_6_8bit(_THIS)
+swizzle_alsa_channels_6_8bit(_THIS, void *buf)
 {
     SWIZ6(Uint8);
 }
@@ -269,28 +333,95 @@ swizzle_alsa_channels_6_8bit(_THIS)
 
 
 /*
- * Called right before feeding this->hidden->mixbuf to the hardware. Swizzle
+ * Called right before feeding a buffer to the hardware. Swizzle
  *  channels from Windows/Mac order to the format alsalib will want.
  */
 static __inline__ void
-swizzle_alsa_channels(_THIS)
+swizzle_alsa_channels(_THIS, void *buf)
 {
     if (this->spec.channels == 6) {
         const Uint16 fmtsize = (this->spec.format & 0xFF);      /* bits/channel. */
         if (fmtsize == 16)
-            swizzle_alsa_channels_6_16bit(this);
+            swizzle_alsa_channels_6_16bit(this, buf);
         else if (fmtsize == 8)
-            swizzle_alsa_channels_6_8bit(this);
+            swizzle_alsa_channels_6_8bit(this, buf);
         else if (fmtsize == 32)
-            swizzle_alsa_channels_6_32bit(this);
+            swizzle_alsa_channels_6_32bit(this, buf);
         else if (fmtsize == 64)
-            swizzle_alsa_channels_6_64bit(this);
+            swizzle_alsa_channels_6_64bit(this, buf);
     }
 
     /* !!! FIXME: update this for 7.1 if needed, later. */
 }
 
 
+/* Commit frames mixed in the hardware buffer, starting the PCM if needed */
+static int
+ALSA_mmap_commit(_THIS, snd_pcm_uframes_t offset, snd_pcm_uframes_t frames)
+{
+    snd_pcm_t *pcm_handle = this->hidden->pcm_handle;
+    snd_pcm_sframes_t status;
+
+    status = ALSA_snd_pcm_mmap_commit(pcm_handle, offset, frames);
+    if (status < 0 || (snd_pcm_uframes_t) status != frames) {
+        return ALSA_snd_pcm_recover(pcm_handle, status < 0 ? (int) status : -EPIPE, 0);
+    }
+    if (ALSA_snd_pcm_state(pcm_handle) == SND_PCM_STATE_PREPARED) {
+        return ALSA_snd_pcm_start(pcm_handle);
+    }
+    return 0;
+}
+
+static void
+ALSA_PlayDeviceMMap(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const int frame_size = (((int) (this->spec.format & 0xFF)) / 8) *
+                                this->spec.channels;
+    const Uint8 *sample_buf = h->mixbuf;
+    snd_pcm_uframes_t frames_left = ((snd_pcm_uframes_t) this->spec.samples);
+    int status;
+
+    if (h->mmap_buf) {
+        /* The callback mixed right into the hardware buffer */
+        swizzle_alsa_channels(this, h->mmap_buf);
+        status = ALSA_mmap_commit(this, h->mmap_offset, frames_left);
+        h->mmap_buf = NULL;
+        if (status < 0) {
+            fprintf(stderr, "ALSA commit failed (unrecoverable): %s\n",
+                    ALSA_snd_strerror(status));
+            this->enabled = 0;
+        }
+        return;
+    }
+
+    /* The period wasn't contiguous, copy it in pieces */
+    swizzle_alsa_channels(this, h->mixbuf);
+    while ( frames_left > 0 && this->enabled ) {
+        const snd_pcm_channel_area_t *areas;
+        snd_pcm_uframes_t offset, frames = frames_left;
+
+        ALSA_WaitDevice(this);
+        status = ALSA_snd_pcm_mmap_begin(h->pcm_handle, &areas, &offset, &frames);
+        if (status >= 0) {
+            SDL_memcpy((Uint8 *) areas[0].addr +
+                       (areas[0].first + offset * areas[0].step) / 8,
+                       sample_buf, frames * frame_size);
+            status = ALSA_mmap_commit(this, offset, frames);
+        } else {
+            status = ALSA_snd_pcm_recover(h->pcm_handle, status, 0);
+        }
+        if (status < 0) {
+            fprintf(stderr, "ALSA write failed (unrecoverable): %s\n",
+                    ALSA_snd_strerror(status));
+            this->enabled = 0;
+            return;
+        }
+        sample_buf += frames * frame_size;
+        frames_left -= frames;
+    }
+}
+
 static void
 ALSA_PlayDevice(_THIS)
 {
@@ -300,7 +431,12 @@ ALSA_PlayDevice(_THIS)
                                 this->spec.channels;
     snd_pcm_uframes_t frames_left = ((snd_pcm_uframes_t) this->spec.samples);
 
-    swizzle_alsa_channels(this);
+    if (this->hidden->mmap) {
+        ALSA_PlayDeviceMMap(this);
+        return;
+    }
+
+    swizzle_alsa_channels(this, this->hidden->mixbuf);
 
     while ( frames_left > 0 && this->enabled ) {
         /* !!! FIXME: This works, but needs more testing before going live */
@@ -333,9 +469,72 @@ ALSA_PlayDevice(_THIS)
 static Uint8 *
 ALSA_GetDeviceBuf(_THIS)
 {
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    if (h->mmap) {
+        const snd_pcm_channel_area_t *areas;
+        snd_pcm_uframes_t offset, frames = this->spec.samples;
+
+        /* Hand out the next period of the hardware buffer if it's in one
+           piece, which it always is when the buffer is whole periods */
+        h->mmap_buf = NULL;
+        if (ALSA_snd_pcm_mmap_begin(h->pcm_handle, &areas, &offset, &frames) >= 0 &&
+            frames == this->spec.samples) {
+            h->mmap_offset = offset;
+            h->mmap_buf = (Uint8 *) areas[0].addr +
+                (areas[0].first + offset * areas[0].step) / 8;
+            /* Don't let a callback that only mixes pick up stale samples */
+            SDL_memset(h->mmap_buf, this->spec.silence, this->spec.size);
+            return h->mmap_buf;
+        }
+    }
     return (this->hidden->mixbuf);
 }
 
+static int
+ALSA_CaptureFromDevice(_THIS, Uint8 ** buffer)
+{
+    int status;
+    Uint8 *sample_buf = this->hidden->mixbuf;
+    const int frame_size = (((int) (this->spec.format & 0xFF)) / 8) *
+                                this->spec.channels;
+    snd_pcm_uframes_t frames_left = ((snd_pcm_uframes_t) this->spec.samples);
+
+    /* We're in blocking mode, so this waits for a full period */
+    while ( frames_left > 0 && this->enabled ) {
+        status = ALSA_snd_pcm_readi(this->hidden->pcm_handle,
+                                    sample_buf, frames_left);
+
+        if (status < 0) {
+            if (status == -EAGAIN) {
+                SDL_Delay(1);
+                continue;
+            }
+            /* Recover from an overrun and keep filling the period */
+            status = ALSA_snd_pcm_recover(this->hidden->pcm_handle, status, 0);
+            if (status < 0) {
+                /* Hmm, not much we can do - abort */
+                fprintf(stderr, "ALSA read failed (unrecoverable): %s\n",
+                        ALSA_snd_strerror(status));
+                this->enabled = 0;
+                return 0;
+            }
+            continue;
+        }
+        sample_buf += status * frame_size;
+        frames_left -= status;
+    }
+    if (frames_left > 0) {
+        return 0;
+    }
+
+    /* The same swap puts the channels back in SDL's order */
+    swizzle_alsa_channels(this, this->hidden->mixbuf);
+
+    *buffer = this->hidden->mixbuf;
+    return this->hidden->mixlen;
+}
+
 static void
 ALSA_CloseDevice(_THIS)
 {
@@ -344,7 +543,15 @@ ALSA_CloseDevice(_THIS)
             SDL_FreeAudioMem(this->hidden->mixbuf);
             this->hidden->mixbuf = NULL;
         }
+        if (this->hidden->pollfds != NULL) {
+            SDL_free(this->hidden->pollfds);
+            this->hidden->pollfds = NULL;
+        }
         if (this->hidden->pcm_handle) {
+            if (this->hidden->mmap) {
+                /* Draining a non-blocking stream returns right away */
+                ALSA_snd_pcm_nonblock(this->hidden->pcm_handle, 0);
+            }
             ALSA_snd_pcm_drain(this->hidden->pcm_handle);
             ALSA_snd_pcm_close(this->hidden->pcm_handle);
             this->hidden->pcm_handle = NULL;
@@ -377,6 +584,7 @@ ALSA_finalize_hardware(_THIS, snd_pcm_hw_params_t *hwparams, int override)
 
     /* !!! FIXME: Is this safe to do? */
     this->spec.samples = bufsize / 2;
+    this->latency = (Uint32) bufsize;
 
     /* This is useful for debugging */
     if ( SDL_getenv("SDL_AUDIO_ALSA_DEBUG") ) {
@@ -466,6 +674,55 @@ ALSA_set_buffer_size(_THIS, snd_pcm_hw_params_t *params, int override)
     return ALSA_finalize_hardware(this, hwparams, override);
 }
 
+/* Use the period and buffer size in frames the application asked for */
+static int
+ALSA_set_hint_frames(_THIS, snd_pcm_hw_params_t *hwparams, const char *hint)
+{
+    const char *env;
+    int status;
+    snd_pcm_uframes_t persize, bufsize;
+
+    persize = (snd_pcm_uframes_t) SDL_atoi(hint);
+    if ( persize == 0 ) {
+        return(-1);
+    }
+    status = ALSA_snd_pcm_hw_params_set_period_size_near(
+                this->hidden->pcm_handle, hwparams, &persize, NULL);
+    if ( status < 0 ) {
+        return(status);
+    }
+
+    bufsize = persize * 2;
+    env = SDL_GetHint(SDL_HINT_AUDIO_ALSA_BUFFER_FRAMES);
+    if ( env && SDL_atoi(env) > 0 ) {
+        bufsize = (snd_pcm_uframes_t) SDL_atoi(env);
+    }
+    status = ALSA_snd_pcm_hw_params_set_buffer_size_near(
+                this->hidden->pcm_handle, hwparams, &bufsize);
+    if ( status < 0 ) {
+        return(status);
+    }
+
+    status = ALSA_snd_pcm_hw_params(this->hidden->pcm_handle, hwparams);
+    if ( status < 0 ) {
+        return(status);
+    }
+
+    /* The device may have rounded either size, use what it picked */
+    ALSA_snd_pcm_hw_params_get_period_size(hwparams, &persize, NULL);
+    ALSA_snd_pcm_hw_params_get_buffer_size(hwparams, &bufsize);
+    this->spec.samples = (Uint16) persize;
+    this->latency = (Uint32) bufsize;
+
+    if ( SDL_getenv("SDL_AUDIO_ALSA_DEBUG") ) {
+        fprintf(stderr,
+            "ALSA: period size = %lu, buffer size = %lu, %s access\n",
+            persize, bufsize, this->hidden->mmap ? "mmap" : "rw");
+    }
+
+    return(0);
+}
+
 static int
 ALSA_OpenDevice(_THIS, const char *devname, int iscapture)
 {
@@ -477,6 +734,7 @@ ALSA_OpenDevice(_THIS, const char *devname, int iscapture)
     SDL_AudioFormat test_format = 0;
     unsigned int rate = 0;
     unsigned int channels = 0;
+    const char *hint;
 
     /* Initialize all variables that we clean on shutdown */
     this->hidden = (struct SDL_PrivateAudioData *)
@@ -491,6 +749,7 @@ ALSA_OpenDevice(_THIS, const char *devname, int iscapture)
     /* Name of device should depend on # channels in spec */
     status = ALSA_snd_pcm_open(&pcm_handle,
                                get_audio_device(this->spec.channels),
+                               iscapture ? SND_PCM_STREAM_CAPTURE :
                                SND_PCM_STREAM_PLAYBACK, SND_PCM_NONBLOCK);
 
     if (status < 0) {
@@ -512,9 +771,19 @@ ALSA_OpenDevice(_THIS, const char *devname, int iscapture)
         return 0;
     }
 
-    /* SDL only uses interleaved sample output */
-    status = ALSA_snd_pcm_hw_params_set_access(pcm_handle, hwparams,
-                                               SND_PCM_ACCESS_RW_INTERLEAVED);
+    /* SDL only uses interleaved sample output. Playback can mix straight
+       into the hardware buffer if the application asked for it. */
+    status = -1;
+    hint = SDL_GetHint(SDL_HINT_AUDIO_ALSA_MMAP);
+    if (!iscapture && hint && SDL_atoi(hint)) {
+        status = ALSA_snd_pcm_hw_params_set_access(pcm_handle, hwparams,
+                                            SND_PCM_ACCESS_MMAP_INTERLEAVED);
+        this->hidden->mmap = (status >= 0);
+    }
+    if (status < 0) {
+        status = ALSA_snd_pcm_hw_params_set_access(pcm_handle, hwparams,
+                                            SND_PCM_ACCESS_RW_INTERLEAVED);
+    }
     if (status < 0) {
         ALSA_CloseDevice(this);
         SDL_SetError("ALSA: Couldn't set interleaved access: %s",
@@ -604,8 +873,17 @@ ALSA_OpenDevice(_THIS, const char *devname, int iscapture)
     this->spec.freq = rate;
 
     /* Set the buffer size, in samples */
-    if ( ALSA_set_period_size(this, hwparams, 0) < 0 &&
-         ALSA_set_buffer_size(this, hwparams, 0) < 0 ) {
+    hint = SDL_GetHint(SDL_HINT_AUDIO_ALSA_PERIOD_FRAMES);
+    if ( hint && SDL_atoi(hint) > 0 ) {
+        status = ALSA_set_hint_frames(this, hwparams, hint);
+        if ( status < 0 ) {
+            ALSA_CloseDevice(this);
+            SDL_SetError("ALSA: Couldn't set period size: %s",
+                         ALSA_snd_strerror(status));
+            return 0;
+        }
+    } else if ( ALSA_set_period_size(this, hwparams, 0) < 0 &&
+                ALSA_set_buffer_size(this, hwparams, 0) < 0 ) {
         /* Failed to set desired buffer size, do the best you can... */
         if ( ALSA_set_period_size(this, hwparams, 1) < 0 ) {
             ALSA_CloseDevice(this);
@@ -658,8 +936,25 @@ ALSA_OpenDevice(_THIS, const char *devname, int iscapture)
     }
     SDL_memset(this->hidden->mixbuf, this->spec.silence, this->spec.size);
 
-    /* Switch to blocking mode for playback */
-    ALSA_snd_pcm_nonblock(pcm_handle, 0);
+    if (this->hidden->mmap) {
+        /* Stay non-blocking, ALSA_WaitDevice() sleeps until a period is free */
+        int count = ALSA_snd_pcm_poll_descriptors_count(pcm_handle);
+        if (count > 0) {
+            this->hidden->pollfds = (struct pollfd *)
+                SDL_malloc(count * sizeof (struct pollfd));
+        }
+        if (this->hidden->pollfds == NULL) {
+            ALSA_CloseDevice(this);
+            SDL_OutOfMemory();
+            return 0;
+        }
+        this->hidden->pollfd_count =
+            ALSA_snd_pcm_poll_descriptors(pcm_handle, this->hidden->pollfds,
+                                          count);
+    } else {
+        /* Switch to blocking mode for playback and capture */
+        ALSA_snd_pcm_nonblock(pcm_handle, 0);
+    }
 
     /* We're ready to rock and roll. :-) */
     return 1;
@@ -683,9 +978,12 @@ ALSA_Init(SDL_AudioDriverImpl * impl)
     impl->WaitDevice = ALSA_WaitDevice;
     impl->GetDeviceBuf = ALSA_GetDeviceBuf;
     impl->PlayDevice = ALSA_PlayDevice;
+    impl->CaptureFromDevice = ALSA_CaptureFromDevice;
     impl->CloseDevice = ALSA_CloseDevice;
     impl->Deinitialize = ALSA_Deinitialize;
     impl->OnlyHasDefaultOutputDevice = 1;       /* !!! FIXME: Add device enum! */
+    impl->OnlyHasDefaultInputDevice = 1;
+    impl->HasCaptureSupport = 1;
 
     return 1;   /* this audio target is available. */
 }
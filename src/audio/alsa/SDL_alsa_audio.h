@@ -38,6 +38,16 @@ struct SDL_PrivateAudioData
     /* Raw mixing buffer */
     Uint8 *mixbuf;
     int mixlen;
+
+    /* With mmap access, the period being mixed in the hardware buffer,
+       or NULL if it wasn't contiguous and mixbuf is used instead */
+    int mmap;
+    Uint8 *mmap_buf;
+    snd_pcm_uframes_t mmap_offset;
+
+    /* Descriptors to sleep on until a period is free */
+    struct pollfd *pollfds;
+    int pollfd_count;
 };
 
 #endif /* _ALSA_PCM_audio_h */
@@ -22,7 +22,7 @@
 
 #if SDL_AUDIO_DRIVER_DISK
 
-/* Output raw audio data to a file. */
+/* Output raw audio data to a file, or capture it from one. */
 
 #if HAVE_STDIO_H
 #include <stdio.h>
@@ -38,8 +38,14 @@
 /* environment variables and defaults. */
 #define DISKENVR_OUTFILE         "SDL_DISKAUDIOFILE"
 #define DISKDEFAULT_OUTFILE      "sdlaudio.raw"
+#define DISKENVR_INFILE          "SDL_DISKAUDIOFILEIN"
+#define DISKDEFAULT_INFILE       "sdlaudio-in.raw"
 #define DISKENVR_WRITEDELAY      "SDL_DISKAUDIODELAY"
-#define DISKDEFAULT_WRITEDELAY   150
+#define DISKENVR_FAST            "SDL_DISKAUDIOFAST"
+#define DISKENVR_CHANNELS        "SDL_DISKAUDIOCHANNELS"
+
+/* Periods are written to the file in batches of about this many bytes */
+#define DISKDEFAULT_BATCHSIZE    (64 * 1024)
 
 static const char *
 DISKAUD_GetOutputFilename(const char *devname)
@@ -53,59 +59,340 @@ DISKAUD_GetOutputFilename(const char *devname)
     return devname;
 }
 
+static const char *
+DISKAUD_GetInputFilename(const char *devname)
+{
+    if (devname == NULL) {
+        devname = SDL_getenv(DISKENVR_INFILE);
+        if (devname == NULL) {
+            devname = DISKDEFAULT_INFILE;
+        }
+    }
+    return devname;
+}
+
+static Uint64
+DISKAUD_PeriodTicks(_THIS)
+{
+    return (this->spec.samples * this->hidden->ticks_per_sec) / this->spec.freq;
+}
+
+/* Sleep until the next period is due, as a sound card playing at the
+   device rate would.  The schedule is kept against the performance counter
+   rather than by adding up delays, so rounding never makes it drift.
+ */
+static void
+DISKAUD_WaitForPeriod(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    Uint64 deadline, now, jitter;
+
+    h->frames += this->spec.samples;
+    deadline = h->start_time + (h->frames * h->ticks_per_sec) / this->spec.freq;
+
+    now = SDL_GetPerformanceCounter();
+    if (now > deadline + DISKAUD_PeriodTicks(this)) {
+        /* We were paused or stalled, a real device would have run dry */
+        h->start_time = now;
+        h->frames = 0;
+        return;
+    }
+
+    while (now < deadline) {
+        Uint32 ms = (Uint32) (((deadline - now) * 1000) / h->ticks_per_sec);
+        /* Sleep most of the way, then yield until it's time */
+        SDL_Delay(ms > 1 ? ms - 1 : 0);
+        now = SDL_GetPerformanceCounter();
+    }
+
+    jitter = now - deadline;
+    h->jitter_total += jitter;
+    if (jitter > h->jitter_max) {
+        h->jitter_max = jitter;
+    }
+}
+
+/* Keep track of how long the audio thread took to produce a period */
+static void
+DISKAUD_RecordCallback(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    Uint64 duration;
+
+    if (h->wake_time == 0) {
+        /* Nothing to time against before the first wakeup, the device
+           may have sat paused since it was opened */
+        return;
+    }
+    duration = SDL_GetPerformanceCounter() - h->wake_time;
+
+    ++h->periods;
+    h->callback_total += duration;
+    if (duration > h->callback_max) {
+        h->callback_max = duration;
+    }
+    if (duration > DISKAUD_PeriodTicks(this)) {
+        ++h->late_periods;
+    }
+}
+
 /* This function waits until it is possible to write a full sound buffer */
 static void
 DISKAUD_WaitDevice(_THIS)
 {
-    SDL_Delay(this->hidden->write_delay);
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    if (h->fixed_delay) {
+        SDL_Delay(h->write_delay);
+    } else if (!h->fast) {
+        DISKAUD_WaitForPeriod(this);
+    }
+    h->wake_time = SDL_GetPerformanceCounter();
+}
+
+/* Write the batch out from a separate thread, so file I/O never holds up
+   the audio thread unless the disk falls a whole batch behind.
+ */
+static int SDLCALL
+DISKAUD_WriterThread(void *_this)
+{
+    SDL_AudioDevice *this = (SDL_AudioDevice *) _this;
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    SDL_LockMutex(h->lock);
+    for (;;) {
+        Uint8 *buf;
+        Uint32 len;
+
+        while (h->pending == NULL && !h->shutdown) {
+            SDL_CondWait(h->cond, h->lock);
+        }
+        if (h->pending == NULL) {
+            break;
+        }
+        buf = h->pending;
+        len = h->pending_len;
+        h->pending = NULL;
+        SDL_UnlockMutex(h->lock);
+
+        len -= (Uint32) SDL_RWwrite(h->io, buf, 1, len);
+
+        SDL_LockMutex(h->lock);
+        if (len != 0) {
+            h->write_error = 1;
+        }
+        h->spare = buf;
+        SDL_CondBroadcast(h->cond);
+    }
+    SDL_UnlockMutex(h->lock);
+    return 0;
+}
+
+/* Hand the current batch to the writer thread and start filling the spare */
+static int
+DISKAUD_FlushBatch(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    int status = 0;
+
+    if (h->batch_fill == 0) {
+        return 0;
+    }
+
+    if (h->writer == NULL) {
+        if (SDL_RWwrite(h->io, h->batch, 1, h->batch_fill) != h->batch_fill) {
+            status = -1;
+        }
+        h->batch_fill = 0;
+        return status;
+    }
+
+    SDL_LockMutex(h->lock);
+    while (h->spare == NULL && !h->write_error) {
+        SDL_CondWait(h->cond, h->lock);
+    }
+    if (h->write_error) {
+        status = -1;
+    } else {
+        h->pending = h->batch;
+        h->pending_len = h->batch_fill;
+        h->batch = h->spare;
+        h->spare = NULL;
+        SDL_CondBroadcast(h->cond);
+    }
+    SDL_UnlockMutex(h->lock);
+
+    h->batch_fill = 0;
+    return status;
 }
 
 static void
 DISKAUD_PlayDevice(_THIS)
 {
-    size_t written;
+    struct SDL_PrivateAudioData *h = this->hidden;
 
-    /* Write the audio data */
-    written = SDL_RWwrite(this->hidden->output,
-                          this->hidden->mixbuf, 1, this->hidden->mixlen);
+    DISKAUD_RecordCallback(this);
 
-    /* If we couldn't write, assume fatal error for now */
-    if (written != this->hidden->mixlen) {
-        this->enabled = 0;
+    /* The period was mixed in place, write the batch once it's full */
+    h->batch_fill += h->mixlen;
+    if (h->batch_fill + h->mixlen > h->batch_len) {
+        /* If we couldn't write, assume fatal error for now */
+        if (DISKAUD_FlushBatch(this) < 0) {
+            this->enabled = 0;
+        }
     }
 #ifdef DEBUG_AUDIO
-    fprintf(stderr, "Wrote %d bytes of audio data\n", written);
+    fprintf(stderr, "Wrote %d bytes of audio data\n", h->mixlen);
 #endif
 }
 
 static Uint8 *
 DISKAUD_GetDeviceBuf(_THIS)
 {
-    return (this->hidden->mixbuf);
+    return (this->hidden->batch + this->hidden->batch_fill);
+}
+
+static int
+DISKAUD_CaptureFromDevice(_THIS, Uint8 ** buffer)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    size_t br;
+
+    /* The callback ran since the last buffer was handed out */
+    DISKAUD_RecordCallback(this);
+
+    /* Pace ourselves like a real device would */
+    DISKAUD_WaitDevice(this);
+
+    /* Read straight into the buffer the callback will get */
+    br = SDL_RWread(h->io, h->mixbuf, 1, h->mixlen);
+    if (br == 0) {
+        /* End of the file, the device is done */
+        this->enabled = 0;
+        return 0;
+    }
+    if (br < h->mixlen) {
+        SDL_memset(h->mixbuf + br, this->spec.silence, h->mixlen - br);
+    }
+
+    *buffer = h->mixbuf;
+    h->wake_time = SDL_GetPerformanceCounter();
+    return h->mixlen;
+}
+
+static void
+DISKAUD_ReportStats(_THIS)
+{
+#if HAVE_STDIO_H
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const double usec = 1000000.0 / (double) h->ticks_per_sec;
+
+    if (h->periods == 0) {
+        return;
+    }
+    fprintf(stderr,
+            "SDL disk audio: %u periods of %u frames, %u late\n"
+            " callback: avg %.0f usec, max %.0f usec, period %.0f usec\n",
+            h->periods, this->spec.samples, h->late_periods,
+            (h->callback_total * usec) / h->periods, h->callback_max * usec,
+            DISKAUD_PeriodTicks(this) * usec);
+    if (!h->fast && !h->fixed_delay) {
+        fprintf(stderr,
+                " wakeup jitter: avg %.0f usec, max %.0f usec\n",
+                (h->jitter_total * usec) / h->periods, h->jitter_max * usec);
+    }
+#endif
 }
 
 static void
 DISKAUD_CloseDevice(_THIS)
 {
     if (this->hidden != NULL) {
+        DISKAUD_ReportStats(this);
+        if (this->hidden->batch != NULL) {
+            /* Write out whatever is left and let the writer finish */
+            DISKAUD_FlushBatch(this);
+        }
+        if (this->hidden->writer != NULL) {
+            SDL_LockMutex(this->hidden->lock);
+            this->hidden->shutdown = 1;
+            SDL_CondBroadcast(this->hidden->cond);
+            SDL_UnlockMutex(this->hidden->lock);
+            SDL_WaitThread(this->hidden->writer, NULL);
+            this->hidden->writer = NULL;
+        }
+        if (this->hidden->cond != NULL) {
+            SDL_DestroyCond(this->hidden->cond);
+            this->hidden->cond = NULL;
+        }
+        if (this->hidden->lock != NULL) {
+            SDL_DestroyMutex(this->hidden->lock);
+            this->hidden->lock = NULL;
+        }
+        if (this->hidden->batch != NULL) {
+            SDL_free(this->hidden->batch);
+            this->hidden->batch = NULL;
+        }
+        if (this->hidden->spare != NULL) {
+            SDL_free(this->hidden->spare);
+            this->hidden->spare = NULL;
+        }
         if (this->hidden->mixbuf != NULL) {
             SDL_FreeAudioMem(this->hidden->mixbuf);
             this->hidden->mixbuf = NULL;
         }
-        if (this->hidden->output != NULL) {
-            SDL_RWclose(this->hidden->output);
-            this->hidden->output = NULL;
+        if (this->hidden->io != NULL) {
+            SDL_RWclose(this->hidden->io);
+            this->hidden->io = NULL;
         }
         SDL_free(this->hidden);
         this->hidden = NULL;
     }
 }
 
+static int
+DISKAUD_StartWriter(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    Uint32 periods = DISKDEFAULT_BATCHSIZE / h->mixlen;
+
+    if (periods == 0) {
+        periods = 1;
+    }
+    h->batch_len = periods * h->mixlen;
+    h->batch = (Uint8 *) SDL_malloc(h->batch_len);
+    h->spare = (Uint8 *) SDL_malloc(h->batch_len);
+    if (h->batch == NULL || h->spare == NULL) {
+        SDL_OutOfMemory();
+        return -1;
+    }
+
+    /* Without threads, batches are written by the audio thread itself */
+    h->lock = SDL_CreateMutex();
+    h->cond = SDL_CreateCond();
+    if (h->lock == NULL || h->cond == NULL) {
+        return 0;
+    }
+/* !!! FIXME: this is nasty. */
+#if (defined(__WIN32__) && !defined(_WIN32_WCE)) && !defined(HAVE_LIBC)
+#undef SDL_CreateThread
+    h->writer = SDL_CreateThread(DISKAUD_WriterThread, "SDLDiskAudioWriter",
+                                 this, NULL, NULL);
+#else
+    h->writer = SDL_CreateThread(DISKAUD_WriterThread, "SDLDiskAudioWriter",
+                                 this);
+#endif
+    return 0;
+}
+
 static int
 DISKAUD_OpenDevice(_THIS, const char *devname, int iscapture)
 {
     const char *envr = SDL_getenv(DISKENVR_WRITEDELAY);
-    const char *fname = DISKAUD_GetOutputFilename(devname);
+    const char *fast = SDL_getenv(DISKENVR_FAST);
+    const char *channels = SDL_getenv(DISKENVR_CHANNELS);
+    const char *fname = iscapture ? DISKAUD_GetInputFilename(devname)
+                                  : DISKAUD_GetOutputFilename(devname);
 
     this->hidden = (struct SDL_PrivateAudioData *)
         SDL_malloc(sizeof(*this->hidden));
@@ -116,28 +403,48 @@ DISKAUD_OpenDevice(_THIS, const char *devname, int iscapture)
     SDL_memset(this->hidden, 0, sizeof(*this->hidden));
 
     /* Open the audio device */
-    this->hidden->output = SDL_RWFromFile(fname, "wb");
-    if (this->hidden->output == NULL) {
+    this->hidden->io = SDL_RWFromFile(fname, iscapture ? "rb" : "wb");
+    if (this->hidden->io == NULL) {
         DISKAUD_CloseDevice(this);
         return 0;
     }
 
-    /* Allocate mixing buffer */
-    this->hidden->mixbuf = (Uint8 *) SDL_AllocAudioMem(this->hidden->mixlen);
-    if (this->hidden->mixbuf == NULL) {
+    /* The file may hold a different channel count than the application
+       asked for, in which case the audio is converted on the way */
+    if (channels && SDL_atoi(channels) > 0) {
+        this->spec.channels = (Uint8) SDL_atoi(channels);
+        SDL_CalculateAudioSpec(&this->spec);
+    }
+
+    this->hidden->mixlen = this->spec.size;
+    if (iscapture) {
+        /* Allocate the buffer we read into */
+        this->hidden->mixbuf = (Uint8 *) SDL_AllocAudioMem(this->hidden->mixlen);
+        if (this->hidden->mixbuf == NULL) {
+            DISKAUD_CloseDevice(this);
+            SDL_OutOfMemory();
+            return 0;
+        }
+    } else if (DISKAUD_StartWriter(this) < 0) {
         DISKAUD_CloseDevice(this);
         return 0;
     }
-    SDL_memset(this->hidden->mixbuf, this->spec.silence, this->spec.size);
 
-    this->hidden->mixlen = this->spec.size;
-    this->hidden->write_delay =
-        (envr) ? SDL_atoi(envr) : DISKDEFAULT_WRITEDELAY;
+    /* A fixed delay per buffer overrides pacing at the device rate */
+    if (envr) {
+        this->hidden->fixed_delay = 1;
+        this->hidden->write_delay = SDL_atoi(envr);
+    }
+    this->hidden->fast = (fast && SDL_atoi(fast));
+    this->hidden->ticks_per_sec = SDL_GetPerformanceFrequency();
+    this->hidden->start_time = SDL_GetPerformanceCounter();
 
 #if HAVE_STDIO_H
     fprintf(stderr,
-            "WARNING: You are using the SDL disk writer audio driver!\n"
-            " Writing to file [%s].\n", fname);
+            "WARNING: You are using the SDL disk %s audio driver!\n"
+            " %s file [%s]%s.\n", iscapture ? "reader" : "writer",
+            iscapture ? "Reading from" : "Writing to", fname,
+            this->hidden->fast ? " as fast as possible" : "");
 #endif
 
     /* We're ready to rock and roll. :-) */
@@ -152,7 +459,9 @@ DISKAUD_Init(SDL_AudioDriverImpl * impl)
     impl->WaitDevice = DISKAUD_WaitDevice;
     impl->PlayDevice = DISKAUD_PlayDevice;
     impl->GetDeviceBuf = DISKAUD_GetDeviceBuf;
+    impl->CaptureFromDevice = DISKAUD_CaptureFromDevice;
     impl->CloseDevice = DISKAUD_CloseDevice;
+    impl->HasCaptureSupport = 1;
 
     return 1;   /* this audio target is available. */
 }
@@ -24,6 +24,8 @@
 #define _SDL_diskaudio_h
 
 #include "SDL_rwops.h"
+#include "SDL_thread.h"
+#include "SDL_mutex.h"
 #include "../SDL_sysaudio.h"
 
 /* Hidden "this" pointer for the audio functions */
@@ -32,10 +34,40 @@
 struct SDL_PrivateAudioData
 {
     /* The file descriptor for the audio device */
-    SDL_RWops *output;
+    SDL_RWops *io;
     Uint8 *mixbuf;
     Uint32 mixlen;
     Uint32 write_delay;
+    int fixed_delay;
+    int fast;
+
+    /* Pacing against the performance counter */
+    Uint64 ticks_per_sec;
+    Uint64 start_time;
+    Uint64 wake_time;
+    Uint64 frames;
+
+    /* Playback fills one batch of periods while the writer thread
+       writes the other one out */
+    SDL_Thread *writer;
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    Uint8 *batch;
+    Uint32 batch_len;
+    Uint32 batch_fill;
+    Uint8 *spare;
+    Uint8 *pending;
+    Uint32 pending_len;
+    int write_error;
+    int shutdown;
+
+    /* Statistics reported when the device is closed */
+    Uint32 periods;
+    Uint32 late_periods;
+    Uint64 callback_total;
+    Uint64 callback_max;
+    Uint64 jitter_total;
+    Uint64 jitter_max;
 };
 
 #endif /* _SDL_diskaudio_h */
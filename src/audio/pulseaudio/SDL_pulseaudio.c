@@ -94,10 +94,15 @@ static pa_stream * (*PULSEAUDIO_pa_stream_new) (pa_context *, const char *,
     const pa_sample_spec *, const pa_channel_map *);
 static int (*PULSEAUDIO_pa_stream_connect_playback) (pa_stream *, const char *,
     const pa_buffer_attr *, pa_stream_flags_t, pa_cvolume *, pa_stream *);
+static int (*PULSEAUDIO_pa_stream_connect_record) (pa_stream *, const char *,
+    const pa_buffer_attr *, pa_stream_flags_t);
 static pa_stream_state_t (*PULSEAUDIO_pa_stream_get_state) (pa_stream *);
 static size_t (*PULSEAUDIO_pa_stream_writable_size) (pa_stream *);
+static size_t (*PULSEAUDIO_pa_stream_readable_size) (pa_stream *);
 static int (*PULSEAUDIO_pa_stream_write) (pa_stream *, const void *, size_t,
     pa_free_cb_t, int64_t, pa_seek_mode_t);
+static int (*PULSEAUDIO_pa_stream_peek) (pa_stream *, const void **, size_t *);
+static int (*PULSEAUDIO_pa_stream_drop) (pa_stream *);
 static pa_operation * (*PULSEAUDIO_pa_stream_drain) (pa_stream *,
     pa_stream_success_cb_t, void *);
 static int (*PULSEAUDIO_pa_stream_disconnect) (pa_stream *);
@@ -193,9 +198,13 @@ load_pulseaudio_syms(void)
     SDL_PULSEAUDIO_SYM(pa_context_unref);
     SDL_PULSEAUDIO_SYM(pa_stream_new);
     SDL_PULSEAUDIO_SYM(pa_stream_connect_playback);
+    SDL_PULSEAUDIO_SYM(pa_stream_connect_record);
     SDL_PULSEAUDIO_SYM(pa_stream_get_state);
     SDL_PULSEAUDIO_SYM(pa_stream_writable_size);
+    SDL_PULSEAUDIO_SYM(pa_stream_readable_size);
     SDL_PULSEAUDIO_SYM(pa_stream_write);
+    SDL_PULSEAUDIO_SYM(pa_stream_peek);
+    SDL_PULSEAUDIO_SYM(pa_stream_drop);
     SDL_PULSEAUDIO_SYM(pa_stream_drain);
     SDL_PULSEAUDIO_SYM(pa_stream_disconnect);
     SDL_PULSEAUDIO_SYM(pa_stream_unref);
@@ -235,6 +244,65 @@ PULSEAUDIO_PlayDevice(_THIS)
     }
 }
 
+static int
+PULSEAUDIO_CaptureFromDevice(_THIS, Uint8 ** buffer)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const void *data;
+    size_t nbytes, cpy;
+    int filled = 0;
+
+    while (this->enabled) {
+        /* Give a fragment back once everything in it has been used */
+        if (h->capturebuf && (h->capturepos == h->capturelen)) {
+            PULSEAUDIO_pa_stream_drop(h->stream);
+            h->capturebuf = NULL;
+        }
+
+        if (h->capturebuf == NULL) {
+            if (PULSEAUDIO_pa_context_get_state(h->context) != PA_CONTEXT_READY ||
+                PULSEAUDIO_pa_stream_get_state(h->stream) != PA_STREAM_READY) {
+                this->enabled = 0;
+                return 0;
+            }
+            if (PULSEAUDIO_pa_stream_readable_size(h->stream) == 0) {
+                /* Wait for the server to send us more */
+                if (PULSEAUDIO_pa_mainloop_iterate(h->mainloop, 1, NULL) < 0) {
+                    this->enabled = 0;
+                    return 0;
+                }
+                continue;
+            }
+            if (PULSEAUDIO_pa_stream_peek(h->stream, &data, &nbytes) < 0) {
+                this->enabled = 0;
+                return 0;
+            }
+            if (data == NULL) {
+                /* Either nothing yet, or a hole we can only skip */
+                if (nbytes > 0) {
+                    PULSEAUDIO_pa_stream_drop(h->stream);
+                }
+                continue;
+            }
+            h->capturebuf = (const Uint8 *) data;
+            h->capturelen = nbytes;
+            h->capturepos = 0;
+        }
+
+        /* The server's fragment is read-only, gather a period in our own
+           buffer so the callback is free to modify it */
+        cpy = SDL_min(h->capturelen - h->capturepos, (size_t) (h->mixlen - filled));
+        SDL_memcpy(h->mixbuf + filled, h->capturebuf + h->capturepos, cpy);
+        h->capturepos += cpy;
+        filled += (int) cpy;
+        if (filled == h->mixlen) {
+            *buffer = h->mixbuf;
+            return h->mixlen;
+        }
+    }
+    return 0;
+}
+
 static void
 stream_drain_complete(pa_stream *s, int success, void *userdata)
 {
@@ -389,6 +457,8 @@ PULSEAUDIO_OpenDevice(_THIS, const char *devname, int iscapture)
     paattr.maxlength = h->mixlen*2;
     paattr.minreq = h->mixlen;
 #endif
+    /* Capture gets data in fragments of one buffer, when the server can */
+    paattr.fragsize = h->mixlen;
 
     /* The SDL ALSA output hints us that we use Windows' channel mapping */
     /* http://bugzilla.libsdl.org/show_bug.cgi?id=110 */
@@ -444,8 +514,15 @@ PULSEAUDIO_OpenDevice(_THIS, const char *devname, int iscapture)
         return 0;
     }
 
-    if (PULSEAUDIO_pa_stream_connect_playback(h->stream, NULL, &paattr, flags,
-            NULL, NULL) < 0) {
+    if (iscapture) {
+        if (PULSEAUDIO_pa_stream_connect_record(h->stream, NULL, &paattr,
+                                                flags) < 0) {
+            PULSEAUDIO_CloseDevice(this);
+            SDL_SetError("Could not connect PulseAudio stream");
+            return 0;
+        }
+    } else if (PULSEAUDIO_pa_stream_connect_playback(h->stream, NULL, &paattr,
+                                                     flags, NULL, NULL) < 0) {
         PULSEAUDIO_CloseDevice(this);
         SDL_SetError("Could not connect PulseAudio stream");
         return 0;
@@ -489,10 +566,13 @@ PULSEAUDIO_Init(SDL_AudioDriverImpl * impl)
     impl->PlayDevice = PULSEAUDIO_PlayDevice;
     impl->WaitDevice = PULSEAUDIO_WaitDevice;
     impl->GetDeviceBuf = PULSEAUDIO_GetDeviceBuf;
+    impl->CaptureFromDevice = PULSEAUDIO_CaptureFromDevice;
     impl->CloseDevice = PULSEAUDIO_CloseDevice;
     impl->WaitDone = PULSEAUDIO_WaitDone;
     impl->Deinitialize = PULSEAUDIO_Deinitialize;
     impl->OnlyHasDefaultOutputDevice = 1;
+    impl->OnlyHasDefaultInputDevice = 1;
+    impl->HasCaptureSupport = 1;
 
     return 1;   /* this audio target is available. */
 }
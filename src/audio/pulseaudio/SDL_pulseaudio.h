@@ -41,6 +41,11 @@ struct SDL_PrivateAudioData
     /* Raw mixing buffer */
     Uint8 *mixbuf;
     int mixlen;
+
+    /* The fragment being captured from, kept until it's used up */
+    const Uint8 *capturebuf;
+    size_t capturelen;
+    size_t capturepos;
 };
 
 #endif /* _SDL_pulseaudio_h */
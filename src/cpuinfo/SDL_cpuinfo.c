@@ -54,6 +54,8 @@
 #define CPU_HAS_SSE3    0x00000040
 #define CPU_HAS_SSE41   0x00000100
 #define CPU_HAS_SSE42   0x00000200
+#define CPU_HAS_AVX     0x00000400
+#define CPU_HAS_AVX2    0x00000800
 
 #if SDL_ALTIVEC_BLITTERS && HAVE_SETJMP && !__MACOSX__ && !__OpenBSD__
 /* This is the brute force way of detecting instruction sets...
@@ -167,7 +169,7 @@ done:
 "        cpuid              \n" \
 "        movl %%ebx, %%esi  \n" \
 "        popl %%ebx         \n" : \
-            "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func))
+            "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func), "c" (0))
 #elif defined(__GNUC__) && defined(__x86_64__)
 #define cpuid(func, a, b, c, d) \
     __asm__ __volatile__ ( \
@@ -175,11 +177,12 @@ done:
 "        cpuid              \n" \
 "        movq %%rbx, %%rsi  \n" \
 "        popq %%rbx         \n" : \
-            "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func))
+            "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func), "c" (0))
 #elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
 #define cpuid(func, a, b, c, d) \
     __asm { \
         __asm mov eax, func \
+        __asm xor ecx, ecx \
         __asm cpuid \
         __asm mov a, eax \
         __asm mov b, ebx \
@@ -328,6 +331,58 @@ CPU_haveSSE42(void)
     return 0;
 }
 
+/* AVX needs the OS to save the YMM registers, which XGETBV tells us */
+static __inline__ int
+CPU_OSSavesYMM(void)
+{
+    int a = 0, d = 0;
+#if defined(__GNUC__) && (defined(i386) || defined(__x86_64__))
+    __asm__ __volatile__ (".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d) : "c" (0));
+#elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
+    __asm {
+        xor ecx, ecx
+        _emit 0x0f
+        _emit 0x01
+        _emit 0xd0
+        mov a, eax
+    }
+#endif
+    return ((a & 0x6) == 0x6);
+}
+
+static __inline__ int
+CPU_haveAVX(void)
+{
+    if (CPU_haveCPUID()) {
+        int a, b, c, d;
+
+        cpuid(0, a, b, c, d);
+        if (a >= 1) {
+            cpuid(1, a, b, c, d);
+            /* AVX and OSXSAVE */
+            if ((c & 0x18000000) == 0x18000000) {
+                return CPU_OSSavesYMM();
+            }
+        }
+    }
+    return 0;
+}
+
+static __inline__ int
+CPU_haveAVX2(void)
+{
+    if (CPU_haveAVX()) {
+        int a, b, c, d;
+
+        cpuid(0, a, b, c, d);
+        if (a >= 7) {
+            cpuid(7, a, b, c, d);
+            return (b & 0x00000020);
+        }
+    }
+    return 0;
+}
+
 static int SDL_CPUCount = 0;
 
 int
@@ -522,6 +577,12 @@ SDL_GetCPUFeatures(void)
         if (CPU_haveSSE42()) {
             SDL_CPUFeatures |= CPU_HAS_SSE42;
         }
+        if (CPU_haveAVX()) {
+            SDL_CPUFeatures |= CPU_HAS_AVX;
+        }
+        if (CPU_haveAVX2()) {
+            SDL_CPUFeatures |= CPU_HAS_AVX2;
+        }
     }
     return SDL_CPUFeatures;
 }
@@ -607,6 +668,24 @@ SDL_HasSSE42(void)
     return SDL_FALSE;
 }
 
+SDL_bool
+SDL_HasAVX(void)
+{
+    if (SDL_GetCPUFeatures() & CPU_HAS_AVX) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+SDL_bool
+SDL_HasAVX2(void)
+{
+    if (SDL_GetCPUFeatures() & CPU_HAS_AVX2) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 #ifdef TEST_MAIN
 
 #include <stdio.h>
@@ -627,6 +706,8 @@ main()
     printf("SSE3: %d\n", SDL_HasSSE3());
     printf("SSE4.1: %d\n", SDL_HasSSE41());
     printf("SSE4.2: %d\n", SDL_HasSSE42());
+    printf("AVX: %d\n", SDL_HasAVX());
+    printf("AVX2: %d\n", SDL_HasAVX2());
     return 0;
 }
 
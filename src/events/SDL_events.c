@@ -33,6 +33,23 @@
 #endif
 #include "../video/SDL_sysvideo.h"
 
+/* Threads waiting for events sleep on a file descriptor that gets
+   signaled when an event is posted, where the platform has one.
+ */
+#if defined(__LINUX__) && !defined(__ANDROID__)
+#define SDL_EVENT_WAKEUP_EVENTFD
+#include <sys/eventfd.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define SDL_EVENT_WAKEUP_PIPE
+#include <fcntl.h>
+#endif
+#if defined(SDL_EVENT_WAKEUP_EVENTFD) || defined(SDL_EVENT_WAKEUP_PIPE)
+#define SDL_EVENT_WAKEUP
+#include <errno.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
 /* Public data -- the event filter */
 SDL_EventFilter SDL_EventOK = NULL;
 void *SDL_EventOKParam;
@@ -53,16 +70,55 @@ static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static Uint32 SDL_userevents = SDL_USEREVENT;
 
 /* Private data -- event queue */
-#define MAXEVENTS	128
+#define SDL_MAX_QUEUED_EVENTS   65535
+
+/* Events posted from any thread land in a lock-free ring first, and are
+   moved into the ordered queue by whoever next takes the queue lock.
+   The number of pending entries must be a power of 2.
+ */
+#define SDL_MAX_PENDING_EVENTS  256
+#define SDL_PENDING_WRAP_MASK   (SDL_MAX_PENDING_EVENTS-1)
+
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_PendingEvent;
+
+typedef struct _SDL_EventEntry
+{
+    SDL_Event event;
+    SDL_SysWMmsg msg;
+    struct _SDL_EventEntry *prev;
+    struct _SDL_EventEntry *next;
+} SDL_EventEntry;
+
 static struct
 {
+    SDL_PendingEvent pending[SDL_MAX_PENDING_EVENTS];
+
+    char cache_pad1[SDL_CACHELINE_SIZE-((sizeof(SDL_PendingEvent)*SDL_MAX_PENDING_EVENTS)%SDL_CACHELINE_SIZE)];
+
+    SDL_atomic_t enqueue_pos;
+
+    char cache_pad2[SDL_CACHELINE_SIZE-sizeof(SDL_atomic_t)];
+
+    SDL_atomic_t dequeue_pos;
+
+    char cache_pad3[SDL_CACHELINE_SIZE-sizeof(SDL_atomic_t)];
+
+    /* Everything below is only touched with the queue locked */
     SDL_mutex *lock;
-    int active;
-    int head;
-    int tail;
-    SDL_Event event[MAXEVENTS];
-    int wmmsg_next;
-    struct SDL_SysWMmsg wmmsg[MAXEVENTS];
+    volatile SDL_bool active;
+    int count;
+    SDL_EventEntry *head;
+    SDL_EventEntry *tail;
+    SDL_EventEntry *free;
+
+    /* Wakeup state for SDL_WaitEventTimeout() */
+    SDL_atomic_t waiting;
+    SDL_atomic_t wakeup_sent;
+    int wakeup_fd[2];
 } SDL_EventQ;
 
 
@@ -79,22 +135,159 @@ SDL_ShouldPollJoystick()
     return SDL_FALSE;
 }
 
+static void
+SDL_CreateEventWakeup(void)
+{
+    SDL_EventQ.wakeup_fd[0] = -1;
+    SDL_EventQ.wakeup_fd[1] = -1;
+#if defined(SDL_EVENT_WAKEUP_EVENTFD)
+    SDL_EventQ.wakeup_fd[0] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    SDL_EventQ.wakeup_fd[1] = SDL_EventQ.wakeup_fd[0];
+#elif defined(SDL_EVENT_WAKEUP_PIPE)
+    if (pipe(SDL_EventQ.wakeup_fd) == 0) {
+        int i;
+        for (i = 0; i < 2; ++i) {
+            fcntl(SDL_EventQ.wakeup_fd[i], F_SETFL, O_NONBLOCK);
+            fcntl(SDL_EventQ.wakeup_fd[i], F_SETFD, FD_CLOEXEC);
+        }
+    } else {
+        SDL_EventQ.wakeup_fd[0] = -1;
+        SDL_EventQ.wakeup_fd[1] = -1;
+    }
+#endif
+    SDL_AtomicSet(&SDL_EventQ.waiting, 0);
+    SDL_AtomicSet(&SDL_EventQ.wakeup_sent, 0);
+}
+
+static void
+SDL_DestroyEventWakeup(void)
+{
+#ifdef SDL_EVENT_WAKEUP
+    if (SDL_EventQ.wakeup_fd[0] >= 0) {
+        close(SDL_EventQ.wakeup_fd[0]);
+    }
+    if (SDL_EventQ.wakeup_fd[1] >= 0 &&
+        SDL_EventQ.wakeup_fd[1] != SDL_EventQ.wakeup_fd[0]) {
+        close(SDL_EventQ.wakeup_fd[1]);
+    }
+#endif
+    SDL_EventQ.wakeup_fd[0] = -1;
+    SDL_EventQ.wakeup_fd[1] = -1;
+}
+
+/* Wake up any thread sleeping in SDL_WaitEventTimeout() */
+static void
+SDL_SendEventWakeup(void)
+{
+#ifdef SDL_EVENT_WAKEUP
+    if (SDL_AtomicGet(&SDL_EventQ.waiting) > 0 &&
+        SDL_EventQ.wakeup_fd[1] >= 0 &&
+        SDL_AtomicCAS(&SDL_EventQ.wakeup_sent, 0, 1)) {
+#ifdef SDL_EVENT_WAKEUP_EVENTFD
+        Uint64 value = 1;
+#else
+        Uint8 value = 1;
+#endif
+        while (write(SDL_EventQ.wakeup_fd[1], &value, sizeof(value)) < 0 &&
+               errno == EINTR) {
+            continue;
+        }
+    }
+#endif
+}
+
+/* Consume a wakeup so the next wait blocks again.
+   The fd is drained whether or not the flag is set: a sender may have set
+   the flag and not written yet, so a byte can still arrive after we reset
+   it, and it has to be picked up here rather than keep select() ready.
+ */
+static void
+SDL_ClearEventWakeup(void)
+{
+#ifdef SDL_EVENT_WAKEUP
+    if (SDL_EventQ.wakeup_fd[0] >= 0) {
+        Uint8 buf[64];
+        while (read(SDL_EventQ.wakeup_fd[0], buf, sizeof(buf)) > 0) {
+            continue;
+        }
+    }
+    SDL_AtomicSet(&SDL_EventQ.wakeup_sent, 0);
+#endif
+}
+
+/* Sleep until an event is posted, 'fd' becomes readable, or the timeout
+   (in milliseconds, -1 for forever) expires.
+   Returns 1 if the wait was interrupted, or 0 if it timed out.
+ */
+int
+SDL_WaitEventWakeup(int fd, int timeout)
+{
+#ifdef SDL_EVENT_WAKEUP
+    int wakeup_fd = SDL_EventQ.wakeup_fd[0];
+    struct timeval tv, *ptv = NULL;
+    fd_set fdset;
+    int maxfd;
+
+    if (wakeup_fd < 0 && fd < 0) {
+        SDL_Delay(timeout < 0 ? 10 : timeout);
+        return 0;
+    }
+
+    FD_ZERO(&fdset);
+    maxfd = -1;
+    if (wakeup_fd >= 0) {
+        FD_SET(wakeup_fd, &fdset);
+        maxfd = wakeup_fd;
+    }
+    if (fd >= 0) {
+        FD_SET(fd, &fdset);
+        if (fd > maxfd) {
+            maxfd = fd;
+        }
+    }
+    if (timeout >= 0) {
+        tv.tv_sec = timeout / 1000;
+        tv.tv_usec = (timeout % 1000) * 1000;
+        ptv = &tv;
+    }
+    return (select(maxfd + 1, &fdset, NULL, NULL, ptv) != 0);
+#else
+    SDL_Delay(timeout < 0 ? 10 : SDL_min(timeout, 10));
+    return 0;
+#endif
+}
+
 /* Public functions */
 
 void
 SDL_StopEventLoop(void)
 {
     int i;
+    SDL_EventEntry *entry;
+
+    SDL_EventQ.active = SDL_FALSE;
 
     if (SDL_EventQ.lock) {
         SDL_DestroyMutex(SDL_EventQ.lock);
         SDL_EventQ.lock = NULL;
     }
+    SDL_DestroyEventWakeup();
 
     /* Clean out EventQ */
-    SDL_EventQ.head = 0;
-    SDL_EventQ.tail = 0;
-    SDL_EventQ.wmmsg_next = 0;
+    for (entry = SDL_EventQ.head; entry; ) {
+        SDL_EventEntry *next = entry->next;
+        SDL_free(entry);
+        entry = next;
+    }
+    for (entry = SDL_EventQ.free; entry; ) {
+        SDL_EventEntry *next = entry->next;
+        SDL_free(entry);
+        entry = next;
+    }
+    SDL_EventQ.count = 0;
+    SDL_EventQ.head = NULL;
+    SDL_EventQ.tail = NULL;
+    SDL_EventQ.free = NULL;
 
     /* Clear disabled event state */
     for (i = 0; i < SDL_arraysize(SDL_disabled_events); ++i) {
@@ -115,8 +308,12 @@ SDL_StopEventLoop(void)
 int
 SDL_StartEventLoop(void)
 {
+    int i;
+
     /* Clean out the event queue */
     SDL_EventQ.lock = NULL;
+    SDL_EventQ.wakeup_fd[0] = -1;
+    SDL_EventQ.wakeup_fd[1] = -1;
     SDL_StopEventLoop();
 
     /* No filter to start with, process most event types */
@@ -124,6 +321,13 @@ SDL_StartEventLoop(void)
     SDL_EventState(SDL_DROPFILE, SDL_DISABLE);
     SDL_EventState(SDL_SYSWMEVENT, SDL_DISABLE);
 
+    /* Reset the pending event ring */
+    for (i = 0; i < SDL_MAX_PENDING_EVENTS; ++i) {
+        SDL_AtomicSet(&SDL_EventQ.pending[i].sequence, i);
+    }
+    SDL_AtomicSet(&SDL_EventQ.enqueue_pos, 0);
+    SDL_AtomicSet(&SDL_EventQ.dequeue_pos, 0);
+
     /* Create the lock and set ourselves active */
 #if !SDL_THREADS_DISABLED
     SDL_EventQ.lock = SDL_CreateMutex();
@@ -131,7 +335,8 @@ SDL_StartEventLoop(void)
         return (-1);
     }
 #endif /* !SDL_THREADS_DISABLED */
-    SDL_EventQ.active = 1;
+    SDL_CreateEventWakeup();
+    SDL_EventQ.active = SDL_TRUE;
 
     return (0);
 }
@@ -141,55 +346,133 @@ SDL_StartEventLoop(void)
 static int
 SDL_AddEvent(SDL_Event * event)
 {
-    int tail, added;
+    SDL_EventEntry *entry;
 
-    tail = (SDL_EventQ.tail + 1) % MAXEVENTS;
-    if (tail == SDL_EventQ.head) {
+    if (SDL_EventQ.count >= SDL_MAX_QUEUED_EVENTS) {
         /* Overflow, drop event */
-        added = 0;
+        return 0;
+    }
+
+    if (SDL_EventQ.free) {
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
     } else {
-        SDL_EventQ.event[SDL_EventQ.tail] = *event;
-        if (event->type == SDL_SYSWMEVENT) {
-            /* Note that it's possible to lose an event */
-            int next = SDL_EventQ.wmmsg_next;
-            SDL_EventQ.wmmsg[next] = *event->syswm.msg;
-            SDL_EventQ.event[SDL_EventQ.tail].syswm.msg =
-                &SDL_EventQ.wmmsg[next];
-            SDL_EventQ.wmmsg_next = (next + 1) % MAXEVENTS;
+        entry = (SDL_EventEntry *) SDL_malloc(sizeof(*entry));
+        if (!entry) {
+            /* Out of memory, drop event */
+            return 0;
         }
-        SDL_EventQ.tail = tail;
-        added = 1;
     }
-    return (added);
+
+    entry->event = *event;
+    if (event->type == SDL_SYSWMEVENT) {
+        entry->msg = *event->syswm.msg;
+        entry->event.syswm.msg = &entry->msg;
+    }
+
+    entry->prev = SDL_EventQ.tail;
+    entry->next = NULL;
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+    } else {
+        SDL_EventQ.head = entry;
+    }
+    SDL_EventQ.tail = entry;
+    ++SDL_EventQ.count;
+
+    return 1;
 }
 
-/* Cut an event, and return the next valid spot, or the tail */
+/* Cut an event, and return the next valid entry, or NULL */
 /*                           -- called with the queue locked */
-static int
-SDL_CutEvent(int spot)
-{
-    if (spot == SDL_EventQ.head) {
-        SDL_EventQ.head = (SDL_EventQ.head + 1) % MAXEVENTS;
-        return (SDL_EventQ.head);
-    } else if ((spot + 1) % MAXEVENTS == SDL_EventQ.tail) {
-        SDL_EventQ.tail = spot;
-        return (SDL_EventQ.tail);
-    } else
-        /* We cut the middle -- shift everything over */
-    {
-        int here, next;
+static SDL_EventEntry *
+SDL_CutEvent(SDL_EventEntry * entry)
+{
+    SDL_EventEntry *next = entry->next;
+
+    if (entry->prev) {
+        entry->prev->next = next;
+    } else {
+        SDL_EventQ.head = next;
+    }
+    if (next) {
+        next->prev = entry->prev;
+    } else {
+        SDL_EventQ.tail = entry->prev;
+    }
+
+    entry->next = SDL_EventQ.free;
+    SDL_EventQ.free = entry;
+    --SDL_EventQ.count;
 
-        /* This can probably be optimized with SDL_memcpy() -- careful! */
-        if (--SDL_EventQ.tail < 0) {
-            SDL_EventQ.tail = MAXEVENTS - 1;
+    return next;
+}
+
+/* Post an event to the pending ring without taking the queue lock.
+   Returns SDL_FALSE if the ring is full.
+ */
+static SDL_bool
+SDL_PostPendingEvent(const SDL_Event * event)
+{
+    SDL_PendingEvent *entry;
+    unsigned queue_pos;
+    unsigned entry_seq;
+    int delta;
+
+    queue_pos = (unsigned)SDL_AtomicGet(&SDL_EventQ.enqueue_pos);
+    for ( ; ; ) {
+        entry = &SDL_EventQ.pending[queue_pos & SDL_PENDING_WRAP_MASK];
+        entry_seq = (unsigned)SDL_AtomicGet(&entry->sequence);
+
+        delta = (int)(entry_seq - queue_pos);
+        if (delta == 0) {
+            /* The entry and the queue position match, try to claim it */
+            if (SDL_AtomicCAS(&SDL_EventQ.enqueue_pos, (int)queue_pos, (int)(queue_pos+1))) {
+                entry->event = *event;
+                SDL_AtomicSet(&entry->sequence, (int)(queue_pos+1));
+                return SDL_TRUE;
+            }
+        } else if (delta < 0) {
+            /* We ran into an entry that still needs to be drained */
+            return SDL_FALSE;
+        } else {
+            /* Another thread got here first, get the new queue position */
+            queue_pos = (unsigned)SDL_AtomicGet(&SDL_EventQ.enqueue_pos);
         }
-        for (here = spot; here != SDL_EventQ.tail; here = next) {
-            next = (here + 1) % MAXEVENTS;
-            SDL_EventQ.event[here] = SDL_EventQ.event[next];
+    }
+}
+
+/* Move pending events into the event queue -- called with the queue locked.
+   Anything that doesn't fit stays pending until there is room.
+   If 'wait' is set, entries that other threads are still filling in are
+   waited for, so everything posted before this call is in the queue.
+ */
+static void
+SDL_DrainPendingEvents(SDL_bool wait)
+{
+    SDL_PendingEvent *entry;
+    unsigned queue_pos;
+    unsigned entry_seq;
+
+    /* We're the only consumer, so nobody else moves dequeue_pos */
+    queue_pos = (unsigned)SDL_AtomicGet(&SDL_EventQ.dequeue_pos);
+    while (SDL_EventQ.count < SDL_MAX_QUEUED_EVENTS) {
+        entry = &SDL_EventQ.pending[queue_pos & SDL_PENDING_WRAP_MASK];
+        entry_seq = (unsigned)SDL_AtomicGet(&entry->sequence);
+
+        if (entry_seq != queue_pos+1) {
+            if (wait &&
+                (unsigned)SDL_AtomicGet(&SDL_EventQ.enqueue_pos) != queue_pos) {
+                /* A producer has claimed this entry but not filled it yet */
+                continue;
+            }
+            break;
         }
-        return (spot);
+        SDL_AddEvent(&entry->event);
+        SDL_AtomicSet(&entry->sequence, (int)(queue_pos+SDL_MAX_PENDING_EVENTS));
+        ++queue_pos;
     }
-    /* NOTREACHED */
+    SDL_AtomicSet(&SDL_EventQ.dequeue_pos, (int)queue_pos);
 }
 
 /* Lock the event queue, take a peep at it, and unlock it */
@@ -203,16 +486,41 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
     if (!SDL_EventQ.active) {
         return (-1);
     }
-    /* Lock the event queue */
+
     used = 0;
+    if (action == SDL_ADDEVENT) {
+        /* Post what we can without locking, system messages need a copy
+           of their payload and always go through the locked path.
+         */
+        for (i = 0; i < numevents; ++i) {
+            if (events[i].type == SDL_SYSWMEVENT ||
+                !SDL_PostPendingEvent(&events[i])) {
+                break;
+            }
+            ++used;
+        }
+        if (i == numevents) {
+            if (used > 0) {
+                SDL_SendEventWakeup();
+            }
+            return (used);
+        }
+    }
+
+    /* Lock the event queue */
     if (SDL_mutexP(SDL_EventQ.lock) == 0) {
         if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
+            /* Keep the order of everything already posted */
+            SDL_DrainPendingEvents(SDL_TRUE);
+            for (; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
+            if (used > 0) {
+                SDL_SendEventWakeup();
+            }
         } else {
             SDL_Event tmpevent;
-            int spot;
+            SDL_EventEntry *entry;
 
             /* If 'events' is NULL, just see if they exist */
             if (events == NULL) {
@@ -220,18 +528,19 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                 numevents = 1;
                 events = &tmpevent;
             }
-            spot = SDL_EventQ.head;
-            while ((used < numevents) && (spot != SDL_EventQ.tail)) {
-                Uint32 type = SDL_EventQ.event[spot].type;
+            SDL_DrainPendingEvents(SDL_FALSE);
+            entry = SDL_EventQ.head;
+            while ((used < numevents) && entry) {
+                Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
-                    events[used++] = SDL_EventQ.event[spot];
+                    events[used++] = entry->event;
                     if (action == SDL_GETEVENT) {
-                        spot = SDL_CutEvent(spot);
+                        entry = SDL_CutEvent(entry);
                     } else {
-                        spot = (spot + 1) % MAXEVENTS;
+                        entry = entry->next;
                     }
                 } else {
-                    spot = (spot + 1) % MAXEVENTS;
+                    entry = entry->next;
                 }
             }
         }
@@ -279,13 +588,16 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 
     /* Lock the event queue */
     if (SDL_mutexP(SDL_EventQ.lock) == 0) {
-        int spot = SDL_EventQ.head;
-        while (spot != SDL_EventQ.tail) {
-            Uint32 type = SDL_EventQ.event[spot].type;
+        SDL_EventEntry *entry;
+
+        SDL_DrainPendingEvents(SDL_FALSE);
+        entry = SDL_EventQ.head;
+        while (entry) {
+            Uint32 type = entry->event.type;
             if (minType <= type && type <= maxType) {
-                spot = SDL_CutEvent(spot);
+                entry = SDL_CutEvent(entry);
             } else {
-                spot = (spot + 1) % MAXEVENTS;
+                entry = entry->next;
             }
         }
         SDL_mutexV(SDL_EventQ.lock);
@@ -310,6 +622,35 @@ SDL_PumpEvents(void)
 #endif
 }
 
+/* Sleep until an event might be available, or the timeout expires */
+static void
+SDL_WaitForEvents(int timeout)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    SDL_bool blocking;
+
+    /* Without a wakeup the driver can't be woken by posted events, and
+       anything that has to be polled bounds how long we can sleep.
+     */
+    blocking = (_this && _this->WaitEventTimeout &&
+                SDL_EventQ.wakeup_fd[0] >= 0 && !SDL_ShouldPollJoystick());
+    if (!blocking && (timeout < 0 || timeout > 10)) {
+        timeout = 10;
+    }
+
+    /* Let producers know to signal us before we take a last look */
+    SDL_AtomicAdd(&SDL_EventQ.waiting, 1);
+    if (!SDL_HasEvents(SDL_FIRSTEVENT, SDL_LASTEVENT)) {
+        if (_this && _this->WaitEventTimeout) {
+            _this->WaitEventTimeout(_this, timeout);
+        } else {
+            SDL_WaitEventWakeup(-1, timeout);
+        }
+    }
+    SDL_AtomicAdd(&SDL_EventQ.waiting, -1);
+    SDL_ClearEventWakeup();
+}
+
 /* Public functions */
 
 int
@@ -348,7 +689,13 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
                 /* Timeout expired and no events */
                 return 0;
             }
-            SDL_Delay(10);
+            if (timeout > 0) {
+                /* Never pass a negative time left, that means forever */
+                const int remaining = (int) (expiration - SDL_GetTicks());
+                SDL_WaitForEvents(remaining > 0 ? remaining : 0);
+            } else {
+                SDL_WaitForEvents(-1);
+            }
             break;
         }
     }
@@ -356,25 +703,55 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
 
 int
 SDL_PushEvent(SDL_Event * event)
+{
+    return SDL_PushEvents(event, 1);
+}
+
+int
+SDL_PushEvents(SDL_Event * events, int numevents)
 {
     SDL_EventWatcher *curr;
-    event->window.timestamp = SDL_GetTicks();
-    if (SDL_EventOK && !SDL_EventOK(SDL_EventOKParam, event)) {
+    Uint32 timestamp;
+    int i, accepted, added;
+
+    if (numevents <= 0) {
         return 0;
     }
 
-    for (curr = SDL_event_watchers; curr; curr = curr->next) {
-        curr->callback(curr->userdata, event);
+    /* Run the filter and watchers in one pass, packing accepted events */
+    timestamp = SDL_GetTicks();
+    accepted = 0;
+    for (i = 0; i < numevents; ++i) {
+        SDL_Event *event = &events[i];
+
+        event->window.timestamp = timestamp;
+        if (SDL_EventOK && !SDL_EventOK(SDL_EventOKParam, event)) {
+            continue;
+        }
+
+        for (curr = SDL_event_watchers; curr; curr = curr->next) {
+            curr->callback(curr->userdata, event);
+        }
+
+        if (accepted != i) {
+            events[accepted] = *event;
+        }
+        ++accepted;
+    }
+    if (accepted == 0) {
+        return 0;
     }
 
-    if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
+    added = SDL_PeepEvents(events, accepted, SDL_ADDEVENT, 0, 0);
+    if (added <= 0) {
         return -1;
     }
 
-    SDL_GestureProcessEvent(event);
-    
+    for (i = 0; i < added; ++i) {
+        SDL_GestureProcessEvent(&events[i]);
+    }
 
-    return 1;
+    return added;
 }
 
 void
@@ -441,14 +818,15 @@ void
 SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (SDL_mutexP(SDL_EventQ.lock) == 0) {
-        int spot;
+        SDL_EventEntry *entry;
 
-        spot = SDL_EventQ.head;
-        while (spot != SDL_EventQ.tail) {
-            if (filter(userdata, &SDL_EventQ.event[spot])) {
-                spot = (spot + 1) % MAXEVENTS;
+        SDL_DrainPendingEvents(SDL_FALSE);
+        entry = SDL_EventQ.head;
+        while (entry) {
+            if (filter(userdata, &entry->event)) {
+                entry = entry->next;
             } else {
-                spot = SDL_CutEvent(spot);
+                entry = SDL_CutEvent(entry);
             }
         }
     }
@@ -38,6 +38,9 @@ extern void SDL_QuitInterrupt(void);
 
 extern int SDL_SendSysWMEvent(SDL_SysWMmsg * message);
 
+/* Sleep until an event is posted, 'fd' is readable or the timeout expires */
+extern int SDL_WaitEventWakeup(int fd, int timeout);
+
 extern int SDL_QuitInit(void);
 extern int SDL_SendQuit(void);
 extern void SDL_QuitQuit(void);
@@ -32,7 +32,6 @@
 #include "SDL_blendpoint.h"
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
-#include "SDL_rotate.h"
 
 /* SDL surface based renderer implementation */
 
@@ -93,10 +92,15 @@ SDL_RenderDriver SW_RenderDriver = {
      0}
 };
 
+#define SW_MAX_SCRATCH  4
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    /* Scratch space for filtered and rotated copies, one per texture format,
+       most recently used first */
+    SDL_Surface *scratch[SW_MAX_SCRATCH];
 } SW_RenderData;
 
 
@@ -477,10 +481,144 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_Rect * rects, int count)
     return status;
 }
 
+static int
+GetScaleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+        return 0;
+    } else {
+        return 1;
+    }
+}
+
+/* A scratch surface in the texture's format, at least w by h, that's
+   kept for the next copy.  Each format gets its own, so drawing textures
+   of different formats in turn doesn't reallocate them. */
+static SDL_Surface *
+SW_GetScratchSurface(SW_RenderData * data, SDL_Surface * src, int w, int h)
+{
+    SDL_Surface *scratch;
+    int i;
+
+    for (i = 0; i < SW_MAX_SCRATCH - 1; ++i) {
+        if (!data->scratch[i] ||
+            data->scratch[i]->format->format == src->format->format) {
+            break;
+        }
+    }
+    scratch = data->scratch[i];
+
+    if (!scratch || scratch->format->format != src->format->format ||
+        scratch->w < w || scratch->h < h) {
+        if (scratch && scratch->format->format == src->format->format) {
+            w = SDL_max(w, scratch->w);
+            h = SDL_max(h, scratch->h);
+        }
+        /* Past the last slot, the least recently used one is replaced */
+        SDL_FreeSurface(scratch);
+        scratch = SDL_CreateRGBSurface(0, w, h, src->format->BitsPerPixel,
+                                       src->format->Rmask, src->format->Gmask,
+                                       src->format->Bmask, src->format->Amask);
+        if (!scratch) {
+            for (; i < SW_MAX_SCRATCH - 1; ++i) {
+                data->scratch[i] = data->scratch[i + 1];
+            }
+            data->scratch[i] = NULL;
+            return NULL;
+        }
+    }
+
+    /* Move it to the front */
+    for (; i > 0; --i) {
+        data->scratch[i] = data->scratch[i - 1];
+    }
+    data->scratch[0] = scratch;
+    return scratch;
+}
+
+/* Whether a texture's pixels go to the target unchanged */
+static SDL_bool
+SW_IsPlainCopy(SDL_Surface * src, SDL_Surface * surface)
+{
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    Uint32 colorkey;
+
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    return (src->format->format == surface->format->format &&
+            blendMode == SDL_BLENDMODE_NONE && (r & g & b & a) == 0xFF &&
+            SDL_GetColorKey(src, &colorkey) < 0);
+}
+
+/* Give the scratch surface the texture's blend mode, modulation and
+   colorkey, so blitting it draws like the texture would */
+static void
+SW_CopyBlitSettings(SDL_Surface * src, SDL_Surface * scratch)
+{
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    Uint32 colorkey;
+
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    SDL_SetSurfaceBlendMode(scratch, blendMode);
+    SDL_SetSurfaceColorMod(scratch, r, g, b);
+    SDL_SetSurfaceAlphaMod(scratch, a);
+    if (SDL_GetColorKey(src, &colorkey) == 0) {
+        SDL_SetColorKey(scratch, SDL_TRUE, colorkey);
+    } else {
+        SDL_SetColorKey(scratch, SDL_FALSE, 0);
+    }
+}
+
+/* Stretch with bilinear filtering.  A texture that's copied as is goes
+   straight to the target, otherwise it's filtered into the scratch surface
+   that's blitted with the texture's blend mode and modulation. */
+static int
+SW_RenderCopyLinear(SW_RenderData * data, SDL_Surface * src,
+                    const SDL_Rect * srcrect, SDL_Surface * surface,
+                    const SDL_Rect * dstrect)
+{
+    SDL_Surface *scratch;
+    SDL_Rect clip, rect, area;
+
+    if (!SDL_IntersectRect(dstrect, &surface->clip_rect, &clip)) {
+        return 0;
+    }
+
+    if (SW_IsPlainCopy(src, surface)) {
+        return SDL_StretchLinear(src, srcrect, surface, dstrect, &clip);
+    }
+
+    scratch = SW_GetScratchSurface(data, src, clip.w, clip.h);
+    if (!scratch) {
+        return -1;
+    }
+    rect.x = dstrect->x - clip.x;
+    rect.y = dstrect->y - clip.y;
+    rect.w = dstrect->w;
+    rect.h = dstrect->h;
+    area.x = 0;
+    area.y = 0;
+    area.w = clip.w;
+    area.h = clip.h;
+    if (SDL_StretchLinear(src, srcrect, scratch, &rect, &area) < 0) {
+        return -1;
+    }
+    SW_CopyBlitSettings(src, scratch);
+    return SDL_BlitSurface(scratch, &area, surface, &clip);
+}
+
 static int
 SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
               const SDL_Rect * srcrect, const SDL_Rect * dstrect)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Surface *src = (SDL_Surface *) texture->driverdata;
     SDL_Rect final_rect = *dstrect;
@@ -495,35 +633,154 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     }
     if ( srcrect->w == final_rect.w && srcrect->h == final_rect.h ) {
         return SDL_BlitSurface(src, srcrect, surface, &final_rect);
+    } else if (GetScaleQuality() && (src->format->BytesPerPixel == 2 ||
+                                     src->format->BytesPerPixel == 4)) {
+        return SW_RenderCopyLinear(data, src, srcrect, surface, &final_rect);
     } else {
         return SDL_BlitScaled(src, srcrect, surface, &final_rect);
     }
 }
 
-static int
-GetScaleQuality(void)
+/* Copy a row of a rotated copy from the texture.  sx and sy are where the
+   first pixel comes from in 16.16 fixed point, and move by dsx and dsy
+   every pixel.  Filtering blends the four pixels around that point,
+   clamped to srcrect.  16 bit pixels are expanded to 8 bits per channel
+   to be filtered and packed again, like SDL_SoftStretchLinear() does, and
+   formats with wider channels or 24 bit pixels are sampled nearest. */
+static void
+SW_SampleRow(SDL_Surface * src, const SDL_Rect * srcrect, int sx, int sy,
+             int dsx, int dsy, int w, SDL_bool linear, Uint8 * dst)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    const SDL_PixelFormat *fmt = src->format;
+    const Uint8 *pixels = (const Uint8 *) src->pixels;
+    const int pitch = src->pitch;
+    const int bpp = fmt->BytesPerPixel;
+    int i;
+
+    if (linear && (bpp == 2 ||
+                   (bpp == 4 && !fmt->Rloss && !fmt->Gloss && !fmt->Bloss))) {
+        const int maxx = srcrect->x + srcrect->w - 1;
+        const int maxy = srcrect->y + srcrect->h - 1;
+
+        for (i = 0; i < w; ++i) {
+            int x0 = (sx - 0x8000) >> 16, x1, fx = ((sx - 0x8000) >> 8) & 0xFF;
+            int y0 = (sy - 0x8000) >> 16, y1, fy = ((sy - 0x8000) >> 8) & 0xFF;
+            Uint32 p[4], pixel = 0;
+            int c, k;
+
+            if (x0 < srcrect->x) {
+                x0 = srcrect->x;
+                fx = 0;
+            }
+            x1 = (x0 < maxx) ? x0 + 1 : x0;
+            if (y0 < srcrect->y) {
+                y0 = srcrect->y;
+                fy = 0;
+            }
+            y1 = (y0 < maxy) ? y0 + 1 : y0;
+            if (bpp == 2) {
+                const Uint16 *p0 = (const Uint16 *) (pixels + y0 * pitch);
+                const Uint16 *p1 = (const Uint16 *) (pixels + y1 * pitch);
+                p[0] = p0[x0];
+                p[1] = p0[x1];
+                p[2] = p1[x0];
+                p[3] = p1[x1];
+                for (k = 0; k < 4; ++k) {
+                    unsigned R, G, B, A;
+
+                    RGBA_FROM_PIXEL(p[k], fmt, R, G, B, A);
+                    p[k] = (A << 24) | (R << 16) | (G << 8) | B;
+                }
+            } else {
+                const Uint32 *p0 = (const Uint32 *) (pixels + y0 * pitch);
+                const Uint32 *p1 = (const Uint32 *) (pixels + y1 * pitch);
+                p[0] = p0[x0];
+                p[1] = p0[x1];
+                p[2] = p1[x0];
+                p[3] = p1[x1];
+            }
+            for (c = 0; c < 32; c += 8) {
+                const int top = ((p[0] >> c) & 0xFF) * (256 - fx) +
+                    ((p[1] >> c) & 0xFF) * fx;
+                const int bottom = ((p[2] >> c) & 0xFF) * (256 - fx) +
+                    ((p[3] >> c) & 0xFF) * fx;
+                pixel |= (Uint32) ((top * (256 - fy) + bottom * fy +
+                                    0x8000) >> 16) << c;
+            }
+            if (bpp == 2) {
+                const unsigned R = (pixel >> 16) & 0xFF;
+                const unsigned G = (pixel >> 8) & 0xFF;
+                const unsigned B = pixel & 0xFF;
+                const unsigned A = pixel >> 24;
+
+                PIXEL_FROM_RGBA(pixel, fmt, R, G, B, A);
+                ((Uint16 *) dst)[i] = (Uint16) pixel;
+            } else {
+                ((Uint32 *) dst)[i] = pixel;
+            }
+            sx += dsx;
+            sy += dsy;
+        }
+        return;
+    }
 
-    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
-        return 0;
-    } else {
-        return 1;
+    switch (bpp) {
+    case 2:
+        for (i = 0; i < w; ++i) {
+            ((Uint16 *) dst)[i] = *(const Uint16 *) (pixels +
+                                                     (sy >> 16) * pitch +
+                                                     (sx >> 16) * 2);
+            sx += dsx;
+            sy += dsy;
+        }
+        break;
+    case 4:
+        for (i = 0; i < w; ++i) {
+            ((Uint32 *) dst)[i] = *(const Uint32 *) (pixels +
+                                                     (sy >> 16) * pitch +
+                                                     (sx >> 16) * 4);
+            sx += dsx;
+            sy += dsy;
+        }
+        break;
+    default:
+        for (i = 0; i < w; ++i) {
+            SDL_memcpy(dst, pixels + (sy >> 16) * pitch + (sx >> 16) * bpp,
+                       bpp);
+            dst += bpp;
+            sx += dsx;
+            sy += dsy;
+        }
+        break;
     }
 }
 
+/* Rotated copies are drawn a row at a time, straight from the texture.
+   Every target pixel inside the rotated dstrect is mapped back to the
+   texture, the pixels inside a row are next to each other, and that span
+   is either sampled straight into the target or into a scratch row that's
+   blitted with the texture's blend mode, modulation and colorkey.  Nothing
+   is allocated once the scratch surface is big enough. */
 static int
 SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                 const SDL_Rect * srcrect, const SDL_Rect * dstrect,
                 const double angle, const SDL_Point * center, const SDL_RendererFlip flip)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect final_rect = *dstrect, tmp_rect;
-    SDL_Surface *surface_rotated, *surface_scaled;
+    SDL_Surface *scratch = NULL;
+    SDL_Rect final_rect = *dstrect, bounds, clip;
+    const int bpp = src->format->BytesPerPixel;
     Uint32 colorkey;
-    int retval, dstwidth, dstheight, abscenterx, abscentery;
-    double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
+    SDL_bool linear;
+    double cangle, sangle, scalex, scaley;
+    double dsxdx, dsxdy, dsydx, dsydy, sx0, sy0, px, py;
+    double minx, maxx, miny, maxy;
+    int abscenterx, abscentery;
+    int x, y, i, dsx, dsy, spanx, spany, src_locked = 0, dst_locked = 0;
+    const int xmin = srcrect->x << 16, xrange = srcrect->w << 16;
+    const int ymin = srcrect->y << 16, yrange = srcrect->h << 16;
 
     if (!surface) {
         return -1;
@@ -533,66 +790,155 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
         final_rect.x += renderer->viewport.x;
         final_rect.y += renderer->viewport.y;
     }
+    if (final_rect.w <= 0 || final_rect.h <= 0) {
+        return 0;
+    }
+    abscenterx = final_rect.x + center->x;
+    abscentery = final_rect.y + center->y;
+
+    /* The rotation is clockwise around the center, as in the other
+       renderers.  Find the target pixels it can cover. */
+    cangle = SDL_cos(angle * M_PI / 180.0);
+    sangle = SDL_sin(angle * M_PI / 180.0);
+    minx = maxx = miny = maxy = 0.0;
+    for (i = 0; i < 4; ++i) {
+        const double cornerx = ((i & 1) ? final_rect.w : 0) - center->x;
+        const double cornery = ((i & 2) ? final_rect.h : 0) - center->y;
+        px = cornerx * cangle - cornery * sangle;
+        py = cornerx * sangle + cornery * cangle;
+        if (i == 0 || px < minx) minx = px;
+        if (i == 0 || px > maxx) maxx = px;
+        if (i == 0 || py < miny) miny = py;
+        if (i == 0 || py > maxy) maxy = py;
+    }
+    bounds.x = abscenterx + (int) SDL_floor(minx) - 1;
+    bounds.y = abscentery + (int) SDL_floor(miny) - 1;
+    bounds.w = (int) SDL_ceil(maxx - minx) + 3;
+    bounds.h = (int) SDL_ceil(maxy - miny) + 3;
+    if (!SDL_IntersectRect(&bounds, &surface->clip_rect, &clip)) {
+        return 0;
+    }
+
+    /* Where in the texture each target pixel center comes from: rotate back
+       around the center, flip within dstrect and scale to srcrect */
+    scalex = (double) srcrect->w / final_rect.w;
+    scaley = (double) srcrect->h / final_rect.h;
+    if (flip & SDL_FLIP_HORIZONTAL) {
+        scalex = -scalex;
+    }
+    if (flip & SDL_FLIP_VERTICAL) {
+        scaley = -scaley;
+    }
+    dsxdx = scalex * cangle;
+    dsxdy = scalex * sangle;
+    dsydx = -scaley * sangle;
+    dsydy = scaley * cangle;
+    sx0 = srcrect->x + ((flip & SDL_FLIP_HORIZONTAL) ? srcrect->w : 0) +
+        scalex * center->x;
+    sy0 = srcrect->y + ((flip & SDL_FLIP_VERTICAL) ? srcrect->h : 0) +
+        scaley * center->y;
+    dsx = (int) SDL_floor(dsxdx * 65536.0 + 0.5);
+    dsy = (int) SDL_floor(dsydx * 65536.0 + 0.5);
+
+    /* Filtering would blend colorkeyed pixels into their neighbours */
+    linear = (GetScaleQuality() && SDL_GetColorKey(src, &colorkey) < 0);
+
+    if (!SW_IsPlainCopy(src, surface)) {
+        scratch = SW_GetScratchSurface(data, src, clip.w, 1);
+        if (!scratch) {
+            return -1;
+        }
+        SW_CopyBlitSettings(src, scratch);
+    }
 
-    surface_scaled = SDL_CreateRGBSurface(SDL_SWSURFACE, final_rect.w, final_rect.h, src->format->BitsPerPixel,
-                                          src->format->Rmask, src->format->Gmask,
-                                          src->format->Bmask, src->format->Amask );
-    SDL_GetColorKey(src, &colorkey);
-    SDL_SetColorKey(surface_scaled, SDL_TRUE, colorkey);
-    tmp_rect = final_rect;
-    tmp_rect.x = 0;
-    tmp_rect.y = 0;
-    if (surface_scaled) {
-        retval = SDL_BlitScaled(src, srcrect, surface_scaled, &tmp_rect);
-        if (!retval) {
-            _rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, -angle, &dstwidth, &dstheight, &cangle, &sangle);
-            surface_rotated = _rotateSurface(surface_scaled, -angle, dstwidth/2, dstheight/2, GetScaleQuality(), flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
-            if(surface_rotated) {
-                /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
-                abscenterx = final_rect.x + center->x;
-                abscentery = final_rect.y + center->y;
-                /* Compensate the angle inversion to match the behaviour of the other backends */
-                sangle = -sangle;
-
-                /* Top Left */
-                px = final_rect.x - abscenterx;
-                py = final_rect.y - abscentery;
-                p1x = px * cangle - py * sangle + abscenterx;
-                p1y = px * sangle + py * cangle + abscentery;
-
-                /* Top Right */
-                px = final_rect.x + final_rect.w - abscenterx;
-                py = final_rect.y - abscentery;
-                p2x = px * cangle - py * sangle + abscenterx;
-                p2y = px * sangle + py * cangle + abscentery;
-
-                /* Bottom Left */
-                px = final_rect.x - abscenterx;
-                py = final_rect.y + final_rect.h - abscentery;
-                p3x = px * cangle - py * sangle + abscenterx;
-                p3y = px * sangle + py * cangle + abscentery;
-
-                /* Bottom Right */
-                px = final_rect.x + final_rect.w - abscenterx;
-                py = final_rect.y + final_rect.h - abscentery;
-                p4x = px * cangle - py * sangle + abscenterx;
-                p4y = px * sangle + py * cangle + abscentery;
-
-                tmp_rect.x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
-                tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
-                tmp_rect.w = dstwidth;
-                tmp_rect.h = dstheight;
-
-                retval = SDL_BlitSurface(surface_rotated, NULL, surface, &tmp_rect);
-                SDL_FreeSurface(surface_scaled);
-                SDL_FreeSurface(surface_rotated);
-                return retval;
+    /* Reading an RLE encoded texture decodes and encodes it again, so
+       textures drawn rotated stay decoded */
+    if (src->flags & SDL_RLEACCEL) {
+        SDL_SetSurfaceRLE(src, 0);
+    }
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            return -1;
+        }
+        src_locked = 1;
+    }
+    if (!scratch && SDL_MUSTLOCK(surface)) {
+        if (SDL_LockSurface(surface) < 0) {
+            if (src_locked) {
+                SDL_UnlockSurface(src);
+            }
+            return -1;
+        }
+        dst_locked = 1;
+    }
+
+    for (y = clip.y; y < clip.y + clip.h; ++y) {
+        /* Step from the edge of the bounds, so clipping doesn't move the
+           pixels by rounding differently */
+        const double dx = bounds.x + 0.5 - abscenterx;
+        const double dy = y + 0.5 - abscentery;
+        int sx = (int) SDL_floor((sx0 + dx * dsxdx + dy * dsxdy) * 65536.0 + 0.5);
+        int sy = (int) SDL_floor((sy0 + dx * dsydx + dy * dsydy) * 65536.0 + 0.5);
+        int start, end;
+
+        sx += (clip.x - bounds.x) * dsx;
+        sy += (clip.x - bounds.x) * dsy;
+
+        /* Skip to the first pixel from inside srcrect, the rest of them
+           follow it */
+        for (x = clip.x; x < clip.x + clip.w; ++x) {
+            if ((unsigned) (sx - xmin) < (unsigned) xrange &&
+                (unsigned) (sy - ymin) < (unsigned) yrange) {
+                break;
+            }
+            sx += dsx;
+            sy += dsy;
+        }
+        start = x;
+        spanx = sx;
+        spany = sy;
+        for (; x < clip.x + clip.w; ++x) {
+            if ((unsigned) (sx - xmin) >= (unsigned) xrange ||
+                (unsigned) (sy - ymin) >= (unsigned) yrange) {
+                break;
             }
+            sx += dsx;
+            sy += dsy;
+        }
+        end = x;
+        if (start == end) {
+            continue;
+        }
+
+        if (scratch) {
+            SDL_Rect srcspan, dstspan;
+
+            SW_SampleRow(src, srcrect, spanx, spany, dsx, dsy,
+                         end - start, linear, (Uint8 *) scratch->pixels);
+            srcspan.x = 0;
+            srcspan.y = 0;
+            srcspan.w = end - start;
+            srcspan.h = 1;
+            dstspan.x = start;
+            dstspan.y = y;
+            dstspan.w = end - start;
+            dstspan.h = 1;
+            SDL_LowerBlit(scratch, &srcspan, surface, &dstspan);
+        } else {
+            SW_SampleRow(src, srcrect, spanx, spany, dsx, dsy,
+                         end - start, linear,
+                         (Uint8 *) surface->pixels + y * surface->pitch +
+                         start * bpp);
         }
-        return retval;
     }
 
-    return -1;
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    if (dst_locked) {
+        SDL_UnlockSurface(surface);
+    }
+    return 0;
 }
 
 static int
@@ -656,6 +1002,13 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
     if (data) {
+        int i;
+
+        for (i = 0; i < SW_MAX_SCRATCH; ++i) {
+            if (data->scratch[i]) {
+                SDL_FreeSurface(data->scratch[i]);
+            }
+        }
         SDL_free(data);
     }
     SDL_free(renderer);
@@ -24,6 +24,7 @@
 #include "SDL_timer_c.h"
 #include "SDL_atomic.h"
 #include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 #include "SDL_thread.h"
 
 /* #define DEBUG_TIMERS */
@@ -34,7 +35,7 @@ typedef struct _SDL_Timer
     SDL_TimerCallback callback;
     void *param;
     Uint32 interval;
-    Uint32 scheduled;
+    Uint64 scheduled;       /* In performance counter ticks */
     volatile SDL_bool canceled;
     struct _SDL_Timer *next;
 } SDL_Timer;
@@ -46,12 +47,24 @@ typedef struct _SDL_TimerMap
     struct _SDL_TimerMap *next;
 } SDL_TimerMap;
 
-/* The timers are kept in a sorted list */
+/* The number of timer map buckets must be a power of 2 */
+#define SDL_TIMERMAP_MIN_BUCKETS    64
+
+/* The most threads SDL_HINT_TIMER_THREADS will start */
+#define SDL_TIMER_MAX_WORKERS       16
+
+/* Dispatch latency histogram, bucket N counts latencies below 2^N us */
+#define SDL_TIMER_LATENCY_BUCKETS   32
+
+/* The timers are kept in a binary heap ordered by scheduling time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
+    Uint64 frequency;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_TimerMap **timermap;
+    int timermap_buckets;
+    int timermap_count;
     SDL_mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -62,10 +75,26 @@ typedef struct {
     SDL_sem *sem;
     SDL_Timer * volatile pending;
     SDL_Timer * volatile freelist;
+    SDL_atomic_t canceled;
     volatile SDL_bool active;
 
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+
+    /* Worker threads running the callbacks, if SDL_HINT_TIMER_THREADS is set */
+    SDL_Thread *workers[SDL_TIMER_MAX_WORKERS];
+    int num_workers;
+    SDL_SpinLock dispatch_lock;
+    SDL_sem *dispatch_sem;
+    SDL_Timer *dispatch_head;
+    SDL_Timer *dispatch_tail;
+
+    /* Dispatch latency statistics */
+    SDL_atomic_t dispatched;
+    SDL_atomic_t latency[SDL_TIMER_LATENCY_BUCKETS];
+    SDL_atomic_t latency_max;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -74,28 +103,173 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by simply setting a canceled flag, and the timer
+ * thread drops them from the heap once enough of them pile up.
  */
 
+#define SDL_TIMER_BEFORE(A, B)  ((A)->scheduled < (B)->scheduled)
+
+/* Convert milliseconds to performance counter ticks */
+static __inline__ Uint64
+SDL_TimerCounts(SDL_TimerData *data, Uint32 ms)
+{
+    return ((Uint64) ms * data->frequency) / 1000;
+}
+
+/* Record how long after its deadline a callback started */
 static void
-SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+SDL_RecordTimerLatency(SDL_TimerData *data, Uint64 late)
 {
-    SDL_Timer *prev, *curr;
+    Uint32 us;
+    int bucket, max;
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
+    if (late >= data->frequency) {
+        us = (Uint32) SDL_min((late / data->frequency) * 1000000, 0x7FFFFFFF);
+    } else {
+        us = (Uint32) ((late * 1000000) / data->frequency);
+    }
+
+    bucket = 0;
+    while (bucket < SDL_TIMER_LATENCY_BUCKETS-1 && (us >> bucket) != 0) {
+        ++bucket;
+    }
+    SDL_AtomicIncRef(&data->latency[bucket]);
+    SDL_AtomicIncRef(&data->dispatched);
+
+    do {
+        max = SDL_AtomicGet(&data->latency_max);
+    } while ((int) us > max && !SDL_AtomicCAS(&data->latency_max, max, (int) us));
+}
+
+/* Run a timer callback, returning the next interval or 0 if it's done */
+static Uint32
+SDL_RunTimer(SDL_TimerData *data, SDL_Timer *timer)
+{
+    Uint64 now;
+
+    if (timer->canceled) {
+        return 0;
+    }
+
+    now = SDL_GetPerformanceCounter();
+    SDL_RecordTimerLatency(data, (now > timer->scheduled) ? (now - timer->scheduled) : 0);
+    return timer->callback(timer->interval, timer->param);
+}
+
+/* Reschedule from the deadline so periodic timers don't drift, unless
+   we've fallen a whole interval behind.
+ */
+static void
+SDL_RescheduleTimer(SDL_TimerData *data, SDL_Timer *timer, Uint32 interval, Uint64 tick)
+{
+    timer->scheduled += SDL_TimerCounts(data, interval);
+    if (timer->scheduled <= tick) {
+        timer->scheduled = tick + SDL_TimerCounts(data, interval);
+    }
+}
+
+static void
+SDL_TimerSiftUp(SDL_TimerData *data, int i)
+{
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *timer = timers[i];
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!SDL_TIMER_BEFORE(timer, timers[parent])) {
+            break;
+        }
+        timers[i] = timers[parent];
+        i = parent;
+    }
+    timers[i] = timer;
+}
+
+static void
+SDL_TimerSiftDown(SDL_TimerData *data, int i)
+{
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *timer = timers[i];
+    int count = data->num_timers;
+
+    for ( ; ; ) {
+        int child = 2 * i + 1;
+        if (child >= count) {
             break;
         }
+        if (child + 1 < count && SDL_TIMER_BEFORE(timers[child + 1], timers[child])) {
+            ++child;
+        }
+        if (!SDL_TIMER_BEFORE(timers[child], timer)) {
+            break;
+        }
+        timers[i] = timers[child];
+        i = child;
+    }
+    timers[i] = timer;
+}
+
+static SDL_bool
+SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    if (data->num_timers == data->max_timers) {
+        int max_timers = data->max_timers ? 2 * data->max_timers : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return SDL_FALSE;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    data->timers[data->num_timers++] = timer;
+    SDL_TimerSiftUp(data, data->num_timers - 1);
+    return SDL_TRUE;
+}
+
+/* Take the earliest timer off the heap */
+static void
+SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    if (--data->num_timers > 0) {
+        data->timers[0] = data->timers[data->num_timers];
+        SDL_TimerSiftDown(data, 0);
     }
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
+/* Append a finished timer to a list that goes back on the freelist */
+static void
+SDL_RetireTimer(SDL_Timer *timer, SDL_Timer **head, SDL_Timer **tail)
+{
+    timer->canceled = SDL_TRUE;
+    timer->next = NULL;
+    if (*tail) {
+        (*tail)->next = timer;
     } else {
-        data->timers = timer;
+        *head = timer;
+    }
+    *tail = timer;
+}
+
+/* Drop canceled timers from the heap */
+static void
+SDL_PurgeCanceledTimers(SDL_TimerData *data, SDL_Timer **head, SDL_Timer **tail)
+{
+    int i, count = 0;
+
+    for (i = 0; i < data->num_timers; ++i) {
+        SDL_Timer *timer = data->timers[i];
+        if (timer->canceled) {
+            SDL_RetireTimer(timer, head, tail);
+        } else {
+            data->timers[count++] = timer;
+        }
+    }
+    data->num_timers = count;
+
+    for (i = count / 2 - 1; i >= 0; --i) {
+        SDL_TimerSiftDown(data, i);
     }
-    timer->next = curr;
 }
 
 static int
@@ -106,7 +280,8 @@ SDL_TimerThread(void *_data)
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 tick, now, wait;
+    Uint32 interval, delay;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -129,68 +304,87 @@ SDL_TimerThread(void *_data)
         }
         SDL_AtomicUnlock(&data->lock);
 
-        /* Sort the pending timers into our list */
+        freelist_head = NULL;
+        freelist_tail = NULL;
+
+        /* Sort the pending timers into our heap */
         while (pending) {
             current = pending;
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
+            if (!SDL_AddTimerInternal(data, current)) {
+                /* Out of memory, the timer will never fire */
+                SDL_RetireTimer(current, &freelist_head, &freelist_tail);
+            }
+        }
+
+        /* Once more than half the heap is canceled, sweep it */
+        if (SDL_AtomicGet(&data->canceled) > data->num_timers / 2) {
+            SDL_AtomicSet(&data->canceled, 0);
+            SDL_PurgeCanceledTimers(data, &freelist_head, &freelist_tail);
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
 
         /* Check to see if we're still running, after maintenance */
         if (!data->active) {
             break;
         }
 
-        /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
-
-        tick = SDL_GetTicks();
+        tick = SDL_GetPerformanceCounter();
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
-            if ((Sint32)(tick-current->scheduled) < 0) {
-                /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
+            if (tick < current->scheduled) {
+                /* Scheduled for the future */
                 break;
             }
 
-            /* We're going to do something with this timer */
-            data->timers = current->next;
-
-            if (current->canceled) {
-                interval = 0;
-            } else {
-                interval = current->callback(current->interval, current->param);
+            if (data->num_workers > 0 && !current->canceled) {
+                /* Hand it to the worker pool, it comes back as pending */
+                SDL_RemoveFirstTimer(data);
+                current->next = NULL;
+                SDL_AtomicLock(&data->dispatch_lock);
+                if (data->dispatch_tail) {
+                    data->dispatch_tail->next = current;
+                } else {
+                    data->dispatch_head = current;
+                }
+                data->dispatch_tail = current;
+                SDL_AtomicUnlock(&data->dispatch_lock);
+                SDL_SemPost(data->dispatch_sem);
+                continue;
             }
 
+            interval = SDL_RunTimer(data, current);
+
             if (interval > 0) {
-                /* Reschedule this timer */
-                current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
+                /* It's still at the top of the heap */
+                SDL_RescheduleTimer(data, current, interval, tick);
+                SDL_TimerSiftDown(data, 0);
             } else {
-                if (!freelist_head) {
-                    freelist_head = current;
-                }
-                if (freelist_tail) {
-                    freelist_tail->next = current;
-                }
-                freelist_tail = current;
-
-                current->canceled = SDL_TRUE;
+                SDL_RemoveFirstTimer(data);
+                SDL_RetireTimer(current, &freelist_head, &freelist_tail);
             }
         }
 
-        /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
-        if (interval > delay) {
-            delay = 0;
-        } else {
-            delay -= interval;
+        /* Wait until the next deadline, or forever if there are no timers */
+        delay = SDL_MUTEX_MAXWAIT;
+        if (data->num_timers > 0) {
+            now = SDL_GetPerformanceCounter();
+            if (now >= data->timers[0]->scheduled) {
+                delay = 0;
+            } else {
+                wait = data->timers[0]->scheduled - now;
+                if (wait * 1000 < data->frequency) {
+                    /* Less than a millisecond left, sleep it off precisely */
+                    SDL_DelayNS((wait * 1000000000) / data->frequency);
+                    delay = 0;
+                } else {
+                    /* Wake up early and finish the wait in the next pass */
+                    delay = (Uint32) ((wait / data->frequency) * 1000 +
+                                      ((wait % data->frequency) * 1000) / data->frequency);
+                }
+            }
         }
 
         /* Note that each time a timer is added, this will return
@@ -203,6 +397,131 @@ SDL_TimerThread(void *_data)
     return 0;
 }
 
+static int
+SDL_TimerWorker(void *_data)
+{
+    SDL_TimerData *data = (SDL_TimerData *)_data;
+    SDL_Timer *current;
+    Uint32 interval;
+
+    for ( ; ; ) {
+        SDL_SemWait(data->dispatch_sem);
+
+        /* Check to see if we're still running */
+        if (!data->active) {
+            break;
+        }
+
+        SDL_AtomicLock(&data->dispatch_lock);
+        current = data->dispatch_head;
+        if (current) {
+            data->dispatch_head = current->next;
+            if (!data->dispatch_head) {
+                data->dispatch_tail = NULL;
+            }
+        }
+        SDL_AtomicUnlock(&data->dispatch_lock);
+
+        if (!current) {
+            continue;
+        }
+
+        interval = SDL_RunTimer(data, current);
+
+        /* Give the timer back to the timer thread, or to the freelist */
+        SDL_AtomicLock(&data->lock);
+        if (interval > 0) {
+            SDL_RescheduleTimer(data, current, interval, SDL_GetPerformanceCounter());
+            current->next = data->pending;
+            data->pending = current;
+        } else {
+            current->canceled = SDL_TRUE;
+            current->next = data->freelist;
+            data->freelist = current;
+        }
+        SDL_AtomicUnlock(&data->lock);
+
+        if (interval > 0) {
+            SDL_SemPost(data->sem);
+        }
+    }
+    return 0;
+}
+
+static SDL_Thread *
+SDL_CreateTimerThread(int (*fn) (void *), const char *name, SDL_TimerData *data)
+{
+    /* !!! FIXME: this is nasty. */
+#if (defined(__WIN32__) && !defined(_WIN32_WCE)) && !defined(HAVE_LIBC)
+#undef SDL_CreateThread
+    return SDL_CreateThread(fn, name, data, NULL, NULL);
+#else
+    return SDL_CreateThread(fn, name, data);
+#endif
+}
+
+/* Add an entry to the timer map -- called with the map locked */
+static SDL_bool
+SDL_AddTimerMapEntry(SDL_TimerData *data, SDL_TimerMap *entry)
+{
+    SDL_TimerMap **bucket;
+
+    if (data->timermap_count >= data->timermap_buckets) {
+        /* Grow the table so chains stay short */
+        int i, buckets = data->timermap_buckets ? 2 * data->timermap_buckets : SDL_TIMERMAP_MIN_BUCKETS;
+        SDL_TimerMap **timermap = (SDL_TimerMap **)SDL_calloc(buckets, sizeof(*timermap));
+        if (timermap) {
+            for (i = 0; i < data->timermap_buckets; ++i) {
+                while (data->timermap[i]) {
+                    SDL_TimerMap *next = data->timermap[i]->next;
+                    bucket = &timermap[data->timermap[i]->timerID & (buckets - 1)];
+                    data->timermap[i]->next = *bucket;
+                    *bucket = data->timermap[i];
+                    data->timermap[i] = next;
+                }
+            }
+            SDL_free(data->timermap);
+            data->timermap = timermap;
+            data->timermap_buckets = buckets;
+        } else if (!data->timermap) {
+            return SDL_FALSE;
+        }
+    }
+
+    bucket = &data->timermap[entry->timerID & (data->timermap_buckets - 1)];
+    entry->next = *bucket;
+    *bucket = entry;
+    ++data->timermap_count;
+    return SDL_TRUE;
+}
+
+/* Remove an entry from the timer map -- called with the map locked */
+static SDL_TimerMap *
+SDL_RemoveTimerMapEntry(SDL_TimerData *data, int id)
+{
+    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap **bucket;
+
+    if (!data->timermap) {
+        return NULL;
+    }
+
+    bucket = &data->timermap[id & (data->timermap_buckets - 1)];
+    prev = NULL;
+    for (entry = *bucket; entry; prev = entry, entry = entry->next) {
+        if (entry->timerID == id) {
+            if (prev) {
+                prev->next = entry->next;
+            } else {
+                *bucket = entry->next;
+            }
+            --data->timermap_count;
+            break;
+        }
+    }
+    return entry;
+}
+
 int
 SDL_TimerInit(void)
 {
@@ -210,6 +529,9 @@ SDL_TimerInit(void)
 
     if (!data->active) {
         const char *name = "SDLTimer";
+        const char *hint;
+        int i, num_workers;
+
         data->timermap_lock = SDL_CreateMutex();
         if (!data->timermap_lock) {
             return -1;
@@ -221,20 +543,42 @@ SDL_TimerInit(void)
             return -1;
         }
 
+        data->frequency = SDL_GetPerformanceFrequency();
         data->active = SDL_TRUE;
-        /* !!! FIXME: this is nasty. */
-#if (defined(__WIN32__) && !defined(_WIN32_WCE)) && !defined(HAVE_LIBC)
-#undef SDL_CreateThread
-        data->thread = SDL_CreateThread(SDL_TimerThread, name, data, NULL, NULL);
-#else
-        data->thread = SDL_CreateThread(SDL_TimerThread, name, data);
-#endif
+
+        /* Optionally run the callbacks on a pool of worker threads */
+        hint = SDL_GetHint(SDL_HINT_TIMER_THREADS);
+        if (hint && *hint != '0') {
+            data->dispatch_sem = SDL_CreateSemaphore(0);
+            if (!data->dispatch_sem) {
+                SDL_TimerQuit();
+                return -1;
+            }
+            /* At least two, so one slow callback can't hold up the rest */
+            num_workers = SDL_max(SDL_GetCPUCount(), 2);
+            if (num_workers > SDL_TIMER_MAX_WORKERS) {
+                num_workers = SDL_TIMER_MAX_WORKERS;
+            }
+            for (i = 0; i < num_workers; ++i) {
+                char worker_name[32];
+                SDL_snprintf(worker_name, sizeof(worker_name), "SDLTimerWorker%d", i);
+                data->workers[i] = SDL_CreateTimerThread(SDL_TimerWorker, worker_name, data);
+                if (!data->workers[i]) {
+                    SDL_TimerQuit();
+                    return -1;
+                }
+                data->num_workers = i + 1;
+            }
+        }
+
+        data->thread = SDL_CreateTimerThread(SDL_TimerThread, name, data);
         if (!data->thread) {
             SDL_TimerQuit();
             return -1;
         }
 
         SDL_AtomicSet(&data->nextID, 1);
+        SDL_AtomicSet(&data->canceled, 0);
     }
     return 0;
 }
@@ -245,6 +589,7 @@ SDL_TimerQuit(void)
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int i;
 
     if (data->active) {
         data->active = SDL_FALSE;
@@ -255,14 +600,40 @@ SDL_TimerQuit(void)
             SDL_WaitThread(data->thread, NULL);
             data->thread = NULL;
         }
+        if (data->num_workers > 0) {
+            for (i = 0; i < data->num_workers; ++i) {
+                SDL_SemPost(data->dispatch_sem);
+            }
+            for (i = 0; i < data->num_workers; ++i) {
+                SDL_WaitThread(data->workers[i], NULL);
+                data->workers[i] = NULL;
+            }
+            data->num_workers = 0;
+        }
+        if (data->dispatch_sem) {
+            SDL_DestroySemaphore(data->dispatch_sem);
+            data->dispatch_sem = NULL;
+        }
 
         SDL_DestroySemaphore(data->sem);
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
+        while (data->num_timers > 0) {
+            SDL_free(data->timers[--data->num_timers]);
+        }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->max_timers = 0;
+        while (data->dispatch_head) {
+            timer = data->dispatch_head;
+            data->dispatch_head = timer->next;
+            SDL_free(timer);
+        }
+        data->dispatch_tail = NULL;
+        while (data->pending) {
+            timer = data->pending;
+            data->pending = timer->next;
             SDL_free(timer);
         }
         while (data->freelist) {
@@ -270,11 +641,17 @@ SDL_TimerQuit(void)
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
+        for (i = 0; i < data->timermap_buckets; ++i) {
+            while (data->timermap[i]) {
+                entry = data->timermap[i];
+                data->timermap[i] = entry->next;
+                SDL_free(entry);
+            }
         }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_buckets = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
@@ -322,7 +699,7 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     timer->callback = callback;
     timer->param = param;
     timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
+    timer->scheduled = SDL_GetPerformanceCounter() + SDL_TimerCounts(data, interval);
     timer->canceled = SDL_FALSE;
  
     entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
@@ -335,8 +712,13 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     entry->timerID = timer->timerID;
 
     SDL_mutexP(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    if (!SDL_AddTimerMapEntry(data, entry)) {
+        SDL_mutexV(data->timermap_lock);
+        SDL_free(entry);
+        SDL_free(timer);
+        SDL_OutOfMemory();
+        return 0;
+    }
     SDL_mutexV(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
@@ -355,27 +737,18 @@ SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap *entry;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_mutexP(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
-    }
+    entry = SDL_RemoveTimerMapEntry(data, id);
     SDL_mutexV(data->timermap_lock);
 
     if (entry) {
         if (!entry->timer->canceled) {
             entry->timer->canceled = SDL_TRUE;
+            SDL_AtomicIncRef(&data->canceled);
             canceled = SDL_TRUE;
         }
         SDL_free(entry);
@@ -383,4 +756,65 @@ SDL_RemoveTimer(SDL_TimerID id)
     return canceled;
 }
 
+int
+SDL_GetTimerStats(SDL_TimerStats *stats, SDL_bool reset)
+{
+    SDL_TimerData *data = &SDL_timer_data;
+    int counts[SDL_TIMER_LATENCY_BUCKETS];
+    int i, total, seen;
+    Uint32 *percentiles[3];
+    int thresholds[3];
+    int which;
+
+    if (!stats) {
+        SDL_SetError("Passed a NULL stats pointer");
+        return -1;
+    }
+    if (!data->active) {
+        SDL_SetError("Timer subsystem is not running");
+        return -1;
+    }
+
+    SDL_zerop(stats);
+    stats->num_threads = data->num_workers ? data->num_workers : 1;
+    if (reset) {
+        stats->dispatched = (Uint32) SDL_AtomicSet(&data->dispatched, 0);
+        stats->latency_max = (Uint32) SDL_AtomicSet(&data->latency_max, 0);
+    } else {
+        stats->dispatched = (Uint32) SDL_AtomicGet(&data->dispatched);
+        stats->latency_max = (Uint32) SDL_AtomicGet(&data->latency_max);
+    }
+
+    total = 0;
+    for (i = 0; i < SDL_TIMER_LATENCY_BUCKETS; ++i) {
+        if (reset) {
+            counts[i] = SDL_AtomicSet(&data->latency[i], 0);
+        } else {
+            counts[i] = SDL_AtomicGet(&data->latency[i]);
+        }
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    /* Report each percentile as the top of the bucket it falls in */
+    percentiles[0] = &stats->latency_p50;
+    percentiles[1] = &stats->latency_p90;
+    percentiles[2] = &stats->latency_p99;
+    thresholds[0] = (int) (((Sint64) total * 50 + 99) / 100);
+    thresholds[1] = (int) (((Sint64) total * 90 + 99) / 100);
+    thresholds[2] = (int) (((Sint64) total * 99 + 99) / 100);
+    seen = 0;
+    which = 0;
+    for (i = 0; i < SDL_TIMER_LATENCY_BUCKETS && which < 3; ++i) {
+        seen += counts[i];
+        while (which < 3 && seen >= thresholds[which]) {
+            *percentiles[which] = SDL_min((Uint32) 1 << i, stats->latency_max);
+            ++which;
+        }
+    }
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -59,6 +59,12 @@ SDL_Delay(Uint32 ms)
     snooze(ms * 1000);
 }
 
+void
+SDL_DelayNS(Uint64 ns)
+{
+    snooze((bigtime_t) ((ns + 999) / 1000));
+}
+
 #endif /* SDL_TIMER_BEOS */
 
 /* vi: set ts=4 sw=4 expandtab: */
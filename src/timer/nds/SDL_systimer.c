@@ -73,6 +73,13 @@ SDL_Delay(Uint32 ms)
     }
 }
 
+void
+SDL_DelayNS(Uint64 ns)
+{
+    /* The tick counter only has millisecond resolution */
+    SDL_Delay((Uint32) ((ns + 999999) / 1000000));
+}
+
 #endif /* SDL_TIMER_NDS */
 
 /* vi: set ts=4 sw=4 expandtab: */
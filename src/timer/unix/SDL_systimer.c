@@ -117,6 +117,12 @@ SDL_GetPerformanceFrequency(void)
 
 void
 SDL_Delay(Uint32 ms)
+{
+    SDL_DelayNS((Uint64) ms * 1000000);
+}
+
+void
+SDL_DelayNS(Uint64 ns)
 {
     int was_error;
 
@@ -124,15 +130,17 @@ SDL_Delay(Uint32 ms)
     struct timespec elapsed, tv;
 #else
     struct timeval tv;
-    Uint32 then, now, elapsed;
+    Uint64 us, then, now, elapsed;
 #endif
 
     /* Set the timeout interval */
 #if HAVE_NANOSLEEP
-    elapsed.tv_sec = ms / 1000;
-    elapsed.tv_nsec = (ms % 1000) * 1000000;
+    elapsed.tv_sec = ns / 1000000000;
+    elapsed.tv_nsec = ns % 1000000000;
 #else
-    then = SDL_GetTicks();
+    /* The performance counter runs at 1 or 1000 ticks per microsecond */
+    us = (ns + 999) / 1000;
+    then = SDL_GetPerformanceCounter() / (SDL_GetPerformanceFrequency() / 1000000);
 #endif
     do {
         errno = 0;
@@ -143,15 +151,15 @@ SDL_Delay(Uint32 ms)
         was_error = nanosleep(&tv, &elapsed);
 #else
         /* Calculate the time interval left (in case of interrupt) */
-        now = SDL_GetTicks();
+        now = SDL_GetPerformanceCounter() / (SDL_GetPerformanceFrequency() / 1000000);
         elapsed = (now - then);
         then = now;
-        if (elapsed >= ms) {
+        if (elapsed >= us) {
             break;
         }
-        ms -= elapsed;
-        tv.tv_sec = ms / 1000;
-        tv.tv_usec = (ms % 1000) * 1000;
+        us -= elapsed;
+        tv.tv_sec = us / 1000000;
+        tv.tv_usec = us % 1000000;
 
         was_error = select(0, NULL, NULL, NULL, &tv);
 #endif /* HAVE_NANOSLEEP */
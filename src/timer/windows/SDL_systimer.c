@@ -126,6 +126,23 @@ SDL_Delay(Uint32 ms)
     Sleep(ms);
 }
 
+void
+SDL_DelayNS(Uint64 ns)
+{
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 end = SDL_GetPerformanceCounter() +
+                 (ns / 1000000000) * freq +
+                 ((ns % 1000000000) * freq) / 1000000000;
+
+    /* Sleep() only has millisecond resolution, spin for the rest */
+    if (ns >= 1000000) {
+        Sleep((DWORD) (ns / 1000000));
+    }
+    while (SDL_GetPerformanceCounter() < end) {
+        continue;
+    }
+}
+
 #endif /* SDL_TIMER_WINDOWS */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -21,14 +21,214 @@
 #include "SDL_config.h"
 
 #include "SDL_video.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_thread.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 #include "SDL_blit_copy.h"
+#include "SDL_blit_simd.h"
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
+/* Blits of fewer pixels than this always run on the calling thread */
+#define SDL_BLIT_MIN_THREAD_PIXELS  (256 * 256)
+
+/* Each band of a threaded blit gets at least this many rows */
+#define SDL_BLIT_MIN_THREAD_ROWS    16
+
+#define SDL_BLIT_MAX_THREADS        32
+
+/* The worker threads for SDL_HINT_BLIT_THREADS.  They're started the first
+   time a blit is split and kept until SDL_Quit().  The calling thread does
+   the first band itself, the workers each take one of the others.
+ */
+typedef struct
+{
+    SDL_SpinLock busy;          /* Held by the thread running a split blit */
+    SDL_sem *work;              /* Posted for each band handed out */
+    SDL_sem *done;              /* Posted as each of those bands finishes */
+    SDL_Thread *threads[SDL_BLIT_MAX_THREADS - 1];
+    int num_threads;
+    SDL_bool quit;
+    SDL_atomic_t next_band;
+    SDL_BlitFunc blit;
+    SDL_BlitInfo bands[SDL_BLIT_MAX_THREADS];
+} SDL_BlitThreadPool;
+
+static SDL_BlitThreadPool SDL_blit_threads;
+static SDL_SpinLock SDL_blit_threads_lock;
+
+static int SDLCALL
+SDL_BlitWorker(void *data)
+{
+    SDL_BlitThreadPool *pool = (SDL_BlitThreadPool *) data;
+
+    for (;;) {
+        SDL_SemWait(pool->work);
+        if (pool->quit) {
+            break;
+        }
+        pool->blit(&pool->bands[SDL_AtomicAdd(&pool->next_band, 1)]);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+static SDL_Thread *
+SDL_CreateBlitWorker(SDL_BlitThreadPool * pool)
+{
+    char name[32];
+
+    SDL_snprintf(name, sizeof (name), "SDLBlitWorker%d", pool->num_threads);
+
+    /* !!! FIXME: this is nasty. */
+#if (defined(__WIN32__) && !defined(_WIN32_WCE)) && !defined(HAVE_LIBC)
+#undef SDL_CreateThread
+    return SDL_CreateThread(SDL_BlitWorker, name, pool, NULL, NULL);
+#else
+    return SDL_CreateThread(SDL_BlitWorker, name, pool);
+#endif
+}
+
+/* How many threads SDL_HINT_BLIT_THREADS allows for a blit */
+static int
+SDL_GetBlitThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_BLIT_THREADS);
+    int threads = 1;
+
+    if (hint) {
+        threads = SDL_atoi(hint);
+        if (threads == 0) {
+            threads = SDL_GetCPUCount();
+        }
+    }
+    if (threads < 1) {
+        threads = 1;
+    } else if (threads > SDL_BLIT_MAX_THREADS) {
+        threads = SDL_BLIT_MAX_THREADS;
+    }
+    return threads;
+}
+
+/* Split a large blit into bands of rows and run them on the worker threads.
+   Returns SDL_FALSE if the blit should run on the calling thread instead.
+ */
+static SDL_bool
+SDL_BlitThreaded(SDL_BlitFunc blit, SDL_BlitInfo * info)
+{
+    SDL_BlitThreadPool *pool = &SDL_blit_threads;
+    int threads, band, y;
+
+    /* Scaled blits step through the source from the top, so they can't be
+       started part way down */
+    if ((info->flags & SDL_COPY_NEAREST) || info->src_h != info->dst_h ||
+        info->dst_w * info->dst_h < SDL_BLIT_MIN_THREAD_PIXELS) {
+        return SDL_FALSE;
+    }
+    threads = SDL_min(SDL_GetBlitThreads(),
+                      info->dst_h / SDL_BLIT_MIN_THREAD_ROWS);
+    if (threads < 2) {
+        return SDL_FALSE;
+    }
+
+    SDL_AtomicLock(&SDL_blit_threads_lock);
+    if (!pool->work) {
+        pool->work = SDL_CreateSemaphore(0);
+        pool->done = SDL_CreateSemaphore(0);
+        if (!pool->work || !pool->done) {
+            if (pool->work) {
+                SDL_DestroySemaphore(pool->work);
+                pool->work = NULL;
+            }
+            if (pool->done) {
+                SDL_DestroySemaphore(pool->done);
+                pool->done = NULL;
+            }
+            SDL_AtomicUnlock(&SDL_blit_threads_lock);
+            return SDL_FALSE;
+        }
+    }
+    SDL_AtomicUnlock(&SDL_blit_threads_lock);
+
+    /* Blits on other threads meanwhile just run on their own thread */
+    if (!SDL_AtomicTryLock(&pool->busy)) {
+        return SDL_FALSE;
+    }
+    while (pool->num_threads < threads - 1) {
+        SDL_Thread *thread = SDL_CreateBlitWorker(pool);
+        if (!thread) {
+            break;
+        }
+        pool->threads[pool->num_threads++] = thread;
+    }
+    threads = SDL_min(threads, pool->num_threads + 1);
+    if (threads < 2) {
+        SDL_AtomicUnlock(&pool->busy);
+        return SDL_FALSE;
+    }
+
+    /* The rows are shared out as evenly as possible */
+    y = 0;
+    for (band = 0; band < threads; ++band) {
+        SDL_BlitInfo *bandinfo = &pool->bands[band];
+        const int rows = (info->dst_h - y) / (threads - band);
+
+        *bandinfo = *info;
+        bandinfo->src += y * info->src_pitch;
+        bandinfo->dst += y * info->dst_pitch;
+        bandinfo->src_h = rows;
+        bandinfo->dst_h = rows;
+        y += rows;
+    }
+    pool->blit = blit;
+    SDL_AtomicSet(&pool->next_band, 1);
+    for (band = 1; band < threads; ++band) {
+        SDL_SemPost(pool->work);
+    }
+    blit(&pool->bands[0]);
+    for (band = 1; band < threads; ++band) {
+        SDL_SemWait(pool->done);
+    }
+
+    SDL_AtomicUnlock(&pool->busy);
+    return SDL_TRUE;
+}
+
+void
+SDL_QuitBlitThreads(void)
+{
+    SDL_BlitThreadPool *pool = &SDL_blit_threads;
+    int i;
+
+    SDL_AtomicLock(&SDL_blit_threads_lock);
+    if (pool->num_threads > 0) {
+        pool->quit = SDL_TRUE;
+        for (i = 0; i < pool->num_threads; ++i) {
+            SDL_SemPost(pool->work);
+        }
+        for (i = 0; i < pool->num_threads; ++i) {
+            SDL_WaitThread(pool->threads[i], NULL);
+            pool->threads[i] = NULL;
+        }
+        pool->num_threads = 0;
+        pool->quit = SDL_FALSE;
+    }
+    if (pool->work) {
+        SDL_DestroySemaphore(pool->work);
+        pool->work = NULL;
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+        pool->done = NULL;
+    }
+    SDL_AtomicUnlock(&SDL_blit_threads_lock);
+}
+
 /* The general purpose software blit routine */
 static int
 SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
@@ -84,8 +284,11 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
         RunBlit = (SDL_BlitFunc) src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, large ones maybe split across
+           threads unless the bands could overlap each other */
+        if (src == dst || !SDL_BlitThreaded(RunBlit, info)) {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -124,44 +327,55 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+/* Get the CPU features the blitters may use */
+Uint32
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck;
     static Uint32 features = 0xffffffff;
+    const char *override = SDL_GetHint(SDL_HINT_BLIT_CPU_FEATURES);
 
-    /* Get the available CPU features */
-    if (features == 0xffffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    /* Allow an override for testing .. */
+    if (override) {
+        Uint32 allowed = SDL_CPU_ANY;
 
-        features = SDL_CPU_ANY;
+        SDL_sscanf(override, "%u", &allowed);
+        return allowed;
+    }
 
-        /* Allow an override for testing .. */
-        if (override) {
-            SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+    if (features == 0xffffffff) {
+        features = SDL_CPU_ANY;
+        if (SDL_HasMMX()) {
+            features |= SDL_CPU_MMX;
+        }
+        if (SDL_Has3DNow()) {
+            features |= SDL_CPU_3DNOW;
+        }
+        if (SDL_HasSSE()) {
+            features |= SDL_CPU_SSE;
+        }
+        if (SDL_HasSSE2()) {
+            features |= SDL_CPU_SSE2;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasAltiVec()) {
+            if (SDL_UseAltivecPrefetch()) {
+                features |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
     }
+    return features;
+}
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -243,10 +457,18 @@ SDL_CalculateBlit(SDL_Surface * surface)
         blit = SDL_CalculateBlit0(surface);
     } else if (surface->format->BytesPerPixel == 1) {
         blit = SDL_CalculateBlit1(surface);
-    } else if (map->info.flags & SDL_COPY_BLEND) {
-        blit = SDL_CalculateBlitA(surface);
     } else {
-        blit = SDL_CalculateBlitN(surface);
+        /* The SIMD blitters give the same results as the ones they replace */
+        blit = SDL_ChooseBlitFunc(surface->format->format,
+                                  dst->format->format, map->info.flags,
+                                  SDL_SIMDBlitFuncTable);
+        if (blit == NULL) {
+            if (map->info.flags & SDL_COPY_BLEND) {
+                blit = SDL_CalculateBlitA(surface);
+            } else {
+                blit = SDL_CalculateBlitN(surface);
+            }
+        }
     }
     if (blit == NULL) {
         Uint32 src_format = surface->format->format;
@@ -26,6 +26,7 @@
 #include "SDL_cpuinfo.h"
 #include "SDL_endian.h"
 #include "SDL_surface.h"
+#include "../SDL_simd_c.h"
 
 /* Table to do pixel byte expansion */
 extern Uint8* SDL_expand_byte[9];
@@ -51,6 +52,7 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
 
 typedef struct
 {
@@ -98,6 +100,14 @@ typedef struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern Uint32 SDL_GetBlitCPUFeatures(void);
+extern void SDL_QuitBlitThreads(void);
+
+/* Functions found in SDL_stretch.c */
+extern int SDL_StretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                             SDL_Surface * dst, const SDL_Rect * dstrect,
+                             const SDL_Rect * cliprect);
+extern void SDL_QuitStretch(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
@@ -27,6 +27,13 @@
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2_TARGET
+#include <immintrin.h>
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
     int srcy, srcx;
@@ -7356,7 +7363,5382 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+/* The vectorized blitters unpack each source pixel to 16 bits per channel
+   in the destination's byte order, alpha last, so every format pair uses
+   the same arithmetic.  The blend mode and modulation are fixed for each
+   loop, so there are no branches per pixel, and the results are exactly
+   the same as the C blitters above.
+ */
+#if defined(__SSE2__) || defined(HAVE_AVX2_TARGET)
+
+/* The modulation of each destination channel, 255 if it isn't modulated */
+static void
+SDL_BlitAutoModulate(const SDL_BlitInfo *info, int r, int b, Uint16 modulate[4])
+{
+    const int flags = info->flags;
+
+    modulate[r] = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    modulate[1] = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    modulate[b] = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    modulate[3] = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+}
+
+#endif /* __SSE2__ || HAVE_AVX2_TARGET */
+
+#ifdef __SSE2__
+
+/* x * y / 255 for 16-bit lanes holding products up to 255 * 255 */
+#define SDL_BLIT_AUTO_MULDIV255_SSE2(x, y) \
+    _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16((x), (y)), \
+                                   _mm_set1_epi16((short) 0x8081)), 7)
+
+/* Copy channel 3 (alpha) into the other three of each pixel */
+#define SDL_BLIT_AUTO_ALPHA_SSE2(x) \
+    _mm_shufflehi_epi16(_mm_shufflelo_epi16((x), 0xFF), 0xFF)
+
+/* Four pixels from SRC through KERNEL to DST.  The kernel sees the source
+   pixels in 's', alpha filled in if the source has none, and unpacked in
+   the destination's order in 's_lo' and 's_hi'. */
+#define SDL_BLIT_AUTO_PIXELS_SSE2(SRC, DST, ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const __m128i s = _mm_or_si128((SRC), _mm_set1_epi32(SRC_ALPHA)); \
+        const __m128i d = _mm_loadu_si128((const __m128i *) (DST)); \
+        const __m128i s_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16( \
+            _mm_unpacklo_epi8(s, _mm_setzero_si128()), ORDER), ORDER); \
+        const __m128i s_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16( \
+            _mm_unpackhi_epi8(s, _mm_setzero_si128()), ORDER), ORDER); \
+        (void) s; (void) d; (void) s_lo; (void) s_hi; \
+        _mm_storeu_si128((__m128i *) (DST), KERNEL); \
+    }
+
+/* Every row, four pixels at a time.  The end of each row goes through a
+   small buffer so nothing past the row is touched. */
+#define SDL_BLIT_AUTO_LOOP_SSE2(ORDER, SRC_ALPHA, KERNEL) \
+    while (info->dst_h--) { \
+        const Uint32 *src = (const Uint32 *) info->src; \
+        Uint32 *dst = (Uint32 *) info->dst; \
+        int n = info->dst_w; \
+        while (n >= 4) { \
+            SDL_BLIT_AUTO_PIXELS_SSE2(_mm_loadu_si128((const __m128i *) src), \
+                                      dst, ORDER, SRC_ALPHA, KERNEL); \
+            src += 4; \
+            dst += 4; \
+            n -= 4; \
+        } \
+        if (n > 0) { \
+            Uint32 tail[8]; \
+            SDL_zero(tail); \
+            SDL_memcpy(tail, src, n * sizeof (Uint32)); \
+            SDL_memcpy(tail + 4, dst, n * sizeof (Uint32)); \
+            SDL_BLIT_AUTO_PIXELS_SSE2(_mm_loadu_si128((const __m128i *) tail), \
+                                      tail + 4, ORDER, SRC_ALPHA, KERNEL); \
+            SDL_memcpy(dst, tail + 4, n * sizeof (Uint32)); \
+        } \
+        info->src += info->src_pitch; \
+        info->dst += info->dst_pitch; \
+    }
+
+/* The same for scaling, picking source pixels like the C blitters do */
+#define SDL_BLIT_AUTO_SCALE_LOOP_SSE2(ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const int incy = (info->src_h << 16) / info->dst_h; \
+        const int incx = (info->src_w << 16) / info->dst_w; \
+        int srcy = 0, posy = 0; \
+        while (info->dst_h--) { \
+            const Uint32 *src; \
+            Uint32 *dst = (Uint32 *) info->dst; \
+            int n = info->dst_w, posx = 0; \
+            while (posy >= 0x10000L) { \
+                ++srcy; \
+                posy -= 0x10000L; \
+            } \
+            src = (const Uint32 *) (info->src + srcy * info->src_pitch); \
+            while (n >= 4) { \
+                SDL_BLIT_AUTO_PIXELS_SSE2(_mm_set_epi32( \
+                    (int) src[(posx + 3 * incx) >> 16], \
+                    (int) src[(posx + 2 * incx) >> 16], \
+                    (int) src[(posx + incx) >> 16], \
+                    (int) src[posx >> 16]), dst, ORDER, SRC_ALPHA, KERNEL); \
+                posx += 4 * incx; \
+                src += posx >> 16; \
+                posx &= 0xFFFF; \
+                dst += 4; \
+                n -= 4; \
+            } \
+            if (n > 0) { \
+                Uint32 tail[8]; \
+                int i; \
+                SDL_zero(tail); \
+                for (i = 0; i < n; ++i) { \
+                    tail[i] = src[posx >> 16]; \
+                    posx += incx; \
+                } \
+                SDL_memcpy(tail + 4, dst, n * sizeof (Uint32)); \
+                SDL_BLIT_AUTO_PIXELS_SSE2(_mm_loadu_si128((const __m128i *) tail), \
+                                          tail + 4, ORDER, SRC_ALPHA, KERNEL); \
+                SDL_memcpy(dst, tail + 4, n * sizeof (Uint32)); \
+            } \
+            posy += incy; \
+            info->dst += info->dst_pitch; \
+        } \
+    }
+
+static __inline__ __m128i
+SDL_BlitAutoModulate_SSE2(const SDL_BlitInfo *info, int r, int b)
+{
+    Uint16 m[4];
+
+    SDL_BlitAutoModulate(info, r, b, m);
+    return _mm_set_epi16(m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0]);
+}
+
+/* The pixels written for unpacked source pixels and the destination ones.
+   The _Blend blitters (blend set) use the blend mode and keep the
+   destination alpha, the others write the source alpha.  Destinations
+   without alpha get zero in the top byte. */
+static __inline__ __m128i
+SDL_BlitAutoKernel_SSE2(__m128i s_lo, __m128i s_hi, __m128i d,
+                        const int modulate, const int blend, const int mode,
+                        __m128i modulation, const Uint32 dst_amask)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+    const __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+    __m128i a_lo, a_hi;
+
+    if (modulate) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_SSE2(s_lo, modulation);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_SSE2(s_hi, modulation);
+    }
+    if (!blend) {
+        return _mm_and_si128(_mm_packus_epi16(s_lo, s_hi),
+                             _mm_or_si128(rgb, _mm_set1_epi32(dst_amask)));
+    }
+
+    a_lo = SDL_BLIT_AUTO_ALPHA_SSE2(s_lo);
+    a_hi = SDL_BLIT_AUTO_ALPHA_SSE2(s_hi);
+    if (mode == SDL_COPY_BLEND || mode == SDL_COPY_ADD) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_SSE2(s_lo, a_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_SSE2(s_hi, a_hi);
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        s_lo = _mm_add_epi16(s_lo, SDL_BLIT_AUTO_MULDIV255_SSE2(
+            _mm_sub_epi16(_mm_set1_epi16(255), a_lo), d_lo));
+        s_hi = _mm_add_epi16(s_hi, SDL_BLIT_AUTO_MULDIV255_SSE2(
+            _mm_sub_epi16(_mm_set1_epi16(255), a_hi), d_hi));
+        break;
+    case SDL_COPY_ADD:
+        /* The pack below saturates at 255 */
+        s_lo = _mm_add_epi16(s_lo, d_lo);
+        s_hi = _mm_add_epi16(s_hi, d_hi);
+        break;
+    case SDL_COPY_MOD:
+        s_lo = SDL_BLIT_AUTO_MULDIV255_SSE2(s_lo, d_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_SSE2(s_hi, d_hi);
+        break;
+    default:
+        s_lo = d_lo;
+        s_hi = d_hi;
+        break;
+    }
+    return _mm_or_si128(_mm_and_si128(_mm_packus_epi16(s_lo, s_hi), rgb),
+                        _mm_and_si128(d, _mm_set1_epi32(dst_amask)));
+}
+
+static void SDL_Blit_RGB888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0, s);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0xFF000000));
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0, s);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0xFF000000));
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0, s);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0xFF000000));
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xE4, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0xFF000000));
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0xC6, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0));
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x39, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm_setzero_si128(), 0xFF000000));
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm_setzero_si128(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+        SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const __m128i modulation = SDL_BlitAutoModulate_SSE2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_SSE2(0x1B, 0,
+            SDL_BlitAutoKernel_SSE2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+#endif /* __SSE2__ */
+
+#ifdef HAVE_AVX2_TARGET
+
+#define SDL_BLIT_AUTO_MULDIV255_AVX2(x, y) \
+    _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16((x), (y)), \
+                                         _mm256_set1_epi16((short) 0x8081)), 7)
+
+#define SDL_BLIT_AUTO_ALPHA_AVX2(x) \
+    _mm256_shufflehi_epi16(_mm256_shufflelo_epi16((x), 0xFF), 0xFF)
+
+#define SDL_BLIT_AUTO_PIXELS_AVX2(SRC, DST, ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const __m256i s = _mm256_or_si256((SRC), _mm256_set1_epi32(SRC_ALPHA)); \
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (DST)); \
+        const __m256i s_lo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16( \
+            _mm256_unpacklo_epi8(s, _mm256_setzero_si256()), ORDER), ORDER); \
+        const __m256i s_hi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16( \
+            _mm256_unpackhi_epi8(s, _mm256_setzero_si256()), ORDER), ORDER); \
+        (void) s; (void) d; (void) s_lo; (void) s_hi; \
+        _mm256_storeu_si256((__m256i *) (DST), KERNEL); \
+    }
+
+#define SDL_BLIT_AUTO_LOOP_AVX2(ORDER, SRC_ALPHA, KERNEL) \
+    while (info->dst_h--) { \
+        const Uint32 *src = (const Uint32 *) info->src; \
+        Uint32 *dst = (Uint32 *) info->dst; \
+        int n = info->dst_w; \
+        while (n >= 8) { \
+            SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_loadu_si256((const __m256i *) src), \
+                                      dst, ORDER, SRC_ALPHA, KERNEL); \
+            src += 8; \
+            dst += 8; \
+            n -= 8; \
+        } \
+        if (n > 0) { \
+            Uint32 tail[16]; \
+            SDL_zero(tail); \
+            SDL_memcpy(tail, src, n * sizeof (Uint32)); \
+            SDL_memcpy(tail + 8, dst, n * sizeof (Uint32)); \
+            SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_loadu_si256((const __m256i *) tail), \
+                                      tail + 8, ORDER, SRC_ALPHA, KERNEL); \
+            SDL_memcpy(dst, tail + 8, n * sizeof (Uint32)); \
+        } \
+        info->src += info->src_pitch; \
+        info->dst += info->dst_pitch; \
+    }
+
+/* Eight source pixels are gathered at once, 'steps' holds their offsets
+   from 'posx' */
+#define SDL_BLIT_AUTO_SCALE_LOOP_AVX2(ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const int incy = (info->src_h << 16) / info->dst_h; \
+        const int incx = (info->src_w << 16) / info->dst_w; \
+        const __m256i steps = _mm256_mullo_epi32(_mm256_set1_epi32(incx), \
+            _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0)); \
+        int srcy = 0, posy = 0; \
+        while (info->dst_h--) { \
+            const Uint32 *src; \
+            Uint32 *dst = (Uint32 *) info->dst; \
+            int n = info->dst_w, posx = 0; \
+            while (posy >= 0x10000L) { \
+                ++srcy; \
+                posy -= 0x10000L; \
+            } \
+            src = (const Uint32 *) (info->src + srcy * info->src_pitch); \
+            while (n >= 8) { \
+                SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_i32gather_epi32( \
+                    (const int *) src, _mm256_srli_epi32(_mm256_add_epi32( \
+                        _mm256_set1_epi32(posx), steps), 16), 4), \
+                    dst, ORDER, SRC_ALPHA, KERNEL); \
+                posx += 8 * incx; \
+                src += posx >> 16; \
+                posx &= 0xFFFF; \
+                dst += 8; \
+                n -= 8; \
+            } \
+            if (n > 0) { \
+                Uint32 tail[16]; \
+                int i; \
+                SDL_zero(tail); \
+                for (i = 0; i < n; ++i) { \
+                    tail[i] = src[posx >> 16]; \
+                    posx += incx; \
+                } \
+                SDL_memcpy(tail + 8, dst, n * sizeof (Uint32)); \
+                SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_loadu_si256((const __m256i *) tail), \
+                                          tail + 8, ORDER, SRC_ALPHA, KERNEL); \
+                SDL_memcpy(dst, tail + 8, n * sizeof (Uint32)); \
+            } \
+            posy += incy; \
+            info->dst += info->dst_pitch; \
+        } \
+    }
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_BlitAutoModulate_AVX2(const SDL_BlitInfo *info, int r, int b)
+{
+    Uint16 m[4];
+    __m128i modulation;
+
+    SDL_BlitAutoModulate(info, r, b, m);
+    modulation = _mm_set_epi16(m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0]);
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(modulation),
+                                   modulation, 1);
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_BlitAutoKernel_AVX2(__m256i s_lo, __m256i s_hi, __m256i d,
+                        const int modulate, const int blend, const int mode,
+                        __m256i modulation, const Uint32 dst_amask)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i d_lo = _mm256_unpacklo_epi8(d, zero);
+    const __m256i d_hi = _mm256_unpackhi_epi8(d, zero);
+    __m256i a_lo, a_hi;
+
+    if (modulate) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_AVX2(s_lo, modulation);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_AVX2(s_hi, modulation);
+    }
+    if (!blend) {
+        return _mm256_and_si256(_mm256_packus_epi16(s_lo, s_hi),
+                                _mm256_or_si256(rgb, _mm256_set1_epi32(dst_amask)));
+    }
+
+    a_lo = SDL_BLIT_AUTO_ALPHA_AVX2(s_lo);
+    a_hi = SDL_BLIT_AUTO_ALPHA_AVX2(s_hi);
+    if (mode == SDL_COPY_BLEND || mode == SDL_COPY_ADD) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_AVX2(s_lo, a_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_AVX2(s_hi, a_hi);
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        s_lo = _mm256_add_epi16(s_lo, SDL_BLIT_AUTO_MULDIV255_AVX2(
+            _mm256_sub_epi16(_mm256_set1_epi16(255), a_lo), d_lo));
+        s_hi = _mm256_add_epi16(s_hi, SDL_BLIT_AUTO_MULDIV255_AVX2(
+            _mm256_sub_epi16(_mm256_set1_epi16(255), a_hi), d_hi));
+        break;
+    case SDL_COPY_ADD:
+        s_lo = _mm256_add_epi16(s_lo, d_lo);
+        s_hi = _mm256_add_epi16(s_hi, d_hi);
+        break;
+    case SDL_COPY_MOD:
+        s_lo = SDL_BLIT_AUTO_MULDIV255_AVX2(s_lo, d_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_AVX2(s_hi, d_hi);
+        break;
+    default:
+        s_lo = d_lo;
+        s_hi = d_hi;
+        break;
+    }
+    return _mm256_or_si256(_mm256_and_si256(_mm256_packus_epi16(s_lo, s_hi), rgb),
+                           _mm256_and_si256(d, _mm256_set1_epi32(dst_amask)));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0, s);
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0, s);
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0xFF000000,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0, s);
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xE4, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0xC6, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 0, 2);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x39, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 0, 0,
+                                _mm256_setzero_si256(), 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_BLEND,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_ADD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, SDL_COPY_MOD,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 0, 1, 0,
+                                    _mm256_setzero_si256(), 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+        SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 0, 0,
+                                modulation, 0xFF000000));
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+static void SDL_TARGET_AVX2 SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i modulation = SDL_BlitAutoModulate_AVX2(info, 2, 0);
+
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_BLEND,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_ADD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_ADD,
+                                    modulation, 0xFF000000));
+        break;
+    case SDL_COPY_MOD:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, SDL_COPY_MOD,
+                                    modulation, 0xFF000000));
+        break;
+    default:
+        SDL_BLIT_AUTO_SCALE_LOOP_AVX2(0x1B, 0,
+            SDL_BlitAutoKernel_AVX2(s_lo, s_hi, d, 1, 1, 0,
+                                    modulation, 0xFF000000));
+        break;
+    }
+}
+
+#endif /* HAVE_AVX2_TARGET */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#ifdef HAVE_AVX2_TARGET
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
@@ -0,0 +1,608 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_config.h"
+
+#include "SDL_video.h"
+#include "SDL_blit.h"
+#include "SDL_blit_simd.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2_TARGET
+#include <immintrin.h>
+#endif
+
+/* SSE2 and AVX2 blitters between ARGB8888, RGB888, ABGR8888 and BGR888.
+
+   They stand in for the C blitters SDL_CalculateBlit() would otherwise
+   pick, and give exactly the same pixels for the same flags:
+     none          BlitNtoN(), BlitNtoNCopyAlpha(), Blit4to4MaskAlpha()
+     colorkey      BlitNtoNKey(), BlitNtoNKeyCopyAlpha()
+     blend         BlitRGBtoRGBPixelAlpha() (>> 8) when the RGB layout is
+                   the same, BlitNtoNPixelAlpha() (/ 255) when it isn't
+     anything else the SDL_blit_auto.c blitters, or SDL_Blit_Slow() for
+                   a colorkey with other flags
+   so SDL_HINT_BLIT_CPU_FEATURES can switch tiers without changing the
+   output.  Blending a source without alpha is left to SDL_blit_A.c.
+
+   All four formats have green in bits 8-15 and alpha (or nothing) in
+   bits 24-31, so converting between them is at most swapping the bytes
+   that hold red and blue.
+ */
+
+#define SIMD_BLIT_FLAGS \
+    (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | \
+     SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_COLORKEY)
+
+#if defined(__SSE2__) || defined(HAVE_AVX2_TARGET)
+
+/* Per blit constants, the same for every tier */
+typedef struct
+{
+    Uint32 swap_keep;       /* Bits that stay put, all of them if R and B don't move */
+    Uint32 swap_mask;       /* 0xFF if R and B trade places, 0 otherwise */
+    Uint32 src_alpha;       /* Alpha OR'ed into sources without an alpha channel */
+    Uint32 dst_keep;        /* RGB, plus alpha if the destination has it */
+    Uint32 colorkey;
+    Uint32 keymask;         /* Bits of the source compared with the colorkey */
+    Uint32 keyon;           /* All bits set if the colorkey is checked */
+    Uint16 modulate[4];     /* In destination byte order, alpha last */
+} SDL_SIMDBlitParams;
+
+static void
+SDL_SetupSIMDBlit(const SDL_BlitInfo * info, SDL_SIMDBlitParams * params)
+{
+    const SDL_PixelFormat *sf = info->src_fmt;
+    const SDL_PixelFormat *df = info->dst_fmt;
+    const int flags = info->flags;
+
+    if (sf->Rshift != df->Rshift) {
+        params->swap_keep = 0xFF00FF00;
+        params->swap_mask = 0x000000FF;
+    } else {
+        params->swap_keep = 0xFFFFFFFF;
+        params->swap_mask = 0;
+    }
+    params->src_alpha = sf->Amask ? 0 : 0xFF000000;
+    params->dst_keep = 0x00FFFFFF | df->Amask;
+
+    if ((flags & SIMD_BLIT_FLAGS) == SDL_COPY_COLORKEY) {
+        /* BlitNtoNKey() ignores the source alpha */
+        params->keymask = ~sf->Amask;
+    } else {
+        /* SDL_Blit_Slow() compares the whole pixel */
+        params->keymask = 0xFFFFFFFF;
+    }
+    params->colorkey = info->colorkey & params->keymask;
+    params->keyon = (flags & SDL_COPY_COLORKEY) ? 0xFFFFFFFF : 0;
+
+    params->modulate[df->Rshift / 8] =
+        (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    params->modulate[df->Gshift / 8] =
+        (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    params->modulate[df->Bshift / 8] =
+        (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    params->modulate[3] = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+}
+
+/* Run KERNEL over every row, WIDTH pixels at a time, with 's' and 'd'
+   holding the source and destination pixels.  Kernels that don't read
+   'd' don't cost a load, the compiler drops it.  The end of each row goes
+   through a small buffer so nothing past the row is touched.
+ */
+#define SIMD_BLIT_LOOP(WIDTH, VEC, LOAD, STORE, KERNEL)     \
+    while (info->dst_h--) {                                 \
+        const Uint32 *src = (const Uint32 *) info->src;     \
+        Uint32 *dst = (Uint32 *) info->dst;                 \
+        int n = info->dst_w;                                \
+        while (n >= WIDTH) {                                \
+            const VEC s = LOAD(src);                        \
+            const VEC d = LOAD(dst);                        \
+            (void) d;                                       \
+            STORE(dst, KERNEL);                             \
+            src += WIDTH;                                   \
+            dst += WIDTH;                                   \
+            n -= WIDTH;                                     \
+        }                                                   \
+        if (n > 0) {                                        \
+            Uint32 tail[2 * WIDTH];                         \
+            SDL_zero(tail);                                 \
+            SDL_memcpy(tail, src, n * sizeof (Uint32));     \
+            SDL_memcpy(tail + WIDTH, dst, n * sizeof (Uint32)); \
+            {                                               \
+                const VEC s = LOAD(tail);                   \
+                const VEC d = LOAD(tail + WIDTH);           \
+                (void) d;                                   \
+                STORE(tail, KERNEL);                        \
+            }                                               \
+            SDL_memcpy(dst, tail, n * sizeof (Uint32));     \
+        }                                                   \
+        info->src += info->src_pitch;                       \
+        info->dst += info->dst_pitch;                       \
+    }
+
+/* Blits with modulation or a blend mode other than plain blending get a
+   loop of their own for each blend mode, with and without modulation.
+ */
+#define SIMD_BLIT_GENERIC(LOOP, KERNEL)                     \
+    switch (mode) {                                         \
+    case 0:                                                 \
+        if (modulate) {                                     \
+            LOOP(KERNEL(s, d, 0, 1, &v));                   \
+        } else {                                            \
+            LOOP(KERNEL(s, d, 0, 0, &v));                   \
+        }                                                   \
+        break;                                              \
+    case SDL_COPY_BLEND:                                    \
+        if (modulate) {                                     \
+            LOOP(KERNEL(s, d, SDL_COPY_BLEND, 1, &v));      \
+        } else {                                            \
+            LOOP(KERNEL(s, d, SDL_COPY_BLEND, 0, &v));      \
+        }                                                   \
+        break;                                              \
+    case SDL_COPY_ADD:                                      \
+        if (modulate) {                                     \
+            LOOP(KERNEL(s, d, SDL_COPY_ADD, 1, &v));        \
+        } else {                                            \
+            LOOP(KERNEL(s, d, SDL_COPY_ADD, 0, &v));        \
+        }                                                   \
+        break;                                              \
+    case SDL_COPY_MOD:                                      \
+        if (modulate) {                                     \
+            LOOP(KERNEL(s, d, SDL_COPY_MOD, 1, &v));        \
+        } else {                                            \
+            LOOP(KERNEL(s, d, SDL_COPY_MOD, 0, &v));        \
+        }                                                   \
+        break;                                              \
+    }
+
+#endif /* __SSE2__ || HAVE_AVX2_TARGET */
+
+#ifdef __SSE2__
+
+typedef struct
+{
+    __m128i swap_keep, swap_mask;
+    __m128i src_alpha, dst_keep;
+    __m128i colorkey, keymask, keyon;
+    __m128i modulate;           /* 16 bits per channel, two pixels */
+} SDL_SIMDBlitSSE2;
+
+static void
+SDL_SetupSIMDBlitSSE2(const SDL_SIMDBlitParams * params, SDL_SIMDBlitSSE2 * v)
+{
+    v->swap_keep = _mm_set1_epi32(params->swap_keep);
+    v->swap_mask = _mm_set1_epi32(params->swap_mask);
+    v->src_alpha = _mm_set1_epi32(params->src_alpha);
+    v->dst_keep = _mm_set1_epi32(params->dst_keep);
+    v->colorkey = _mm_set1_epi32(params->colorkey);
+    v->keymask = _mm_set1_epi32(params->keymask);
+    v->keyon = _mm_set1_epi32(params->keyon);
+    v->modulate = _mm_set_epi16(params->modulate[3], params->modulate[2],
+                                params->modulate[1], params->modulate[0],
+                                params->modulate[3], params->modulate[2],
+                                params->modulate[1], params->modulate[0]);
+}
+
+#define LOAD_SSE2(p)        _mm_loadu_si128((const __m128i *) (p))
+#define STORE_SSE2(p, v)    _mm_storeu_si128((__m128i *) (p), (v))
+#define LOOP_SSE2(KERNEL)   SIMD_BLIT_LOOP(4, __m128i, LOAD_SSE2, STORE_SSE2, KERNEL)
+
+/* x * y / 255 for 16-bit lanes holding products up to 255 * 255 */
+#define MULDIV255_SSE2(x, y) \
+    _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16((x), (y)), \
+                                   _mm_set1_epi16((short) 0x8081)), 7)
+
+/* Copy alpha into the other three channels of each pixel */
+#define ALPHA_SSE2(x) \
+    _mm_shufflehi_epi16(_mm_shufflelo_epi16((x), 0xFF), 0xFF)
+
+static __inline__ __m128i
+SDL_Select_SSE2(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static __inline__ __m128i
+SDL_SwapRB_SSE2(__m128i s, const SDL_SIMDBlitSSE2 * v)
+{
+    return _mm_or_si128(_mm_and_si128(s, v->swap_keep),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(s, 16),
+                                                   v->swap_mask),
+                                     _mm_slli_epi32(_mm_and_si128(s,
+                                                                  v->swap_mask),
+                                                    16)));
+}
+
+static __inline__ __m128i
+SDL_Skip_SSE2(__m128i s, const SDL_SIMDBlitSSE2 * v)
+{
+    return _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(s, v->keymask),
+                                         v->colorkey), v->keyon);
+}
+
+static __inline__ __m128i
+SDL_Copy_SSE2(__m128i s, const SDL_SIMDBlitSSE2 * v)
+{
+    return _mm_and_si128(_mm_or_si128(SDL_SwapRB_SSE2(s, v), v->src_alpha),
+                         v->dst_keep);
+}
+
+static __inline__ __m128i
+SDL_CopyKey_SSE2(__m128i s, __m128i d, const SDL_SIMDBlitSSE2 * v)
+{
+    return SDL_Select_SSE2(SDL_Skip_SSE2(s, v), d, SDL_Copy_SSE2(s, v));
+}
+
+/* d + (s - d) * alpha >> 8, opaque pixels copied and destination alpha
+   left alone, like BlitRGBtoRGBPixelAlpha() */
+static __inline__ __m128i
+SDL_BlendShift_SSE2(__m128i s, __m128i d)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xFF000000);
+    const __m128i c256 = _mm_set1_epi16(256);
+    const __m128i s_lo = _mm_unpacklo_epi8(s, zero);
+    const __m128i s_hi = _mm_unpackhi_epi8(s, zero);
+    const __m128i a_lo = ALPHA_SSE2(s_lo);
+    const __m128i a_hi = ALPHA_SSE2(s_hi);
+    __m128i lo, hi, result;
+
+    /* s * a + d * (256 - a) is at most 255 * 256, no overflow */
+    lo = _mm_add_epi16(_mm_mullo_epi16(s_lo, a_lo),
+                       _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                                       _mm_sub_epi16(c256, a_lo)));
+    hi = _mm_add_epi16(_mm_mullo_epi16(s_hi, a_hi),
+                       _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                                       _mm_sub_epi16(c256, a_hi)));
+    result = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+    result = SDL_Select_SSE2(_mm_cmpeq_epi32(_mm_and_si128(s, amask), amask),
+                             s, result);
+    return SDL_Select_SSE2(amask, d, result);
+}
+
+/* d + (s - d) * alpha / 255 rounded towards d, transparent pixels skipped,
+   like BlitNtoNPixelAlpha() */
+static __inline__ __m128i
+SDL_BlendDiv_SSE2(__m128i s, __m128i d, const SDL_SIMDBlitSSE2 * v)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xFF000000);
+    const __m128i p = SDL_SwapRB_SSE2(s, v);
+    const __m128i s_lo = _mm_unpacklo_epi8(p, zero);
+    const __m128i s_hi = _mm_unpackhi_epi8(p, zero);
+    const __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+    const __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+    const __m128i a_lo = ALPHA_SSE2(s_lo);
+    const __m128i a_hi = ALPHA_SSE2(s_hi);
+    __m128i lo, hi, result;
+
+    lo = _mm_sub_epi16(_mm_add_epi16(d_lo,
+                                     MULDIV255_SSE2(_mm_subs_epu16(s_lo, d_lo),
+                                                    a_lo)),
+                       MULDIV255_SSE2(_mm_subs_epu16(d_lo, s_lo), a_lo));
+    hi = _mm_sub_epi16(_mm_add_epi16(d_hi,
+                                     MULDIV255_SSE2(_mm_subs_epu16(s_hi, d_hi),
+                                                    a_hi)),
+                       MULDIV255_SSE2(_mm_subs_epu16(d_hi, s_hi), a_hi));
+    result = _mm_packus_epi16(lo, hi);
+    result = SDL_Select_SSE2(amask, _mm_and_si128(d, v->dst_keep), result);
+    return SDL_Select_SSE2(_mm_cmpeq_epi32(_mm_and_si128(s, amask), zero),
+                           d, result);
+}
+
+/* Modulation, blend modes and colorkey, like SDL_Blit_Slow() */
+static __inline__ __m128i
+SDL_Generic_SSE2(__m128i s, __m128i d, const int mode, const int modulate,
+                 const SDL_SIMDBlitSSE2 * v)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xFF000000);
+    const __m128i p = _mm_or_si128(SDL_SwapRB_SSE2(s, v), v->src_alpha);
+    __m128i s_lo = _mm_unpacklo_epi8(p, zero);
+    __m128i s_hi = _mm_unpackhi_epi8(p, zero);
+    __m128i a_lo, a_hi, result;
+
+    if (modulate) {
+        s_lo = MULDIV255_SSE2(s_lo, v->modulate);
+        s_hi = MULDIV255_SSE2(s_hi, v->modulate);
+    }
+    if (mode == SDL_COPY_BLEND || mode == SDL_COPY_ADD) {
+        a_lo = ALPHA_SSE2(s_lo);
+        a_hi = ALPHA_SSE2(s_hi);
+        s_lo = MULDIV255_SSE2(s_lo, a_lo);
+        s_hi = MULDIV255_SSE2(s_hi, a_hi);
+    }
+    if (mode == SDL_COPY_BLEND) {
+        const __m128i c255 = _mm_set1_epi16(255);
+        s_lo = _mm_add_epi16(s_lo,
+                             MULDIV255_SSE2(_mm_sub_epi16(c255, a_lo),
+                                            _mm_unpacklo_epi8(d, zero)));
+        s_hi = _mm_add_epi16(s_hi,
+                             MULDIV255_SSE2(_mm_sub_epi16(c255, a_hi),
+                                            _mm_unpackhi_epi8(d, zero)));
+    } else if (mode == SDL_COPY_ADD) {
+        /* The pack below saturates at 255 */
+        s_lo = _mm_add_epi16(s_lo, _mm_unpacklo_epi8(d, zero));
+        s_hi = _mm_add_epi16(s_hi, _mm_unpackhi_epi8(d, zero));
+    } else if (mode == SDL_COPY_MOD) {
+        s_lo = MULDIV255_SSE2(s_lo, _mm_unpacklo_epi8(d, zero));
+        s_hi = MULDIV255_SSE2(s_hi, _mm_unpackhi_epi8(d, zero));
+    }
+    result = _mm_packus_epi16(s_lo, s_hi);
+
+    if (mode == 0) {
+        /* The source alpha replaces the destination alpha */
+        result = _mm_and_si128(result, v->dst_keep);
+    } else {
+        result = SDL_Select_SSE2(amask, _mm_and_si128(d, v->dst_keep), result);
+    }
+    return SDL_Select_SSE2(SDL_Skip_SSE2(s, v), d, result);
+}
+
+static void
+SDL_Blit8888_SSE2(SDL_BlitInfo * info)
+{
+    const int flags = info->flags & SIMD_BLIT_FLAGS;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    const int modulate =
+        flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA);
+    SDL_SIMDBlitParams params;
+    SDL_SIMDBlitSSE2 v;
+
+    SDL_SetupSIMDBlit(info, &params);
+    SDL_SetupSIMDBlitSSE2(&params, &v);
+
+    if (flags == 0) {
+        LOOP_SSE2(SDL_Copy_SSE2(s, &v));
+    } else if (flags == SDL_COPY_COLORKEY) {
+        LOOP_SSE2(SDL_CopyKey_SSE2(s, d, &v));
+    } else if (flags == SDL_COPY_BLEND && !params.swap_mask) {
+        LOOP_SSE2(SDL_BlendShift_SSE2(s, d));
+    } else if (flags == SDL_COPY_BLEND) {
+        LOOP_SSE2(SDL_BlendDiv_SSE2(s, d, &v));
+    } else {
+        SIMD_BLIT_GENERIC(LOOP_SSE2, SDL_Generic_SSE2);
+    }
+}
+
+#endif /* __SSE2__ */
+
+#ifdef HAVE_AVX2_TARGET
+
+typedef struct
+{
+    __m256i swap;               /* pshufb control moving R and B */
+    __m256i src_alpha, dst_keep;
+    __m256i colorkey, keymask, keyon;
+    __m256i modulate;           /* 16 bits per channel, four pixels */
+} SDL_SIMDBlitAVX2;
+
+static void SDL_TARGET_AVX2
+SDL_SetupSIMDBlitAVX2(const SDL_SIMDBlitParams * params, SDL_SIMDBlitAVX2 * v)
+{
+    const Uint32 order = params->swap_mask ? 0x03000102 : 0x03020100;
+
+    v->swap = _mm256_add_epi8(_mm256_set1_epi32(order),
+                              _mm256_set_epi32(0x0C0C0C0C, 0x08080808,
+                                               0x04040404, 0,
+                                               0x0C0C0C0C, 0x08080808,
+                                               0x04040404, 0));
+    v->src_alpha = _mm256_set1_epi32(params->src_alpha);
+    v->dst_keep = _mm256_set1_epi32(params->dst_keep);
+    v->colorkey = _mm256_set1_epi32(params->colorkey);
+    v->keymask = _mm256_set1_epi32(params->keymask);
+    v->keyon = _mm256_set1_epi32(params->keyon);
+    v->modulate = _mm256_set1_epi64x(((Sint64) params->modulate[3] << 48) |
+                                     ((Sint64) params->modulate[2] << 32) |
+                                     ((Sint64) params->modulate[1] << 16) |
+                                     params->modulate[0]);
+}
+
+#define LOAD_AVX2(p)        _mm256_loadu_si256((const __m256i *) (p))
+#define STORE_AVX2(p, v)    _mm256_storeu_si256((__m256i *) (p), (v))
+#define LOOP_AVX2(KERNEL)   SIMD_BLIT_LOOP(8, __m256i, LOAD_AVX2, STORE_AVX2, KERNEL)
+
+#define MULDIV255_AVX2(x, y) \
+    _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16((x), (y)), \
+                                         _mm256_set1_epi16((short) 0x8081)), 7)
+
+#define ALPHA_AVX2(x) \
+    _mm256_shufflehi_epi16(_mm256_shufflelo_epi16((x), 0xFF), 0xFF)
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_Skip_AVX2(__m256i s, const SDL_SIMDBlitAVX2 * v)
+{
+    return _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_and_si256(s, v->keymask),
+                                               v->colorkey), v->keyon);
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_Copy_AVX2(__m256i s, const SDL_SIMDBlitAVX2 * v)
+{
+    return _mm256_and_si256(_mm256_or_si256(_mm256_shuffle_epi8(s, v->swap),
+                                            v->src_alpha), v->dst_keep);
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_CopyKey_AVX2(__m256i s, __m256i d, const SDL_SIMDBlitAVX2 * v)
+{
+    return _mm256_blendv_epi8(SDL_Copy_AVX2(s, v), d, SDL_Skip_AVX2(s, v));
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_BlendShift_AVX2(__m256i s, __m256i d)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(0xFF000000);
+    const __m256i c256 = _mm256_set1_epi16(256);
+    const __m256i s_lo = _mm256_unpacklo_epi8(s, zero);
+    const __m256i s_hi = _mm256_unpackhi_epi8(s, zero);
+    const __m256i a_lo = ALPHA_AVX2(s_lo);
+    const __m256i a_hi = ALPHA_AVX2(s_hi);
+    __m256i lo, hi, result;
+
+    lo = _mm256_add_epi16(_mm256_mullo_epi16(s_lo, a_lo),
+                          _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero),
+                                             _mm256_sub_epi16(c256, a_lo)));
+    hi = _mm256_add_epi16(_mm256_mullo_epi16(s_hi, a_hi),
+                          _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero),
+                                             _mm256_sub_epi16(c256, a_hi)));
+    result = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8),
+                                 _mm256_srli_epi16(hi, 8));
+    result = _mm256_blendv_epi8(result, s,
+                                _mm256_cmpeq_epi32(_mm256_and_si256(s, amask),
+                                                   amask));
+    return _mm256_blendv_epi8(result, d, amask);
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_BlendDiv_AVX2(__m256i s, __m256i d, const SDL_SIMDBlitAVX2 * v)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(0xFF000000);
+    const __m256i p = _mm256_shuffle_epi8(s, v->swap);
+    const __m256i s_lo = _mm256_unpacklo_epi8(p, zero);
+    const __m256i s_hi = _mm256_unpackhi_epi8(p, zero);
+    const __m256i d_lo = _mm256_unpacklo_epi8(d, zero);
+    const __m256i d_hi = _mm256_unpackhi_epi8(d, zero);
+    const __m256i a_lo = ALPHA_AVX2(s_lo);
+    const __m256i a_hi = ALPHA_AVX2(s_hi);
+    __m256i lo, hi, result;
+
+    lo = _mm256_sub_epi16(_mm256_add_epi16(d_lo,
+                                           MULDIV255_AVX2(_mm256_subs_epu16(s_lo, d_lo),
+                                                          a_lo)),
+                          MULDIV255_AVX2(_mm256_subs_epu16(d_lo, s_lo), a_lo));
+    hi = _mm256_sub_epi16(_mm256_add_epi16(d_hi,
+                                           MULDIV255_AVX2(_mm256_subs_epu16(s_hi, d_hi),
+                                                          a_hi)),
+                          MULDIV255_AVX2(_mm256_subs_epu16(d_hi, s_hi), a_hi));
+    result = _mm256_packus_epi16(lo, hi);
+    result = _mm256_blendv_epi8(result, _mm256_and_si256(d, v->dst_keep), amask);
+    return _mm256_blendv_epi8(result, d,
+                              _mm256_cmpeq_epi32(_mm256_and_si256(s, amask),
+                                                 zero));
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_Generic_AVX2(__m256i s, __m256i d, const int mode, const int modulate,
+                 const SDL_SIMDBlitAVX2 * v)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(0xFF000000);
+    const __m256i p = _mm256_or_si256(_mm256_shuffle_epi8(s, v->swap),
+                                      v->src_alpha);
+    __m256i s_lo = _mm256_unpacklo_epi8(p, zero);
+    __m256i s_hi = _mm256_unpackhi_epi8(p, zero);
+    __m256i a_lo, a_hi, result;
+
+    if (modulate) {
+        s_lo = MULDIV255_AVX2(s_lo, v->modulate);
+        s_hi = MULDIV255_AVX2(s_hi, v->modulate);
+    }
+    if (mode == SDL_COPY_BLEND || mode == SDL_COPY_ADD) {
+        a_lo = ALPHA_AVX2(s_lo);
+        a_hi = ALPHA_AVX2(s_hi);
+        s_lo = MULDIV255_AVX2(s_lo, a_lo);
+        s_hi = MULDIV255_AVX2(s_hi, a_hi);
+    }
+    if (mode == SDL_COPY_BLEND) {
+        const __m256i c255 = _mm256_set1_epi16(255);
+        s_lo = _mm256_add_epi16(s_lo,
+                                MULDIV255_AVX2(_mm256_sub_epi16(c255, a_lo),
+                                               _mm256_unpacklo_epi8(d, zero)));
+        s_hi = _mm256_add_epi16(s_hi,
+                                MULDIV255_AVX2(_mm256_sub_epi16(c255, a_hi),
+                                               _mm256_unpackhi_epi8(d, zero)));
+    } else if (mode == SDL_COPY_ADD) {
+        s_lo = _mm256_add_epi16(s_lo, _mm256_unpacklo_epi8(d, zero));
+        s_hi = _mm256_add_epi16(s_hi, _mm256_unpackhi_epi8(d, zero));
+    } else if (mode == SDL_COPY_MOD) {
+        s_lo = MULDIV255_AVX2(s_lo, _mm256_unpacklo_epi8(d, zero));
+        s_hi = MULDIV255_AVX2(s_hi, _mm256_unpackhi_epi8(d, zero));
+    }
+    result = _mm256_packus_epi16(s_lo, s_hi);
+
+    if (mode == 0) {
+        result = _mm256_and_si256(result, v->dst_keep);
+    } else {
+        result = _mm256_blendv_epi8(result, _mm256_and_si256(d, v->dst_keep),
+                                    amask);
+    }
+    return _mm256_blendv_epi8(result, d, SDL_Skip_AVX2(s, v));
+}
+
+static void SDL_TARGET_AVX2
+SDL_Blit8888_AVX2(SDL_BlitInfo * info)
+{
+    const int flags = info->flags & SIMD_BLIT_FLAGS;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    const int modulate =
+        flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA);
+    SDL_SIMDBlitParams params;
+    SDL_SIMDBlitAVX2 v;
+
+    SDL_SetupSIMDBlit(info, &params);
+    SDL_SetupSIMDBlitAVX2(&params, &v);
+
+    if (flags == 0) {
+        LOOP_AVX2(SDL_Copy_AVX2(s, &v));
+    } else if (flags == SDL_COPY_COLORKEY) {
+        LOOP_AVX2(SDL_CopyKey_AVX2(s, d, &v));
+    } else if (flags == SDL_COPY_BLEND && !params.swap_mask) {
+        LOOP_AVX2(SDL_BlendShift_AVX2(s, d));
+    } else if (flags == SDL_COPY_BLEND) {
+        LOOP_AVX2(SDL_BlendDiv_AVX2(s, d, &v));
+    } else {
+        SIMD_BLIT_GENERIC(LOOP_AVX2, SDL_Generic_AVX2);
+    }
+}
+
+#endif /* HAVE_AVX2_TARGET */
+
+/* Sources with alpha take every flag, the others leave blending to
+   SDL_blit_A.c, which treats them as fully transparent. */
+#define SIMD_BLIT_ENTRIES(src, flags, cpu, func) \
+    { src, SDL_PIXELFORMAT_ARGB8888, flags, cpu, func }, \
+    { src, SDL_PIXELFORMAT_RGB888, flags, cpu, func }, \
+    { src, SDL_PIXELFORMAT_ABGR8888, flags, cpu, func }, \
+    { src, SDL_PIXELFORMAT_BGR888, flags, cpu, func },
+#define SIMD_BLIT_TIER(cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_ARGB8888, SIMD_BLIT_FLAGS, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_ABGR8888, SIMD_BLIT_FLAGS, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_RGB888, \
+                      SIMD_BLIT_FLAGS & ~SDL_COPY_BLEND, cpu, func) \
+    SIMD_BLIT_ENTRIES(SDL_PIXELFORMAT_BGR888, \
+                      SIMD_BLIT_FLAGS & ~SDL_COPY_BLEND, cpu, func)
+
+SDL_BlitFuncEntry SDL_SIMDBlitFuncTable[] = {
+#ifdef HAVE_AVX2_TARGET
+    SIMD_BLIT_TIER(SDL_CPU_AVX2, SDL_Blit8888_AVX2)
+#endif
+#ifdef __SSE2__
+    SIMD_BLIT_TIER(SDL_CPU_SSE2, SDL_Blit8888_SSE2)
+#endif
+    { 0, 0, 0, 0, NULL }
+};
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -25,203 +25,295 @@
 
    April 27, 2000 - Sam Lantinga
 */
-
+#include "SDL_atomic.h"
 #include "SDL_video.h"
 #include "SDL_blit.h"
 
-/* This isn't ready for general consumption yet - it should be folded
-   into the general blitting mechanism.
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Both stretches look up which source pixels each destination column and
+   row comes from in a table that only depends on the source and
+   destination sizes, so the last few tables are kept for the next stretch
+   of the same size.  A table is shared by everything stretching with it,
+   and is only freed once nobody is.
 */
+#define SDL_STRETCH_CACHE_SIZE  8
 
-#if ((defined(_MFC_VER) && defined(_M_IX86)/* && !defined(_WIN32_WCE) still needed? */) || \
-     defined(__WATCOMC__) || \
-     (defined(__GNUC__) && defined(__i386__))) && SDL_ASSEMBLY_ROUTINES
-/* There's a bug with gcc 4.4.1 and -O2 where srcp doesn't get the correct
- * value after the first scanline.  FIXME? */
-/*#define USE_ASM_STRETCH*/
-#endif
+typedef struct SDL_StretchTable
+{
+    int src_w;
+    int dst_w;
+    int refcount;
+    SDL_bool cached;
+    Uint32 last_used;
+    int *nearest;       /* Source pixel for the nearest neighbour */
+    int *x0;            /* First source pixel for filtering */
+    int *x1;            /* Second source pixel for filtering */
+    Uint16 *weight;     /* Weight of x1 in 1/256ths, once per channel */
+} SDL_StretchTable;
 
-#ifdef USE_ASM_STRETCH
+static SDL_SpinLock SDL_stretch_lock;
+static SDL_StretchTable *SDL_stretch_cache[SDL_STRETCH_CACHE_SIZE];
+static Uint32 SDL_stretch_clock;
 
-#ifdef HAVE_MPROTECT
-#include <sys/types.h>
-#include <sys/mman.h>
-#endif
-#ifdef __GNUC__
-#define PAGE_ALIGNED __attribute__((__aligned__(4096)))
-#else
-#define PAGE_ALIGNED
-#endif
+static SDL_StretchTable *
+SDL_BuildStretchTable(int src_w, int dst_w)
+{
+    SDL_StretchTable *table;
+    Sint64 inc, pos;
+    int i, x, f;
 
-#if defined(_M_IX86) || defined(i386)
-#define PREFIX16	0x66
-#define STORE_BYTE	0xAA
-#define STORE_WORD	0xAB
-#define LOAD_BYTE	0xAC
-#define LOAD_WORD	0xAD
-#define RETURN		0xC3
-#else
-#error Need assembly opcodes for this architecture
-#endif
+    table = (SDL_StretchTable *) SDL_malloc(sizeof(*table) +
+                                            dst_w * (3 * sizeof(int) +
+                                                     4 * sizeof(Uint16)));
+    if (!table) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    table->src_w = src_w;
+    table->dst_w = dst_w;
+    table->refcount = 1;
+    table->cached = SDL_FALSE;
+    table->last_used = 0;
+    table->nearest = (int *) (table + 1);
+    table->x0 = table->nearest + dst_w;
+    table->x1 = table->x0 + dst_w;
+    table->weight = (Uint16 *) (table->x1 + dst_w);
 
-static unsigned char copy_row[4096] PAGE_ALIGNED;
+    inc = ((Sint64) src_w << 16) / dst_w;
+    for (i = 0; i < dst_w; ++i) {
+        /* The same pixels the original 16.16 stepping picked */
+        table->nearest[i] = (int) ((i * inc) >> 16);
 
-static int
-generate_rowbytes(int src_w, int dst_w, int bpp)
+        /* Filtering lines up the centers of the pixels, (i + 0.5) *
+           src_w / dst_w - 0.5 without rounding inc */
+        pos = (((Sint64) (2 * i + 1) * src_w) << 16) / (2 * dst_w) - 0x8000;
+        if (pos < 0) {
+            x = 0;
+            f = 0;
+        } else {
+            x = (int) (pos >> 16);
+            f = (int) ((pos >> 8) & 0xFF);
+        }
+        if (x >= src_w - 1) {
+            x = src_w - 1;
+            f = 0;
+        }
+        table->x0[i] = x;
+        table->x1[i] = (f ? x + 1 : x);
+        table->weight[i * 4 + 0] = f;
+        table->weight[i * 4 + 1] = f;
+        table->weight[i * 4 + 2] = f;
+        table->weight[i * 4 + 3] = f;
+    }
+    return table;
+}
+
+static SDL_StretchTable *
+SDL_GetStretchTable(int src_w, int dst_w)
 {
-    static struct
-    {
-        int bpp;
-        int src_w;
-        int dst_w;
-        int status;
-    } last;
+    SDL_StretchTable *table;
+    int i, slot;
 
-    int i;
-    int pos, inc;
-    unsigned char *eip, *fence;
-    unsigned char load, store;
-
-    /* See if we need to regenerate the copy buffer */
-    if ((src_w == last.src_w) && (dst_w == last.dst_w) && (bpp == last.bpp)) {
-        return (last.status);
-    }
-    last.bpp = bpp;
-    last.src_w = src_w;
-    last.dst_w = dst_w;
-    last.status = -1;
-
-    switch (bpp) {
-    case 1:
-        load = LOAD_BYTE;
-        store = STORE_BYTE;
-        break;
-    case 2:
-    case 4:
-        load = LOAD_WORD;
-        store = STORE_WORD;
-        break;
-    default:
-        SDL_SetError("ASM stretch of %d bytes isn't supported\n", bpp);
-        return (-1);
+    SDL_AtomicLock(&SDL_stretch_lock);
+    for (i = 0; i < SDL_STRETCH_CACHE_SIZE; ++i) {
+        table = SDL_stretch_cache[i];
+        if (table && table->src_w == src_w && table->dst_w == dst_w) {
+            ++table->refcount;
+            table->last_used = ++SDL_stretch_clock;
+            SDL_AtomicUnlock(&SDL_stretch_lock);
+            return table;
+        }
     }
-#ifdef HAVE_MPROTECT
-    /* Make the code writeable */
-    if (mprotect(copy_row, sizeof(copy_row), PROT_READ | PROT_WRITE) < 0) {
-        SDL_SetError("Couldn't make copy buffer writeable");
-        return (-1);
+    SDL_AtomicUnlock(&SDL_stretch_lock);
+
+    table = SDL_BuildStretchTable(src_w, dst_w);
+    if (!table) {
+        return NULL;
     }
-#endif
-    pos = 0x10000;
-    inc = (src_w << 16) / dst_w;
-    eip = copy_row;
-    fence = copy_row + sizeof(copy_row)-2;
-    for (i = 0; i < dst_w; ++i) {
-        while (pos >= 0x10000L) {
-            if (eip == fence) {
-                return -1;
-            }
-            if (bpp == 2) {
-                *eip++ = PREFIX16;
-            }
-            *eip++ = load;
-            pos -= 0x10000L;
+
+    /* Take an empty slot, or the least recently used unused table's */
+    SDL_AtomicLock(&SDL_stretch_lock);
+    slot = -1;
+    for (i = 0; i < SDL_STRETCH_CACHE_SIZE; ++i) {
+        SDL_StretchTable *old = SDL_stretch_cache[i];
+        if (!old) {
+            slot = i;
+            break;
         }
-        if (eip == fence) {
-            return -1;
+        if (old->refcount == 0 &&
+            (slot < 0 || old->last_used < SDL_stretch_cache[slot]->last_used)) {
+            slot = i;
         }
-        if (bpp == 2) {
-            *eip++ = PREFIX16;
+    }
+    if (slot >= 0) {
+        if (SDL_stretch_cache[slot]) {
+            SDL_free(SDL_stretch_cache[slot]);
         }
-        *eip++ = store;
-        pos += inc;
+        SDL_stretch_cache[slot] = table;
+        table->cached = SDL_TRUE;
+        table->last_used = ++SDL_stretch_clock;
     }
-    *eip++ = RETURN;
+    SDL_AtomicUnlock(&SDL_stretch_lock);
 
-#ifdef HAVE_MPROTECT
-    /* Make the code executable but not writeable */
-    if (mprotect(copy_row, sizeof(copy_row), PROT_READ | PROT_EXEC) < 0) {
-        SDL_SetError("Couldn't make copy buffer executable");
-        return (-1);
+    return table;
+}
+
+static void
+SDL_ReleaseStretchTable(SDL_StretchTable * table)
+{
+    SDL_bool cached;
+
+    if (!table) {
+        return;
+    }
+    SDL_AtomicLock(&SDL_stretch_lock);
+    --table->refcount;
+    cached = table->cached;
+    SDL_AtomicUnlock(&SDL_stretch_lock);
+
+    if (!cached) {
+        SDL_free(table);
+    }
+}
+
+void
+SDL_QuitStretch(void)
+{
+    int i;
+
+    SDL_AtomicLock(&SDL_stretch_lock);
+    for (i = 0; i < SDL_STRETCH_CACHE_SIZE; ++i) {
+        if (SDL_stretch_cache[i]) {
+            SDL_free(SDL_stretch_cache[i]);
+            SDL_stretch_cache[i] = NULL;
+        }
+    }
+    SDL_AtomicUnlock(&SDL_stretch_lock);
+}
+
+static int
+SDL_CheckStretchRects(SDL_Surface * src, const SDL_Rect ** srcrect,
+                      SDL_Rect * full_src, SDL_Surface * dst,
+                      const SDL_Rect ** dstrect, SDL_Rect * full_dst)
+{
+    if (*srcrect) {
+        if (((*srcrect)->x < 0) || ((*srcrect)->y < 0) ||
+            (((*srcrect)->x + (*srcrect)->w) > src->w) ||
+            (((*srcrect)->y + (*srcrect)->h) > src->h)) {
+            SDL_SetError("Invalid source blit rectangle");
+            return (-1);
+        }
+    } else {
+        full_src->x = 0;
+        full_src->y = 0;
+        full_src->w = src->w;
+        full_src->h = src->h;
+        *srcrect = full_src;
+    }
+
+    if (*dstrect) {
+        if (((*dstrect)->x < 0) || ((*dstrect)->y < 0) ||
+            (((*dstrect)->x + (*dstrect)->w) > dst->w) ||
+            (((*dstrect)->y + (*dstrect)->h) > dst->h)) {
+            SDL_SetError("Invalid destination blit rectangle");
+            return (-1);
+        }
+    } else {
+        full_dst->x = 0;
+        full_dst->y = 0;
+        full_dst->w = dst->w;
+        full_dst->h = dst->h;
+        *dstrect = full_dst;
     }
-#endif
-    last.status = 0;
     return (0);
 }
 
-#endif /* USE_ASM_STRETCH */
+static int
+SDL_LockStretch(SDL_Surface * src, SDL_Surface * dst,
+                int *src_locked, int *dst_locked)
+{
+    /* Lock the destination if it's in hardware */
+    *dst_locked = 0;
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            SDL_SetError("Unable to lock destination surface");
+            return (-1);
+        }
+        *dst_locked = 1;
+    }
+    /* Lock the source if it's in hardware */
+    *src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (*dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            SDL_SetError("Unable to lock source surface");
+            return (-1);
+        }
+        *src_locked = 1;
+    }
+    return (0);
+}
+
+static void
+SDL_UnlockStretch(SDL_Surface * src, SDL_Surface * dst,
+                  int src_locked, int dst_locked)
+{
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+}
 
 #define DEFINE_COPY_ROW(name, type)			\
-static void name(type *src, int src_w, type *dst, int dst_w)	\
+static void name(const type *src, const int *nearest, type *dst, int dst_w) \
 {							\
 	int i;						\
-	int pos, inc;					\
-	type pixel = 0;					\
 							\
-	pos = 0x10000;					\
-	inc = (src_w << 16) / dst_w;			\
-	for ( i=dst_w; i>0; --i ) {			\
-		while ( pos >= 0x10000L ) {		\
-			pixel = *src++;			\
-			pos -= 0x10000L;		\
-		}					\
-		*dst++ = pixel;				\
-		pos += inc;				\
+	for ( i=0; i<dst_w; ++i ) {			\
+		dst[i] = src[nearest[i]];		\
 	}						\
 }
+
 /* *INDENT-OFF* */
 DEFINE_COPY_ROW(copy_row1, Uint8)
 DEFINE_COPY_ROW(copy_row2, Uint16)
 DEFINE_COPY_ROW(copy_row4, Uint32)
 /* *INDENT-ON* */
 
-/* The ASM code doesn't handle 24-bpp stretch blits */
 static void
-copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
+copy_row3(const Uint8 * src, const int *nearest, Uint8 * dst, int dst_w)
 {
     int i;
-    int pos, inc;
-    Uint8 pixel[3] = { 0, 0, 0 };
-
-    pos = 0x10000;
-    inc = (src_w << 16) / dst_w;
-    for (i = dst_w; i > 0; --i) {
-        while (pos >= 0x10000L) {
-            pixel[0] = *src++;
-            pixel[1] = *src++;
-            pixel[2] = *src++;
-            pos -= 0x10000L;
-        }
+
+    for (i = 0; i < dst_w; ++i) {
+        const Uint8 *pixel = src + nearest[i] * 3;
         *dst++ = pixel[0];
         *dst++ = pixel[1];
         *dst++ = pixel[2];
-        pos += inc;
     }
 }
 
-/* Perform a stretch blit between two surfaces of the same format.
-   NOTE:  This function is not safe to call from multiple threads!
-*/
+/* Perform a stretch blit between two surfaces of the same format. */
 int
 SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
                 SDL_Surface * dst, const SDL_Rect * dstrect)
 {
     int src_locked;
     int dst_locked;
-    int pos, inc;
-    int dst_width;
-    int dst_maxrow;
-    int src_row, dst_row;
-    Uint8 *srcp = NULL;
+    int i;
+    Uint8 *srcp;
     Uint8 *dstp;
     SDL_Rect full_src;
     SDL_Rect full_dst;
-#ifdef USE_ASM_STRETCH
-    SDL_bool use_asm = SDL_TRUE;
-#ifdef __GNUC__
-    int u1, u2;
-#endif
-#endif /* USE_ASM_STRETCH */
+    SDL_StretchTable *cols, *rows;
     const int bpp = dst->format->BytesPerPixel;
 
     if (src->format->BitsPerPixel != dst->format->BitsPerPixel) {
@@ -230,134 +322,382 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     }
 
     /* Verify the blit rectangles */
-    if (srcrect) {
-        if ((srcrect->x < 0) || (srcrect->y < 0) ||
-            ((srcrect->x + srcrect->w) > src->w) ||
-            ((srcrect->y + srcrect->h) > src->h)) {
-            SDL_SetError("Invalid source blit rectangle");
-            return (-1);
+    if (SDL_CheckStretchRects(src, &srcrect, &full_src,
+                              dst, &dstrect, &full_dst) < 0) {
+        return (-1);
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 ||
+        dstrect->w <= 0 || dstrect->h <= 0) {
+        return (0);
+    }
+
+    /* Look up the source column and row of each destination pixel */
+    cols = SDL_GetStretchTable(srcrect->w, dstrect->w);
+    rows = SDL_GetStretchTable(srcrect->h, dstrect->h);
+    if (!cols || !rows) {
+        SDL_ReleaseStretchTable(cols);
+        SDL_ReleaseStretchTable(rows);
+        return (-1);
+    }
+
+    if (SDL_LockStretch(src, dst, &src_locked, &dst_locked) < 0) {
+        SDL_ReleaseStretchTable(cols);
+        SDL_ReleaseStretchTable(rows);
+        return (-1);
+    }
+
+    /* Perform the stretch blit */
+    for (i = 0; i < dstrect->h; ++i) {
+        dstp = (Uint8 *) dst->pixels + ((dstrect->y + i) * dst->pitch)
+            + (dstrect->x * bpp);
+        srcp = (Uint8 *) src->pixels
+            + ((srcrect->y + rows->nearest[i]) * src->pitch)
+            + (srcrect->x * bpp);
+        switch (bpp) {
+        case 1:
+            copy_row1(srcp, cols->nearest, dstp, dstrect->w);
+            break;
+        case 2:
+            copy_row2((Uint16 *) srcp, cols->nearest,
+                      (Uint16 *) dstp, dstrect->w);
+            break;
+        case 3:
+            copy_row3(srcp, cols->nearest, dstp, dstrect->w);
+            break;
+        case 4:
+            copy_row4((Uint32 *) srcp, cols->nearest,
+                      (Uint32 *) dstp, dstrect->w);
+            break;
         }
-    } else {
-        full_src.x = 0;
-        full_src.y = 0;
-        full_src.w = src->w;
-        full_src.h = src->h;
-        srcrect = &full_src;
-    }
-    if (dstrect) {
-        if ((dstrect->x < 0) || (dstrect->y < 0) ||
-            ((dstrect->x + dstrect->w) > dst->w) ||
-            ((dstrect->y + dstrect->h) > dst->h)) {
-            SDL_SetError("Invalid destination blit rectangle");
-            return (-1);
+    }
+
+    SDL_UnlockStretch(src, dst, src_locked, dst_locked);
+    SDL_ReleaseStretchTable(cols);
+    SDL_ReleaseStretchTable(rows);
+    return (0);
+}
+
+/* The bilinear stretch filters each source row it needs horizontally into
+   16 bits per channel (the channel times 256), keeping the last two, then
+   filters between those vertically.  It works on four 8 bit channels in a
+   Uint32, formats that aren't laid out like that are expanded on the way
+   in and packed again on the way out.  The vertical step drops the low 8
+   bits of each product before adding them, which is what the SSE2 code
+   can do with one multiply; both versions give exactly the same result.
+*/
+static void
+SDL_FilterRowLinear(const Uint32 * src, const SDL_StretchTable * cols,
+                    int x, int w, Uint16 * dst)
+{
+    const int *x0 = cols->x0 + x;
+    const int *x1 = cols->x1 + x;
+    const Uint16 *weight = cols->weight + x * 4;
+    int i, c;
+
+    for (i = 0; i < w; ++i) {
+        const Uint32 a = src[x0[i]];
+        const Uint32 b = src[x1[i]];
+        const int f = weight[i * 4];
+
+        for (c = 0; c < 4; ++c) {
+            const int ca = (a >> (c * 8)) & 0xFF;
+            const int cb = (b >> (c * 8)) & 0xFF;
+            *dst++ = (Uint16) (ca * (256 - f) + cb * f);
         }
-    } else {
-        full_dst.x = 0;
-        full_dst.y = 0;
-        full_dst.w = dst->w;
-        full_dst.h = dst->h;
-        dstrect = &full_dst;
     }
+}
 
-    /* Lock the destination if it's in hardware */
-    dst_locked = 0;
-    if (SDL_MUSTLOCK(dst)) {
-        if (SDL_LockSurface(dst) < 0) {
-            SDL_SetError("Unable to lock destination surface");
-            return (-1);
+static void
+SDL_BlendRowsLinear(const Uint16 * h0, const Uint16 * h1, int g, int w,
+                    Uint32 * dst)
+{
+    int i, c;
+
+    for (i = 0; i < w; ++i) {
+        Uint32 pixel = 0;
+
+        for (c = 0; c < 4; ++c) {
+            const Uint32 v = ((*h0++ * (256 - g)) >> 8) + ((*h1++ * g) >> 8);
+            pixel |= ((v + 128) >> 8) << (c * 8);
         }
-        dst_locked = 1;
+        dst[i] = pixel;
     }
-    /* Lock the source if it's in hardware */
-    src_locked = 0;
-    if (SDL_MUSTLOCK(src)) {
-        if (SDL_LockSurface(src) < 0) {
-            if (dst_locked) {
-                SDL_UnlockSurface(dst);
-            }
-            SDL_SetError("Unable to lock source surface");
-            return (-1);
+}
+
+#ifdef __SSE2__
+static void
+SDL_FilterRowLinearSSE2(const Uint32 * src, const SDL_StretchTable * cols,
+                        int x, int w, Uint16 * dst)
+{
+    const int *x0 = cols->x0 + x;
+    const int *x1 = cols->x1 + x;
+    const Uint16 *weight = cols->weight + x * 4;
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a, b, f;
+    int i;
+
+    /* a * (256 - f) + b * f as a * 256 + (b - a) * f, which fits in 16
+       bits when the arithmetic wraps */
+    for (i = 0; i + 2 <= w; i += 2) {
+        a = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int) src[x0[i]]),
+                               _mm_cvtsi32_si128((int) src[x0[i + 1]]));
+        b = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int) src[x1[i]]),
+                               _mm_cvtsi32_si128((int) src[x1[i + 1]]));
+        a = _mm_unpacklo_epi8(a, zero);
+        b = _mm_unpacklo_epi8(b, zero);
+        f = _mm_loadu_si128((const __m128i *) &weight[i * 4]);
+        _mm_storeu_si128((__m128i *) &dst[i * 4],
+                         _mm_add_epi16(_mm_slli_epi16(a, 8),
+                                       _mm_mullo_epi16(_mm_sub_epi16(b, a),
+                                                       f)));
+    }
+    if (i < w) {
+        a = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int) src[x0[i]]), zero);
+        b = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int) src[x1[i]]), zero);
+        f = _mm_loadl_epi64((const __m128i *) &weight[i * 4]);
+        _mm_storel_epi64((__m128i *) &dst[i * 4],
+                         _mm_add_epi16(_mm_slli_epi16(a, 8),
+                                       _mm_mullo_epi16(_mm_sub_epi16(b, a),
+                                                       f)));
+    }
+}
+
+/* The weights are shifted up 8 bits for the high half multiply, so a
+   weight of 256 doesn't fit and the top row on its own is a special case */
+#define SDL_BLEND_LINEAR_SSE2(p, q)                                     \
+    (g ? _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(                    \
+                _mm_mulhi_epu16(p, w0), _mm_mulhi_epu16(q, w1)), round), 8) \
+       : _mm_srli_epi16(_mm_add_epi16(p, round), 8))
+
+static void
+SDL_BlendRowsLinearSSE2(const Uint16 * h0, const Uint16 * h1, int g, int w,
+                        Uint32 * dst)
+{
+    const __m128i w0 = _mm_set1_epi16((short) ((256 - g) << 8));
+    const __m128i w1 = _mm_set1_epi16((short) (g << 8));
+    const __m128i round = _mm_set1_epi16(128);
+    __m128i lo, hi;
+    int i;
+
+    for (i = 0; i + 4 <= w; i += 4) {
+        lo = SDL_BLEND_LINEAR_SSE2(
+                _mm_loadu_si128((const __m128i *) &h0[i * 4]),
+                _mm_loadu_si128((const __m128i *) &h1[i * 4]));
+        hi = SDL_BLEND_LINEAR_SSE2(
+                _mm_loadu_si128((const __m128i *) &h0[i * 4 + 8]),
+                _mm_loadu_si128((const __m128i *) &h1[i * 4 + 8]));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packus_epi16(lo, hi));
+    }
+    for (; i < w; ++i) {
+        lo = SDL_BLEND_LINEAR_SSE2(
+                _mm_loadl_epi64((const __m128i *) &h0[i * 4]),
+                _mm_loadl_epi64((const __m128i *) &h1[i * 4]));
+        dst[i] = (Uint32) _mm_cvtsi128_si32(_mm_packus_epi16(lo, lo));
+    }
+}
+#endif /* __SSE2__ */
+
+/* Whether every channel is a whole byte, so pixels can be filtered as is */
+static SDL_bool
+SDL_IsByteAligned(const SDL_PixelFormat * fmt)
+{
+    const Uint32 masks[4] = { fmt->Rmask, fmt->Gmask, fmt->Bmask, fmt->Amask };
+    int i;
+
+    if (fmt->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < 4; ++i) {
+        if (masks[i] != 0 && masks[i] != 0x000000FF &&
+            masks[i] != 0x0000FF00 && masks[i] != 0x00FF0000 &&
+            masks[i] != 0xFF000000) {
+            return SDL_FALSE;
         }
-        src_locked = 1;
+    }
+    return SDL_TRUE;
+}
+
+/* Stretch with bilinear filtering from srcrect to dstrect, which may
+   stick out of the destination, only writing the pixels in cliprect.
+   The clipped pixels are the same as they'd be in the whole stretch.
+*/
+int
+SDL_StretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                  SDL_Surface * dst, const SDL_Rect * dstrect,
+                  const SDL_Rect * cliprect)
+{
+    SDL_PixelFormat *fmt = dst->format;
+    const int bpp = fmt->BytesPerPixel;
+    const SDL_bool aligned = SDL_IsByteAligned(fmt);
+    void (*filter) (const Uint32 *, const SDL_StretchTable *, int, int,
+                    Uint16 *) = SDL_FilterRowLinear;
+    void (*blend) (const Uint16 *, const Uint16 *, int, int, Uint32 *) =
+        SDL_BlendRowsLinear;
+    SDL_StretchTable *cols, *rows;
+    SDL_Rect area, clip, bounds;
+    Uint16 *hrow[2], *htemp;
+    int hrow_y[2];
+    Uint32 *expanded = NULL, *packed = NULL;
+    Uint8 *buffer;
+    int src_locked, dst_locked;
+    int first, last;
+    int x, y, i, j;
+
+    if (src->format->format != fmt->format) {
+        SDL_SetError("Only works with same format surfaces");
+        return (-1);
+    }
+    if ((bpp != 2 && bpp != 4) || fmt->Rloss > 8 || fmt->Gloss > 8 ||
+        fmt->Bloss > 8 || fmt->Aloss > 8) {
+        SDL_SetError("Linear stretch only works with 16 and 32 bpp surfaces"
+                     " of up to 8 bits per channel");
+        return (-1);
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 ||
+        dstrect->w <= 0 || dstrect->h <= 0) {
+        return (0);
     }
 
-    /* Set up the data... */
-    pos = 0x10000;
-    inc = (srcrect->h << 16) / dstrect->h;
-    src_row = srcrect->y;
-    dst_row = dstrect->y;
-    dst_width = dstrect->w * bpp;
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = dst->w;
+    bounds.h = dst->h;
+    if (!SDL_IntersectRect(dstrect, cliprect, &area) ||
+        !SDL_IntersectRect(&area, &bounds, &clip)) {
+        return (0);
+    }
 
-#ifdef USE_ASM_STRETCH
-    /* Write the opcodes for this stretch */
-    if ((bpp == 3) || (generate_rowbytes(srcrect->w, dstrect->w, bpp) < 0)) {
-        use_asm = SDL_FALSE;
+#ifdef __SSE2__
+    if (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2) {
+        filter = SDL_FilterRowLinearSSE2;
+        blend = SDL_BlendRowsLinearSSE2;
     }
 #endif
 
-    /* Perform the stretch blit */
-    for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
-        dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
-            + (dstrect->x * bpp);
-        while (pos >= 0x10000L) {
-            srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
-                + (srcrect->x * bpp);
-            ++src_row;
-            pos -= 0x10000L;
+    cols = SDL_GetStretchTable(srcrect->w, dstrect->w);
+    rows = SDL_GetStretchTable(srcrect->h, dstrect->h);
+    buffer = (Uint8 *) SDL_malloc(2 * clip.w * 4 * sizeof(Uint16) +
+                                  (aligned ? 0 : (srcrect->w + clip.w) *
+                                   sizeof(Uint32)));
+    if (!cols || !rows || !buffer) {
+        SDL_ReleaseStretchTable(cols);
+        SDL_ReleaseStretchTable(rows);
+        if (buffer) {
+            SDL_free(buffer);
+        } else {
+            SDL_OutOfMemory();
         }
-#ifdef USE_ASM_STRETCH
-        if (use_asm) {
-#ifdef __GNUC__
-            __asm__ __volatile__("call *%4":"=&D"(u1), "=&S"(u2)
-                                 :"0"(dstp), "1"(srcp), "r"(copy_row)
-                                 :"memory");
-#elif defined(_MSC_VER) || defined(__WATCOMC__)
-            /* *INDENT-OFF* */
-            {
-                void *code = copy_row;
-                __asm {
-                    push edi
-                    push esi
-                    mov edi, dstp
-                    mov esi, srcp
-                    call dword ptr code
-                    pop esi
-                    pop edi
+        return (-1);
+    }
+    hrow[0] = (Uint16 *) buffer;
+    hrow[1] = hrow[0] + clip.w * 4;
+    hrow_y[0] = hrow_y[1] = -1;
+    if (!aligned) {
+        expanded = (Uint32 *) (hrow[1] + clip.w * 4);
+        packed = expanded + srcrect->w;
+    }
+
+    if (SDL_LockStretch(src, dst, &src_locked, &dst_locked) < 0) {
+        SDL_ReleaseStretchTable(cols);
+        SDL_ReleaseStretchTable(rows);
+        SDL_free(buffer);
+        return (-1);
+    }
+
+    /* The source columns the clipped destination columns need */
+    x = clip.x - dstrect->x;
+    first = cols->x0[x];
+    last = cols->x1[x + clip.w - 1];
+
+    for (y = clip.y; y < clip.y + clip.h; ++y) {
+        const int row = y - dstrect->y;
+        const int g = rows->weight[row * 4];
+        Uint8 *dstp = (Uint8 *) dst->pixels + y * dst->pitch + clip.x * bpp;
+
+        /* Filter the source rows this row needs, if they aren't already */
+        for (i = 0; i < (g ? 2 : 1); ++i) {
+            const int sy = (i ? rows->x1[row] : rows->x0[row]);
+            const Uint8 *srcp;
+
+            if (hrow_y[i] == sy) {
+                continue;
+            }
+            if (hrow_y[!i] == sy) {
+                htemp = hrow[i];
+                hrow[i] = hrow[!i];
+                hrow[!i] = htemp;
+                hrow_y[!i] = hrow_y[i];
+                hrow_y[i] = sy;
+                continue;
+            }
+
+            srcp = (const Uint8 *) src->pixels +
+                (srcrect->y + sy) * src->pitch + srcrect->x * bpp;
+            if (aligned) {
+                filter((const Uint32 *) srcp, cols, x, clip.w, hrow[i]);
+            } else {
+                for (j = first; j <= last; ++j) {
+                    Uint32 pixel;
+                    unsigned R, G, B, A;
+
+                    if (bpp == 2) {
+                        pixel = ((const Uint16 *) srcp)[j];
+                    } else {
+                        pixel = ((const Uint32 *) srcp)[j];
+                    }
+                    RGBA_FROM_PIXEL(pixel, fmt, R, G, B, A);
+                    expanded[j] = (A << 24) | (R << 16) | (G << 8) | B;
                 }
+                filter(expanded, cols, x, clip.w, hrow[i]);
             }
-            /* *INDENT-ON* */
-#else
-#error Need inline assembly for this compiler
-#endif
-        } else
-#endif
-            switch (bpp) {
-            case 1:
-                copy_row1(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 2:
-                copy_row2((Uint16 *) srcp, srcrect->w,
-                          (Uint16 *) dstp, dstrect->w);
-                break;
-            case 3:
-                copy_row3(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 4:
-                copy_row4((Uint32 *) srcp, srcrect->w,
-                          (Uint32 *) dstp, dstrect->w);
-                break;
+            hrow_y[i] = sy;
+        }
+
+        if (aligned) {
+            blend(hrow[0], (g ? hrow[1] : hrow[0]), g, clip.w,
+                  (Uint32 *) dstp);
+        } else {
+            blend(hrow[0], (g ? hrow[1] : hrow[0]), g, clip.w, packed);
+            for (j = 0; j < clip.w; ++j) {
+                const Uint32 p = packed[j];
+                const unsigned R = (p >> 16) & 0xFF;
+                const unsigned G = (p >> 8) & 0xFF;
+                const unsigned B = p & 0xFF;
+                const unsigned A = p >> 24;
+                Uint32 pixel;
+
+                PIXEL_FROM_RGBA(pixel, fmt, R, G, B, A);
+                if (bpp == 2) {
+                    ((Uint16 *) dstp)[j] = (Uint16) pixel;
+                } else {
+                    ((Uint32 *) dstp)[j] = pixel;
+                }
             }
-        pos += inc;
+        }
     }
 
-    /* We need to unlock the surfaces if they're locked */
-    if (dst_locked) {
-        SDL_UnlockSurface(dst);
-    }
-    if (src_locked) {
-        SDL_UnlockSurface(src);
-    }
+    SDL_UnlockStretch(src, dst, src_locked, dst_locked);
+    SDL_ReleaseStretchTable(cols);
+    SDL_ReleaseStretchTable(rows);
+    SDL_free(buffer);
     return (0);
 }
 
+/* Perform a bilinear filtered stretch blit between two surfaces of the
+   same format.
+*/
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+
+    if (SDL_CheckStretchRects(src, &srcrect, &full_src,
+                              dst, &dstrect, &full_dst) < 0) {
+        return (-1);
+    }
+    return SDL_StretchLinear(src, srcrect, dst, dstrect, dstrect);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -225,6 +225,12 @@ struct SDL_VideoDevice
      */
     void (*PumpEvents) (_THIS);
 
+    /* Sleep until there are system events to pump, an event is posted
+       (see SDL_WaitEventWakeup()), or the timeout in ms expires.
+       A timeout of -1 waits forever.
+     */
+    void (*WaitEventTimeout) (_THIS, int timeout);
+
     /* Suspend the screensaver */
     void (*SuspendScreenSaver) (_THIS);
 
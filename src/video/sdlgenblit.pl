@@ -75,6 +75,45 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# The channels of each format from the most significant byte down, X for
+# an unused byte.  The vectorized blitters use this to reorder channels,
+# and they expect the destination to have alpha (or nothing) on top.
+my %format_channels = (
+    "RGB888" => "XRGB",
+    "BGR888" => "XBGR",
+    "ARGB8888" => "ARGB",
+    "RGBA8888" => "RGBA",
+    "ABGR8888" => "ABGR",
+    "BGRA8888" => "BGRA",
+);
+
+# The vectorized blitters, best first, with the preprocessor symbol that
+# says the compiler can build them and the attribute their functions need
+my @simd_tiers = (
+    "AVX2",
+    "SSE2",
+);
+
+my %simd_guard = (
+    "AVX2" => "HAVE_AVX2_TARGET",
+    "SSE2" => "__SSE2__",
+);
+
+my %simd_attribute = (
+    "AVX2" => " SDL_TARGET_AVX2",
+    "SSE2" => "",
+);
+
+my %simd_type = (
+    "AVX2" => "__m256i",
+    "SSE2" => "__m128i",
+);
+
+my %simd_zero = (
+    "AVX2" => "_mm256_setzero_si256()",
+    "SSE2" => "_mm_setzero_si128()",
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -82,7 +121,7 @@ sub open_file {
 /* DO NOT EDIT!  This file is generated by sdlgenblit.pl */
 /*
   Simple DirectMedia Layer
-  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+  Copyright (C) 1997-2012 Sam Lantinga <slouken\@libsdl.org>
 
   This software is provided 'as-is', without any express or implied
   warranty.  In no event will the authors be held liable for any damages
@@ -139,6 +178,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $tier = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -150,6 +190,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $tier ) {
+        print FILE "_$tier";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -380,11 +423,509 @@ sub output_copyinc
 __EOF__
 }
 
-sub output_copyfunctable
+sub output_simdinc
+{
+    print FILE <<'__EOF__';
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2_TARGET
+#include <immintrin.h>
+#endif
+
+__EOF__
+}
+
+sub output_simdcommon
+{
+    print FILE <<'__EOF__';
+/* The vectorized blitters unpack each source pixel to 16 bits per channel
+   in the destination's byte order, alpha last, so every format pair uses
+   the same arithmetic.  The blend mode and modulation are fixed for each
+   loop, so there are no branches per pixel, and the results are exactly
+   the same as the C blitters above.
+ */
+#if defined(__SSE2__) || defined(HAVE_AVX2_TARGET)
+
+/* The modulation of each destination channel, 255 if it isn't modulated */
+static void
+SDL_BlitAutoModulate(const SDL_BlitInfo *info, int r, int b, Uint16 modulate[4])
+{
+    const int flags = info->flags;
+
+    modulate[r] = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    modulate[1] = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    modulate[b] = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    modulate[3] = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+}
+
+#endif /* __SSE2__ || HAVE_AVX2_TARGET */
+
+__EOF__
+}
+
+sub output_simdhelpers
+{
+    my $tier = shift;
+
+    if ( $tier eq "SSE2" ) {
+        print FILE <<'__EOF__';
+#ifdef __SSE2__
+
+/* x * y / 255 for 16-bit lanes holding products up to 255 * 255 */
+#define SDL_BLIT_AUTO_MULDIV255_SSE2(x, y) \
+    _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16((x), (y)), \
+                                   _mm_set1_epi16((short) 0x8081)), 7)
+
+/* Copy channel 3 (alpha) into the other three of each pixel */
+#define SDL_BLIT_AUTO_ALPHA_SSE2(x) \
+    _mm_shufflehi_epi16(_mm_shufflelo_epi16((x), 0xFF), 0xFF)
+
+/* Four pixels from SRC through KERNEL to DST.  The kernel sees the source
+   pixels in 's', alpha filled in if the source has none, and unpacked in
+   the destination's order in 's_lo' and 's_hi'. */
+#define SDL_BLIT_AUTO_PIXELS_SSE2(SRC, DST, ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const __m128i s = _mm_or_si128((SRC), _mm_set1_epi32(SRC_ALPHA)); \
+        const __m128i d = _mm_loadu_si128((const __m128i *) (DST)); \
+        const __m128i s_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16( \
+            _mm_unpacklo_epi8(s, _mm_setzero_si128()), ORDER), ORDER); \
+        const __m128i s_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16( \
+            _mm_unpackhi_epi8(s, _mm_setzero_si128()), ORDER), ORDER); \
+        (void) s; (void) d; (void) s_lo; (void) s_hi; \
+        _mm_storeu_si128((__m128i *) (DST), KERNEL); \
+    }
+
+/* Every row, four pixels at a time.  The end of each row goes through a
+   small buffer so nothing past the row is touched. */
+#define SDL_BLIT_AUTO_LOOP_SSE2(ORDER, SRC_ALPHA, KERNEL) \
+    while (info->dst_h--) { \
+        const Uint32 *src = (const Uint32 *) info->src; \
+        Uint32 *dst = (Uint32 *) info->dst; \
+        int n = info->dst_w; \
+        while (n >= 4) { \
+            SDL_BLIT_AUTO_PIXELS_SSE2(_mm_loadu_si128((const __m128i *) src), \
+                                      dst, ORDER, SRC_ALPHA, KERNEL); \
+            src += 4; \
+            dst += 4; \
+            n -= 4; \
+        } \
+        if (n > 0) { \
+            Uint32 tail[8]; \
+            SDL_zero(tail); \
+            SDL_memcpy(tail, src, n * sizeof (Uint32)); \
+            SDL_memcpy(tail + 4, dst, n * sizeof (Uint32)); \
+            SDL_BLIT_AUTO_PIXELS_SSE2(_mm_loadu_si128((const __m128i *) tail), \
+                                      tail + 4, ORDER, SRC_ALPHA, KERNEL); \
+            SDL_memcpy(dst, tail + 4, n * sizeof (Uint32)); \
+        } \
+        info->src += info->src_pitch; \
+        info->dst += info->dst_pitch; \
+    }
+
+/* The same for scaling, picking source pixels like the C blitters do */
+#define SDL_BLIT_AUTO_SCALE_LOOP_SSE2(ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const int incy = (info->src_h << 16) / info->dst_h; \
+        const int incx = (info->src_w << 16) / info->dst_w; \
+        int srcy = 0, posy = 0; \
+        while (info->dst_h--) { \
+            const Uint32 *src; \
+            Uint32 *dst = (Uint32 *) info->dst; \
+            int n = info->dst_w, posx = 0; \
+            while (posy >= 0x10000L) { \
+                ++srcy; \
+                posy -= 0x10000L; \
+            } \
+            src = (const Uint32 *) (info->src + srcy * info->src_pitch); \
+            while (n >= 4) { \
+                SDL_BLIT_AUTO_PIXELS_SSE2(_mm_set_epi32( \
+                    (int) src[(posx + 3 * incx) >> 16], \
+                    (int) src[(posx + 2 * incx) >> 16], \
+                    (int) src[(posx + incx) >> 16], \
+                    (int) src[posx >> 16]), dst, ORDER, SRC_ALPHA, KERNEL); \
+                posx += 4 * incx; \
+                src += posx >> 16; \
+                posx &= 0xFFFF; \
+                dst += 4; \
+                n -= 4; \
+            } \
+            if (n > 0) { \
+                Uint32 tail[8]; \
+                int i; \
+                SDL_zero(tail); \
+                for (i = 0; i < n; ++i) { \
+                    tail[i] = src[posx >> 16]; \
+                    posx += incx; \
+                } \
+                SDL_memcpy(tail + 4, dst, n * sizeof (Uint32)); \
+                SDL_BLIT_AUTO_PIXELS_SSE2(_mm_loadu_si128((const __m128i *) tail), \
+                                          tail + 4, ORDER, SRC_ALPHA, KERNEL); \
+                SDL_memcpy(dst, tail + 4, n * sizeof (Uint32)); \
+            } \
+            posy += incy; \
+            info->dst += info->dst_pitch; \
+        } \
+    }
+
+static __inline__ __m128i
+SDL_BlitAutoModulate_SSE2(const SDL_BlitInfo *info, int r, int b)
 {
+    Uint16 m[4];
+
+    SDL_BlitAutoModulate(info, r, b, m);
+    return _mm_set_epi16(m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0]);
+}
+
+/* The pixels written for unpacked source pixels and the destination ones.
+   The _Blend blitters (blend set) use the blend mode and keep the
+   destination alpha, the others write the source alpha.  Destinations
+   without alpha get zero in the top byte. */
+static __inline__ __m128i
+SDL_BlitAutoKernel_SSE2(__m128i s_lo, __m128i s_hi, __m128i d,
+                        const int modulate, const int blend, const int mode,
+                        __m128i modulation, const Uint32 dst_amask)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+    const __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+    __m128i a_lo, a_hi;
+
+    if (modulate) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_SSE2(s_lo, modulation);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_SSE2(s_hi, modulation);
+    }
+    if (!blend) {
+        return _mm_and_si128(_mm_packus_epi16(s_lo, s_hi),
+                             _mm_or_si128(rgb, _mm_set1_epi32(dst_amask)));
+    }
+
+    a_lo = SDL_BLIT_AUTO_ALPHA_SSE2(s_lo);
+    a_hi = SDL_BLIT_AUTO_ALPHA_SSE2(s_hi);
+    if (mode == SDL_COPY_BLEND || mode == SDL_COPY_ADD) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_SSE2(s_lo, a_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_SSE2(s_hi, a_hi);
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        s_lo = _mm_add_epi16(s_lo, SDL_BLIT_AUTO_MULDIV255_SSE2(
+            _mm_sub_epi16(_mm_set1_epi16(255), a_lo), d_lo));
+        s_hi = _mm_add_epi16(s_hi, SDL_BLIT_AUTO_MULDIV255_SSE2(
+            _mm_sub_epi16(_mm_set1_epi16(255), a_hi), d_hi));
+        break;
+    case SDL_COPY_ADD:
+        /* The pack below saturates at 255 */
+        s_lo = _mm_add_epi16(s_lo, d_lo);
+        s_hi = _mm_add_epi16(s_hi, d_hi);
+        break;
+    case SDL_COPY_MOD:
+        s_lo = SDL_BLIT_AUTO_MULDIV255_SSE2(s_lo, d_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_SSE2(s_hi, d_hi);
+        break;
+    default:
+        s_lo = d_lo;
+        s_hi = d_hi;
+        break;
+    }
+    return _mm_or_si128(_mm_and_si128(_mm_packus_epi16(s_lo, s_hi), rgb),
+                        _mm_and_si128(d, _mm_set1_epi32(dst_amask)));
+}
+
+__EOF__
+    } elsif ( $tier eq "AVX2" ) {
+        print FILE <<'__EOF__';
+#ifdef HAVE_AVX2_TARGET
+
+#define SDL_BLIT_AUTO_MULDIV255_AVX2(x, y) \
+    _mm256_srli_epi16(_mm256_mulhi_epu16(_mm256_mullo_epi16((x), (y)), \
+                                         _mm256_set1_epi16((short) 0x8081)), 7)
+
+#define SDL_BLIT_AUTO_ALPHA_AVX2(x) \
+    _mm256_shufflehi_epi16(_mm256_shufflelo_epi16((x), 0xFF), 0xFF)
+
+#define SDL_BLIT_AUTO_PIXELS_AVX2(SRC, DST, ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const __m256i s = _mm256_or_si256((SRC), _mm256_set1_epi32(SRC_ALPHA)); \
+        const __m256i d = _mm256_loadu_si256((const __m256i *) (DST)); \
+        const __m256i s_lo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16( \
+            _mm256_unpacklo_epi8(s, _mm256_setzero_si256()), ORDER), ORDER); \
+        const __m256i s_hi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16( \
+            _mm256_unpackhi_epi8(s, _mm256_setzero_si256()), ORDER), ORDER); \
+        (void) s; (void) d; (void) s_lo; (void) s_hi; \
+        _mm256_storeu_si256((__m256i *) (DST), KERNEL); \
+    }
+
+#define SDL_BLIT_AUTO_LOOP_AVX2(ORDER, SRC_ALPHA, KERNEL) \
+    while (info->dst_h--) { \
+        const Uint32 *src = (const Uint32 *) info->src; \
+        Uint32 *dst = (Uint32 *) info->dst; \
+        int n = info->dst_w; \
+        while (n >= 8) { \
+            SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_loadu_si256((const __m256i *) src), \
+                                      dst, ORDER, SRC_ALPHA, KERNEL); \
+            src += 8; \
+            dst += 8; \
+            n -= 8; \
+        } \
+        if (n > 0) { \
+            Uint32 tail[16]; \
+            SDL_zero(tail); \
+            SDL_memcpy(tail, src, n * sizeof (Uint32)); \
+            SDL_memcpy(tail + 8, dst, n * sizeof (Uint32)); \
+            SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_loadu_si256((const __m256i *) tail), \
+                                      tail + 8, ORDER, SRC_ALPHA, KERNEL); \
+            SDL_memcpy(dst, tail + 8, n * sizeof (Uint32)); \
+        } \
+        info->src += info->src_pitch; \
+        info->dst += info->dst_pitch; \
+    }
+
+/* Eight source pixels are gathered at once, 'steps' holds their offsets
+   from 'posx' */
+#define SDL_BLIT_AUTO_SCALE_LOOP_AVX2(ORDER, SRC_ALPHA, KERNEL) \
+    { \
+        const int incy = (info->src_h << 16) / info->dst_h; \
+        const int incx = (info->src_w << 16) / info->dst_w; \
+        const __m256i steps = _mm256_mullo_epi32(_mm256_set1_epi32(incx), \
+            _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0)); \
+        int srcy = 0, posy = 0; \
+        while (info->dst_h--) { \
+            const Uint32 *src; \
+            Uint32 *dst = (Uint32 *) info->dst; \
+            int n = info->dst_w, posx = 0; \
+            while (posy >= 0x10000L) { \
+                ++srcy; \
+                posy -= 0x10000L; \
+            } \
+            src = (const Uint32 *) (info->src + srcy * info->src_pitch); \
+            while (n >= 8) { \
+                SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_i32gather_epi32( \
+                    (const int *) src, _mm256_srli_epi32(_mm256_add_epi32( \
+                        _mm256_set1_epi32(posx), steps), 16), 4), \
+                    dst, ORDER, SRC_ALPHA, KERNEL); \
+                posx += 8 * incx; \
+                src += posx >> 16; \
+                posx &= 0xFFFF; \
+                dst += 8; \
+                n -= 8; \
+            } \
+            if (n > 0) { \
+                Uint32 tail[16]; \
+                int i; \
+                SDL_zero(tail); \
+                for (i = 0; i < n; ++i) { \
+                    tail[i] = src[posx >> 16]; \
+                    posx += incx; \
+                } \
+                SDL_memcpy(tail + 8, dst, n * sizeof (Uint32)); \
+                SDL_BLIT_AUTO_PIXELS_AVX2(_mm256_loadu_si256((const __m256i *) tail), \
+                                          tail + 8, ORDER, SRC_ALPHA, KERNEL); \
+                SDL_memcpy(dst, tail + 8, n * sizeof (Uint32)); \
+            } \
+            posy += incy; \
+            info->dst += info->dst_pitch; \
+        } \
+    }
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_BlitAutoModulate_AVX2(const SDL_BlitInfo *info, int r, int b)
+{
+    Uint16 m[4];
+    __m128i modulation;
+
+    SDL_BlitAutoModulate(info, r, b, m);
+    modulation = _mm_set_epi16(m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0]);
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(modulation),
+                                   modulation, 1);
+}
+
+static __inline__ __m256i SDL_TARGET_AVX2
+SDL_BlitAutoKernel_AVX2(__m256i s_lo, __m256i s_hi, __m256i d,
+                        const int modulate, const int blend, const int mode,
+                        __m256i modulation, const Uint32 dst_amask)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i d_lo = _mm256_unpacklo_epi8(d, zero);
+    const __m256i d_hi = _mm256_unpackhi_epi8(d, zero);
+    __m256i a_lo, a_hi;
+
+    if (modulate) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_AVX2(s_lo, modulation);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_AVX2(s_hi, modulation);
+    }
+    if (!blend) {
+        return _mm256_and_si256(_mm256_packus_epi16(s_lo, s_hi),
+                                _mm256_or_si256(rgb, _mm256_set1_epi32(dst_amask)));
+    }
+
+    a_lo = SDL_BLIT_AUTO_ALPHA_AVX2(s_lo);
+    a_hi = SDL_BLIT_AUTO_ALPHA_AVX2(s_hi);
+    if (mode == SDL_COPY_BLEND || mode == SDL_COPY_ADD) {
+        s_lo = SDL_BLIT_AUTO_MULDIV255_AVX2(s_lo, a_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_AVX2(s_hi, a_hi);
+    }
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        s_lo = _mm256_add_epi16(s_lo, SDL_BLIT_AUTO_MULDIV255_AVX2(
+            _mm256_sub_epi16(_mm256_set1_epi16(255), a_lo), d_lo));
+        s_hi = _mm256_add_epi16(s_hi, SDL_BLIT_AUTO_MULDIV255_AVX2(
+            _mm256_sub_epi16(_mm256_set1_epi16(255), a_hi), d_hi));
+        break;
+    case SDL_COPY_ADD:
+        s_lo = _mm256_add_epi16(s_lo, d_lo);
+        s_hi = _mm256_add_epi16(s_hi, d_hi);
+        break;
+    case SDL_COPY_MOD:
+        s_lo = SDL_BLIT_AUTO_MULDIV255_AVX2(s_lo, d_lo);
+        s_hi = SDL_BLIT_AUTO_MULDIV255_AVX2(s_hi, d_hi);
+        break;
+    default:
+        s_lo = d_lo;
+        s_hi = d_hi;
+        break;
+    }
+    return _mm256_or_si256(_mm256_and_si256(_mm256_packus_epi16(s_lo, s_hi), rgb),
+                           _mm256_and_si256(d, _mm256_set1_epi32(dst_amask)));
+}
+
+__EOF__
+    }
+}
+
+# The shufflelo/shufflehi control moving the source channels to where the
+# destination has them
+sub get_simd_order
+{
+    my $src = shift;
+    my $dst = shift;
+    my $order = 0;
+
+    for (my $i = 0; $i < 4; ++$i) {
+        my $channel = substr($format_channels{$dst}, 3 - $i, 1);
+        if ( $channel eq "X" ) {
+            $channel = "A";
+        }
+        my $index = index($format_channels{$src}, $channel);
+        if ( $index < 0 ) {
+            # The source alpha is filled in where the unused byte is
+            $index = index($format_channels{$src}, "X");
+        }
+        $order |= (3 - $index) << (2 * $i);
+    }
+    return sprintf("0x%02X", $order);
+}
+
+sub get_simd_mask
+{
+    my $format = shift;
+    my $channel = shift;
+    my $index = index($format_channels{$format}, $channel);
+
+    if ( $index < 0 ) {
+        return "0";
+    }
+    return sprintf("0x%08X", 0xFF << (8 * (3 - $index)));
+}
+
+sub output_simdloop
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $tier = shift;
+    my $mode = shift;
+    my $indent = shift;
+    my $loop = $scale ? "SDL_BLIT_AUTO_SCALE_LOOP_$tier" : "SDL_BLIT_AUTO_LOOP_$tier";
+    my $modulation = $modulate ? "modulation" : $simd_zero{$tier};
+
+    if ( $src eq $dst && !$modulate && !$blend ) {
+        print FILE "${indent}$loop(0xE4, 0, s);\n";
+        return;
+    }
+    my $order = get_simd_order($src, $dst);
+    my $src_alpha = get_simd_mask($src, "X");
+    my $dst_amask = get_simd_mask($dst, "A");
     print FILE <<__EOF__;
-SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+${indent}$loop($order, $src_alpha,
+${indent}    SDL_BlitAutoKernel_$tier(s_lo, s_hi, d, $modulate, $blend, $mode,
+${indent}                            $modulation, $dst_amask));
+__EOF__
+}
+
+sub output_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $tier = shift;
+
+    output_copyfuncname("static void$simd_attribute{$tier}", $src, $dst, $modulate, $blend, $scale, 1, "\n", $tier);
+    print FILE <<__EOF__;
+{
 __EOF__
+    if ( $modulate ) {
+        my $r = 3 - index($format_channels{$dst}, "R");
+        my $b = 3 - index($format_channels{$dst}, "B");
+        print FILE <<__EOF__;
+    const $simd_type{$tier} modulation = SDL_BlitAutoModulate_$tier(info, $r, $b);
+
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    switch (info->flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+__EOF__
+        foreach my $mode ("SDL_COPY_BLEND", "SDL_COPY_ADD", "SDL_COPY_MOD", "0") {
+            if ( $mode eq "0" ) {
+                print FILE "    default:\n";
+            } else {
+                print FILE "    case $mode:\n";
+            }
+            output_simdloop($src, $dst, $modulate, $blend, $scale, $tier, $mode, "        ");
+            print FILE "        break;\n";
+        }
+        print FILE "    }\n";
+    } else {
+        output_simdloop($src, $dst, $modulate, $blend, $scale, $tier, "0", "    ");
+    }
+    print FILE <<__EOF__;
+}
+
+__EOF__
+}
+
+sub output_simdfunc_c
+{
+    my $tier = shift;
+
+    output_simdhelpers($tier);
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                for (my $blend = 0; $blend <= 1; ++$blend) {
+                    for (my $scale = 0; $scale <= 1; ++$scale) {
+                        if ( $modulate || $blend || $scale ) {
+                            output_simdfunc($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, $tier);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    print FILE "#endif /* $simd_guard{$tier} */\n\n";
+}
+
+sub output_copyfunctable_entries
+{
+    my $cpu = shift;
+    my $tier = shift;
+
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -423,14 +964,27 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            print FILE "($flags), $cpu,";
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $tier);
                         }
                     }
                 }
             }
         }
     }
+}
+
+sub output_copyfunctable
+{
+    print FILE <<__EOF__;
+SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+__EOF__
+    foreach my $tier (@simd_tiers) {
+        print FILE "#ifdef $simd_guard{$tier}\n";
+        output_copyfunctable_entries("SDL_CPU_$tier", $tier);
+        print FILE "#endif\n";
+    }
+    output_copyfunctable_entries("SDL_CPU_ANY", "");
     print FILE <<__EOF__;
     { 0, 0, 0, 0, NULL }
 };
@@ -466,10 +1020,15 @@ close_file("SDL_blit_auto.h");
 
 open_file("SDL_blit_auto.c");
 output_copyinc();
+output_simdinc();
 for (my $i = 0; $i <= $#src_formats; ++$i) {
     for (my $j = 0; $j <= $#dst_formats; ++$j) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdcommon();
+foreach my $tier (reverse @simd_tiers) {
+    output_simdfunc_c($tier);
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -686,6 +686,31 @@ gnome_screensaver_enable()
 }
 #endif
 
+void
+X11_WaitEventTimeout(_THIS, int timeout)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+
+    /* Events may already have been read off the connection */
+    XFlush(data->display);
+    if (XEventsQueued(data->display, QueuedAlready)) {
+        return;
+    }
+
+    /* Keep the screensaver and polled touch devices serviced */
+    if (_this->suspend_screensaver && (timeout < 0 || timeout > 30000)) {
+        timeout = 30000;
+    }
+#ifdef SDL_INPUT_LINUXEV
+    if (!X11_Xinput2IsMutitouchSupported() && SDL_GetNumTouch() > 0 &&
+        (timeout < 0 || timeout > 10)) {
+        timeout = 10;
+    }
+#endif
+
+    SDL_WaitEventWakeup(ConnectionNumber(data->display), timeout);
+}
+
 void
 X11_SuspendScreenSaver(_THIS)
 {
@@ -24,6 +24,7 @@
 #define _SDL_x11events_h
 
 extern void X11_PumpEvents(_THIS);
+extern void X11_WaitEventTimeout(_THIS, int timeout);
 extern void X11_SuspendScreenSaver(_THIS);
 
 #endif /* _SDL_x11events_h */
@@ -0,0 +1,146 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Program to load a wave file and loop playing it using SDL_QueueAudio()
+   instead of an audio callback.  The queue is topped up in small pieces,
+   keeping about a quarter second of audio ahead of the device.
+
+   Run with SDL_AUDIODRIVER=dummy to test without audio hardware.
+*/
+#include "SDL_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#include "SDL.h"
+#include "SDL_audio.h"
+
+#define PIECE_SIZE  4096
+
+struct
+{
+    SDL_AudioSpec spec;
+    Uint8 *sound;               /* Pointer to wave data */
+    Uint32 soundlen;            /* Length of wave data */
+    Uint32 soundpos;            /* Current queue position */
+} wave;
+
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+/* Queue pieces of the wave until there's enough ahead of the device */
+static void
+queueup(Uint32 wanted)
+{
+    while (SDL_GetQueuedAudioSize(1) < wanted) {
+        Uint32 len = SDL_min(PIECE_SIZE, wave.soundlen - wave.soundpos);
+
+        if (SDL_QueueAudio(1, wave.sound + wave.soundpos, len) < 0) {
+            fprintf(stderr, "Couldn't queue audio: %s\n", SDL_GetError());
+            quit(2);
+        }
+        wave.soundpos += len;
+        if (wave.soundpos == wave.soundlen) {
+            wave.soundpos = 0;
+        }
+    }
+}
+
+static int done = 0;
+void
+poked(int sig)
+{
+    done = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint32 wanted, start, seconds = 0;
+
+    /* Load the SDL library */
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    if (argv[1] == NULL) {
+        argv[1] = "sample.wav";
+    }
+    /* Load the wave file into memory */
+    if (SDL_LoadWAV(argv[1], &wave.spec, &wave.sound, &wave.soundlen) == NULL) {
+        fprintf(stderr, "Couldn't load %s: %s\n", argv[1], SDL_GetError());
+        quit(1);
+    }
+    if (argv[2]) {
+        seconds = SDL_atoi(argv[2]);
+    }
+
+    /* No callback, we queue the audio ourselves */
+    wave.spec.callback = NULL;
+#if HAVE_SIGNAL_H
+    /* Set the signals */
+#ifdef SIGHUP
+    signal(SIGHUP, poked);
+#endif
+    signal(SIGINT, poked);
+#ifdef SIGQUIT
+    signal(SIGQUIT, poked);
+#endif
+    signal(SIGTERM, poked);
+#endif /* HAVE_SIGNAL_H */
+
+    if (SDL_OpenAudio(&wave.spec, NULL) < 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_FreeWAV(wave.sound);
+        quit(2);
+    }
+
+    printf("Using audio driver: %s\n", SDL_GetCurrentAudioDriver());
+
+    /* Keep a quarter second queued, in whole sample frames */
+    wanted = (wave.spec.freq / 4) * wave.spec.channels *
+        (SDL_AUDIO_BITSIZE(wave.spec.format) / 8);
+    queueup(wanted);
+
+    /* Let the audio run, optionally for a limited time */
+    SDL_PauseAudio(0);
+    start = SDL_GetTicks();
+    while (!done && (SDL_GetAudioStatus() == SDL_AUDIO_PLAYING)) {
+        if (seconds && (SDL_GetTicks() - start) >= seconds * 1000) {
+            break;
+        }
+        SDL_Delay(10);
+        queueup(wanted);
+    }
+
+    /* Stop playing and drop whatever is still queued */
+    SDL_PauseAudio(1);
+    SDL_ClearQueuedAudio(1);
+    printf("%u bytes left queued after clearing\n", SDL_GetQueuedAudioSize(1));
+
+    /* Clean up on signal */
+    SDL_CloseAudio();
+    SDL_FreeWAV(wave.sound);
+    SDL_Quit();
+    return (0);
+}
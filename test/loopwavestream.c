@@ -0,0 +1,132 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Program to loop playing a wave file, decoding it as it plays instead
+   of loading it into memory first.  The file is rewound with
+   SDL_SeekWAVStream() when it runs out.
+*/
+#include "SDL_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#include "SDL.h"
+#include "SDL_audio.h"
+
+struct
+{
+    SDL_AudioSpec spec;
+    SDL_WAVStream *stream;      /* The wave file being played */
+    Uint32 loops;               /* Times it has been played through */
+} wave;
+
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+
+void SDLCALL
+fillerup(void *unused, Uint8 * stream, int len)
+{
+    while (len > 0) {
+        int amount = SDL_ReadWAVStream(wave.stream, stream, len);
+        if (amount < 0) {
+            /* Corrupt data, play silence */
+            SDL_memset(stream, wave.spec.silence, len);
+            return;
+        }
+        if (amount == 0) {
+            /* Start over at the beginning */
+            if (SDL_SeekWAVStream(wave.stream, 0) < 0 ||
+                SDL_GetWAVStreamLength(wave.stream) == 0) {
+                SDL_memset(stream, wave.spec.silence, len);
+                return;
+            }
+            ++wave.loops;
+            continue;
+        }
+        stream += amount;
+        len -= amount;
+    }
+}
+
+static int done = 0;
+void
+poked(int sig)
+{
+    done = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    /* Load the SDL library */
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    if (argv[1] == NULL) {
+        argv[1] = "sample.wav";
+    }
+    /* Open the wave file, only its headers are read here */
+    wave.stream = SDL_OpenWAVStream(argv[1], &wave.spec);
+    if (wave.stream == NULL) {
+        fprintf(stderr, "Couldn't open %s: %s\n", argv[1], SDL_GetError());
+        quit(1);
+    }
+
+    wave.spec.callback = fillerup;
+#if HAVE_SIGNAL_H
+    /* Set the signals */
+#ifdef SIGHUP
+    signal(SIGHUP, poked);
+#endif
+    signal(SIGINT, poked);
+#ifdef SIGQUIT
+    signal(SIGQUIT, poked);
+#endif
+    signal(SIGTERM, poked);
+#endif /* HAVE_SIGNAL_H */
+
+    /* Initialize fillerup() variables */
+    if (SDL_OpenAudio(&wave.spec, NULL) < 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_CloseWAVStream(wave.stream);
+        quit(2);
+    }
+
+    printf("Using audio driver: %s\n", SDL_GetCurrentAudioDriver());
+    printf("Streaming %u sample frames at %d Hz\n",
+           SDL_GetWAVStreamLength(wave.stream), wave.spec.freq);
+
+    /* Let the audio run */
+    SDL_PauseAudio(0);
+    while (!done && (SDL_GetAudioStatus() == SDL_AUDIO_PLAYING))
+        SDL_Delay(1000);
+
+    /* Clean up on signal */
+    SDL_CloseAudio();
+    printf("Played the file through %u times\n", wave.loops);
+    SDL_CloseWAVStream(wave.stream);
+    SDL_Quit();
+    return (0);
+}
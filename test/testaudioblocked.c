@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for blocked audio conversion.
+
+   Runs conversions that need several steps over a buffer much larger
+   than the CPU cache, once with each step making its own pass over the
+   buffer and once a block at a time, and checks that both give the same
+   result.  The fastest pass is reported, so the first one touching a
+   freshly allocated buffer doesn't count.  The bandwidth is the source
+   and converted bytes moved per second.
+
+   Usage: testaudioblocked [frames] [iterations]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static const struct
+{
+    const char *name;
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+} conversions[] = {
+    { "S16 stereo -> F32 5.1", AUDIO_S16SYS, 2, AUDIO_F32SYS, 6 },
+    { "S16 5.1 -> F32 stereo", AUDIO_S16SYS, 6, AUDIO_F32SYS, 2 },
+    { "U8 mono -> F32 quad", AUDIO_U8, 1, AUDIO_F32SYS, 4 },
+    { "F32 stereo -> S16 mono", AUDIO_F32SYS, 2, AUDIO_S16SYS, 1 },
+    { "S16 (swapped) stereo -> S16 mono", AUDIO_S16SYS ^ 0x1000, 2,
+      AUDIO_S16SYS, 1 },
+    { "S16 5.1 -> S32 mono", AUDIO_S16SYS, 6, AUDIO_S32SYS, 1 },
+};
+
+/* Convert 'frames' frames 'iterations' times, returns seconds for the
+   fastest pass */
+static double
+Convert(int index, const Uint8 * source, int frames, int iterations,
+        Uint8 ** result, int *result_len)
+{
+    SDL_AudioCVT cvt;
+    Uint64 start, elapsed, best = 0;
+    int i;
+
+    if (SDL_BuildAudioCVT(&cvt, conversions[index].src_format,
+                          conversions[index].src_channels, 44100,
+                          conversions[index].dst_format,
+                          conversions[index].dst_channels, 44100) < 0) {
+        fprintf(stderr, "SDL_BuildAudioCVT() failed: %s\n", SDL_GetError());
+        return -1.0;
+    }
+    cvt.len = frames * conversions[index].src_channels *
+        (SDL_AUDIO_BITSIZE(conversions[index].src_format) / 8);
+    cvt.buf = (Uint8 *) SDL_malloc(cvt.len * cvt.len_mult);
+    if (cvt.buf == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return -1.0;
+    }
+
+    for (i = 0; i < iterations; ++i) {
+        SDL_memcpy(cvt.buf, source, cvt.len);
+        start = SDL_GetPerformanceCounter();
+        SDL_ConvertAudio(&cvt);
+        elapsed = SDL_GetPerformanceCounter() - start;
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    *result = cvt.buf;
+    *result_len = cvt.len_cvt;
+    return (double) best / SDL_GetPerformanceFrequency();
+}
+
+int
+main(int argc, char *argv[])
+{
+    int frames = (argc > 1) ? atoi(argv[1]) : 2 * 1024 * 1024;
+    int iterations = (argc > 2) ? atoi(argv[2]) : 5;
+    int failures = 0;
+    Uint8 *source;
+    int i;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    /* Enough random bytes for the largest source, floats in -1.0 to 1.0 */
+    source = (Uint8 *) SDL_malloc(frames * 6 * 4);
+    if (source == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        SDL_Quit();
+        return (1);
+    }
+    for (i = 0; i < frames * 6; ++i) {
+        ((float *) source)[i] = (float) ((rand() % 65536) - 32768) / 32768.0f;
+    }
+
+    printf("Converting %d frames, %d passes\n", frames, iterations);
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        Uint8 *whole = NULL, *blocked = NULL;
+        int whole_len = 0, blocked_len = 0;
+        double whole_sec, blocked_sec;
+        double bytes;
+
+        SDL_SetHint(SDL_HINT_AUDIO_CONVERT_BLOCKED, "0");
+        whole_sec = Convert(i, source, frames, iterations,
+                            &whole, &whole_len);
+        SDL_SetHint(SDL_HINT_AUDIO_CONVERT_BLOCKED, "1");
+        blocked_sec = Convert(i, source, frames, iterations,
+                              &blocked, &blocked_len);
+        if (whole_sec < 0.0 || blocked_sec < 0.0) {
+            SDL_Quit();
+            return (1);
+        }
+
+        bytes = (double) frames * conversions[i].src_channels *
+            (SDL_AUDIO_BITSIZE(conversions[i].src_format) / 8) + whole_len;
+        printf("%-34s  whole %7.2f ms %7.0f MB/s  blocked %7.2f ms %7.0f MB/s"
+               "  x%.2f\n", conversions[i].name,
+               whole_sec * 1000.0, bytes / whole_sec / 1e6,
+               blocked_sec * 1000.0, bytes / blocked_sec / 1e6,
+               whole_sec / blocked_sec);
+        if (whole_len != blocked_len ||
+            SDL_memcmp(whole, blocked, whole_len) != 0) {
+            printf("  blocked conversion doesn't match!\n");
+            ++failures;
+        }
+        SDL_free(whole);
+        SDL_free(blocked);
+    }
+
+    SDL_free(source);
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,101 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Program to record from the default capture device into a raw file.
+
+   Usage: testaudiocapture [seconds] [output file] [frequency]
+
+   The file gets signed 16-bit native endian samples at the given rate
+   (44100 by default), converted from whatever the device delivers.
+   Run with SDL_AUDIODRIVER=disk and SDL_DISKAUDIOFILEIN=<raw file> to
+   record from a file instead of hardware, it stops at the end of it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static SDL_RWops *output;
+static Uint32 bytes_captured;
+static Uint32 callbacks;
+
+static void SDLCALL
+captured(void *unused, Uint8 * stream, int len)
+{
+    SDL_RWwrite(output, stream, 1, len);
+    bytes_captured += len;
+    ++callbacks;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_AudioSpec wanted, obtained;
+    SDL_AudioDeviceID device;
+    const char *filename = "capture.raw";
+    int seconds = 5;
+    Uint32 start;
+
+    if (argv[1]) {
+        seconds = SDL_atoi(argv[1]);
+        if (argv[2]) {
+            filename = argv[2];
+        }
+    }
+
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    output = SDL_RWFromFile(filename, "wb");
+    if (output == NULL) {
+        fprintf(stderr, "Couldn't open %s: %s\n", filename, SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+
+    SDL_zero(wanted);
+    wanted.freq = (argv[1] && argv[2] && argv[3]) ? SDL_atoi(argv[3]) : 44100;
+    wanted.format = AUDIO_S16SYS;
+    wanted.channels = 1;
+    wanted.samples = 1024;
+    wanted.callback = captured;
+    device = SDL_OpenAudioDevice(NULL, 1, &wanted, &obtained, 0);
+    if (device == 0) {
+        fprintf(stderr, "Couldn't open capture device: %s\n", SDL_GetError());
+        SDL_RWclose(output);
+        SDL_Quit();
+        return (1);
+    }
+
+    printf("Using audio driver: %s\n", SDL_GetCurrentAudioDriver());
+    printf("Recording %d seconds of %d Hz audio to %s\n",
+           seconds, obtained.freq, filename);
+
+    SDL_PauseAudioDevice(device, 0);
+    start = SDL_GetTicks();
+    while ((SDL_GetTicks() - start) < (Uint32) (seconds * 1000) &&
+           SDL_GetAudioDeviceStatus(device) == SDL_AUDIO_PLAYING) {
+        SDL_Delay(100);
+    }
+    SDL_CloseAudioDevice(device);
+    SDL_RWclose(output);
+
+    printf("Captured %u bytes in %u callbacks\n", bytes_captured, callbacks);
+
+    SDL_Quit();
+    return (0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
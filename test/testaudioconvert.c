@@ -0,0 +1,294 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Micro-benchmark for the audio sample format converters.
+
+   Reports samples per second through SDL_ConvertAudio() for conversions
+   between the common formats, in mono and between mono and stereo.  The
+   16-bit, 32-bit and float conversions are also timed with a plain C
+   loop, like the generated converters use, and SDL's output is checked
+   against it.  Last, it times SDL_BuildAudioCVT() itself.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SAMPLES     (1024 * 1024)
+#define ITERATIONS  50
+#define BUILDS      100000
+
+static const struct
+{
+    SDL_AudioFormat format;
+    const char *name;
+} formats[] = {
+    { AUDIO_U8, "U8" },
+    { AUDIO_S16SYS, "S16" },
+    { AUDIO_S32SYS, "S32" },
+    { AUDIO_F32SYS, "F32" },
+};
+
+static double
+GetSample(const void *buf, SDL_AudioFormat format, int i)
+{
+    switch (format) {
+    case AUDIO_U8:
+        return (((const Uint8 *) buf)[i] - 128) / 128.0;
+    case AUDIO_S16SYS:
+        return ((const Sint16 *) buf)[i] / 32768.0;
+    case AUDIO_S32SYS:
+        return ((const Sint32 *) buf)[i] / 2147483648.0;
+    default:
+        return ((const float *) buf)[i];
+    }
+}
+
+/* The same math as the generated converters */
+static void
+ReferenceConvert(const void *src, SDL_AudioFormat src_format,
+                 void *dst, SDL_AudioFormat dst_format, int num)
+{
+    int i;
+
+    if (src_format == dst_format) {
+        SDL_memcpy(dst, src, num * (SDL_AUDIO_BITSIZE(src_format) / 8));
+        return;
+    }
+    for (i = 0; i < num; ++i) {
+        if (src_format == AUDIO_S16SYS && dst_format == AUDIO_F32SYS) {
+            ((float *) dst)[i] = ((float) ((const Sint16 *) src)[i]) * 3.05185094759972e-05f;
+        } else if (src_format == AUDIO_F32SYS && dst_format == AUDIO_S16SYS) {
+            ((Sint16 *) dst)[i] = (Sint16) (((const float *) src)[i] * 32767.0f);
+        } else if (src_format == AUDIO_S32SYS && dst_format == AUDIO_F32SYS) {
+            ((float *) dst)[i] = ((float) ((const Sint32 *) src)[i]) * 4.6566128752458e-10f;
+        } else if (src_format == AUDIO_F32SYS && dst_format == AUDIO_S32SYS) {
+            ((Sint32 *) dst)[i] = (Sint32) (((const float *) src)[i] * 2147483647.0);
+        } else if (src_format == AUDIO_S16SYS && dst_format == AUDIO_S32SYS) {
+            ((Sint32 *) dst)[i] = ((Sint32) ((const Sint16 *) src)[i]) << 16;
+        } else if (src_format == AUDIO_S32SYS && dst_format == AUDIO_S16SYS) {
+            ((Sint16 *) dst)[i] = (Sint16) (((const Sint32 *) src)[i] >> 16);
+        }
+    }
+}
+
+/* The same math as SDL_ConvertStereo() and SDL_ConvertMono() */
+static void
+ReferenceChannels(void *buf, SDL_AudioFormat format, int num,
+                  int src_channels, int dst_channels)
+{
+    int i;
+
+    if (src_channels == 1 && dst_channels == 2) {
+        for (i = num - 1; i >= 0; --i) {
+            switch (format) {
+            case AUDIO_S16SYS:
+                ((Sint16 *) buf)[i * 2] = ((Sint16 *) buf)[i * 2 + 1] =
+                    ((Sint16 *) buf)[i];
+                break;
+            case AUDIO_S32SYS:
+                ((Sint32 *) buf)[i * 2] = ((Sint32 *) buf)[i * 2 + 1] =
+                    ((Sint32 *) buf)[i];
+                break;
+            default:
+                ((float *) buf)[i * 2] = ((float *) buf)[i * 2 + 1] =
+                    ((float *) buf)[i];
+                break;
+            }
+        }
+    } else if (src_channels == 2 && dst_channels == 1) {
+        for (i = 0; i < num / 2; ++i) {
+            switch (format) {
+            case AUDIO_S16SYS:
+                ((Sint16 *) buf)[i] = (Sint16) ((((Sint32) ((Sint16 *) buf)[i * 2]) +
+                                                 ((Sint16 *) buf)[i * 2 + 1]) / 2);
+                break;
+            case AUDIO_S32SYS:
+                ((Sint32 *) buf)[i] = (Sint32) ((((Sint64) ((Sint32 *) buf)[i * 2]) +
+                                                 ((Sint32 *) buf)[i * 2 + 1]) / 2);
+                break;
+            default:
+                ((float *) buf)[i] = (float) ((((double) ((float *) buf)[i * 2]) +
+                                               ((float *) buf)[i * 2 + 1]) * 0.5);
+                break;
+            }
+        }
+    }
+}
+
+static SDL_bool
+HasReference(SDL_AudioFormat src_format, SDL_AudioFormat dst_format)
+{
+    return (src_format != AUDIO_U8 && dst_format != AUDIO_U8);
+}
+
+static double
+SamplesPerSecond(Uint64 elapsed)
+{
+    if (elapsed == 0) {
+        return 0.0;
+    }
+    return ((double) SAMPLES * ITERATIONS * SDL_GetPerformanceFrequency()) /
+        elapsed;
+}
+
+static int
+RunConversion(int from, int to, int src_channels, int dst_channels,
+              const Uint8 * source, int *failures)
+{
+    const SDL_AudioFormat src_format = formats[from].format;
+    const SDL_AudioFormat dst_format = formats[to].format;
+    const int src_len = SAMPLES * (SDL_AUDIO_BITSIZE(src_format) / 8);
+    const int dst_samples = SAMPLES / src_channels * dst_channels;
+    const int dst_len = dst_samples * (SDL_AUDIO_BITSIZE(dst_format) / 8);
+    SDL_AudioCVT cvt;
+    Uint8 *buf, *reference;
+    Uint64 start, elapsed;
+    int i, mismatches = 0;
+
+    if (SDL_BuildAudioCVT(&cvt, src_format, src_channels, 44100,
+                          dst_format, dst_channels, 44100) < 0) {
+        fprintf(stderr, "SDL_BuildAudioCVT() failed: %s\n", SDL_GetError());
+        return -1;
+    }
+    buf = (Uint8 *) SDL_malloc(src_len * cvt.len_mult);
+    reference = (Uint8 *) SDL_malloc(SAMPLES * 2 * 4);
+    if (!buf || !reference) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+
+    /* Make the source samples from the same values in every format */
+    cvt.buf = buf;
+    cvt.len = src_len;
+    elapsed = 0;
+    for (i = 0; i < ITERATIONS; ++i) {
+        SDL_memcpy(buf, source + from * SAMPLES * 4, src_len);
+        start = SDL_GetPerformanceCounter();
+        SDL_ConvertAudio(&cvt);
+        elapsed += SDL_GetPerformanceCounter() - start;
+    }
+    printf("%-4s %d -> %-4s %d  %8.1f Msamples/sec", formats[from].name,
+           src_channels, formats[to].name, dst_channels,
+           SamplesPerSecond(elapsed) / 1000000.0);
+
+    if (HasReference(src_format, dst_format)) {
+        elapsed = 0;
+        for (i = 0; i < ITERATIONS; ++i) {
+            start = SDL_GetPerformanceCounter();
+            ReferenceConvert(source + from * SAMPLES * 4, src_format,
+                             reference, dst_format, SAMPLES);
+            ReferenceChannels(reference, dst_format, SAMPLES,
+                              src_channels, dst_channels);
+            elapsed += SDL_GetPerformanceCounter() - start;
+        }
+        if (cvt.len_cvt != dst_len) {
+            ++mismatches;
+        }
+        for (i = 0; i < dst_samples; ++i) {
+            if (GetSample(buf, dst_format, i) !=
+                GetSample(reference, dst_format, i)) {
+                ++mismatches;
+            }
+        }
+        printf("   C loop %8.1f Msamples/sec   %d mismatches",
+               SamplesPerSecond(elapsed) / 1000000.0, mismatches);
+        if (mismatches) {
+            ++*failures;
+        }
+    }
+    printf("\n");
+
+    SDL_free(buf);
+    SDL_free(reference);
+    return 0;
+}
+
+/* Time building the converters for a typical sound effect, over and over */
+static void
+RunBuilds(void)
+{
+    SDL_AudioCVT cvt;
+    Uint64 start, elapsed;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < BUILDS; ++i) {
+        SDL_BuildAudioCVT(&cvt, AUDIO_U8, 1, 22050, AUDIO_S16SYS, 2, 44100);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    printf("SDL_BuildAudioCVT() U8 mono 22050 -> S16 stereo 44100: "
+           "%.2f usec per call\n",
+           (double) elapsed * 1000000.0 / SDL_GetPerformanceFrequency() /
+           BUILDS);
+}
+
+int
+main(int argc, char *argv[])
+{
+    Uint8 *source;
+    int failures = 0;
+    int i, j;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    printf("CPU: SSE2 %s, AVX2 %s\n", SDL_HasSSE2() ? "yes" : "no",
+           SDL_HasAVX2() ? "yes" : "no");
+    printf("Converting %d samples, %d passes\n", SAMPLES, ITERATIONS);
+
+    /* One run of source samples per format, 4 bytes per sample is enough */
+    source = (Uint8 *) SDL_malloc(SDL_arraysize(formats) * SAMPLES * 4);
+    if (source == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return (1);
+    }
+    for (i = 0; i < SAMPLES; ++i) {
+        const Sint16 value = (Sint16) ((rand() & 0xFFFF) - 32768);
+        Uint8 *u8 = source;
+        Sint16 *s16 = (Sint16 *) (source + SAMPLES * 4);
+        Sint32 *s32 = (Sint32 *) (source + SAMPLES * 8);
+        float *f32 = (float *) (source + SAMPLES * 12);
+        u8[i] = (Uint8) ((value >> 8) + 128);
+        s16[i] = value;
+        s32[i] = ((Sint32) value << 16) | (rand() & 0xFFFF);
+        f32[i] = value / 32768.0f;
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            if (i != j && RunConversion(i, j, 1, 1, source, &failures) < 0) {
+                SDL_Quit();
+                return (1);
+            }
+        }
+    }
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            if (RunConversion(i, j, 1, 2, source, &failures) < 0 ||
+                RunConversion(i, j, 2, 1, source, &failures) < 0) {
+                SDL_Quit();
+                return (1);
+            }
+        }
+    }
+    RunBuilds();
+
+    SDL_free(source);
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,87 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program for SDL_QueueAudio() on a device that converts.
+
+   The disk audio driver is told to write 5.1 audio while we queue 16-bit
+   stereo, so whole frames are checked against the format the application
+   asked for rather than the one the device uses.  The device is never
+   unpaused, so nothing is written to the output file.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define OUTPUT_FILE     "testaudioqueue.raw"
+
+static int failures = 0;
+
+static void
+Check(const char *what, int ok)
+{
+    printf("%-40s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) {
+        ++failures;
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_AudioDeviceID device;
+    SDL_AudioSpec wanted, spec;
+    Sint16 frames[5 * 2];
+
+    SDL_setenv("SDL_AUDIODRIVER", "disk", 1);
+    SDL_setenv("SDL_DISKAUDIOFILE", OUTPUT_FILE, 1);
+    SDL_setenv("SDL_DISKAUDIOCHANNELS", "6", 1);
+
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    SDL_zero(wanted);
+    wanted.freq = 44100;
+    wanted.format = AUDIO_S16SYS;
+    wanted.channels = 2;
+    wanted.samples = 512;
+    wanted.callback = NULL;
+    device = SDL_OpenAudioDevice(NULL, 0, &wanted, &spec, 0);
+    if (device == 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+    printf("Queueing %d channel audio to a 6 channel device\n",
+           spec.channels);
+
+    SDL_zero(frames);
+    Check("Queue an odd number of whole frames",
+          SDL_QueueAudio(device, frames, sizeof (frames)) == 0);
+    Check("Queued size matches",
+          SDL_GetQueuedAudioSize(device) == sizeof (frames));
+    Check("Refuse part of a frame",
+          SDL_QueueAudio(device, frames, sizeof (Sint16)) < 0);
+    Check("Queued size unchanged",
+          SDL_GetQueuedAudioSize(device) == sizeof (frames));
+
+    SDL_CloseAudioDevice(device);
+    SDL_Quit();
+    remove(OUTPUT_FILE);
+
+    return (failures == 0) ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,147 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program for feeding an audio device through its ring buffer.
+
+   A writer thread keeps the ring topped up with a sine tone while the
+   main thread holds the audio device lock for long stretches, which
+   would starve a callback.  The fill level and underrun count are
+   reported as it plays.
+
+   Run with SDL_AUDIODRIVER=dummy to test without audio hardware.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define RUN_SECONDS     5
+#define RING_SIZE       (16 * 1024)
+#define LOCK_MS         50
+
+static SDL_AudioDeviceID device;
+static SDL_AudioSpec spec;
+static SDL_atomic_t done;
+static SDL_atomic_t callbacks;
+static Uint64 bytes_written;
+
+static void SDLCALL
+Callback(void *userdata, Uint8 * stream, int len)
+{
+    /* This should never be called once the ring is set up */
+    SDL_AtomicAdd(&callbacks, 1);
+    SDL_memset(stream, spec.silence, len);
+}
+
+static int
+Writer(void *unused)
+{
+    Sint16 buffer[1024 * 2];
+    double phase = 0.0;
+    Uint32 pos = 0, avail = 0;
+    int i;
+
+    while (!SDL_AtomicGet(&done)) {
+        Uint32 written;
+
+        if (pos == avail) {
+            for (i = 0; i < SDL_arraysize(buffer); i += 2) {
+                buffer[i] = buffer[i + 1] = (Sint16) (SDL_sin(phase) * 8000);
+                phase += 2.0 * M_PI * 440.0 / spec.freq;
+            }
+            pos = 0;
+            avail = sizeof (buffer);
+        }
+        written = SDL_WriteAudioDeviceRing(device, (Uint8 *) buffer + pos,
+                                           avail - pos);
+        if (written == 0) {
+            SDL_Delay(1);
+        }
+        pos += written;
+        bytes_written += written;
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_AudioSpec wanted;
+    SDL_Thread *thread;
+    Uint32 start, now, last_report = 0;
+
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    SDL_zero(wanted);
+    wanted.freq = 44100;
+    wanted.format = AUDIO_S16SYS;
+    wanted.channels = 2;
+    wanted.samples = 512;
+    wanted.callback = Callback;
+    device = SDL_OpenAudioDevice(NULL, 0, &wanted, &spec, 0);
+    if (device == 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+    if (SDL_SetAudioDeviceRing(device, RING_SIZE) < 0) {
+        fprintf(stderr, "Couldn't set up the ring buffer: %s\n",
+                SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+    printf("Using audio driver: %s, %d Hz, %d sample buffers\n",
+           SDL_GetCurrentAudioDriver(), spec.freq, spec.samples);
+
+    /* Fill the ring before we start playing */
+    thread = SDL_CreateThread(Writer, "RingWriter", NULL);
+    while (SDL_GetAudioDeviceRingFill(device) < RING_SIZE / 2) {
+        SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(device, 0);
+
+    start = SDL_GetTicks();
+    do {
+        /* Hold the lock like a busy game thread would */
+        SDL_LockAudioDevice(device);
+        SDL_Delay(LOCK_MS);
+        SDL_UnlockAudioDevice(device);
+        SDL_Delay(10);
+
+        now = SDL_GetTicks();
+        if (now - last_report >= 500) {
+            printf("%5.1f sec: %5u bytes queued, %u underruns\n",
+                   (now - start) / 1000.0f,
+                   SDL_GetAudioDeviceRingFill(device),
+                   SDL_GetAudioDeviceUnderruns(device));
+            last_report = now;
+        }
+    } while (now - start < RUN_SECONDS * 1000);
+
+    SDL_AtomicSet(&done, 1);
+    SDL_WaitThread(thread, NULL);
+    SDL_PauseAudioDevice(device, 1);
+
+    printf("Wrote %.0f bytes, %u underruns, callback called %d times\n",
+           (double) bytes_written, SDL_GetAudioDeviceUnderruns(device),
+           SDL_AtomicGet(&callbacks));
+
+    SDL_CloseAudioDevice(device);
+    SDL_Quit();
+    return (SDL_AtomicGet(&callbacks) == 0) ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
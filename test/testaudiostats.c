@@ -0,0 +1,117 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program for the audio thread statistics.
+
+   The callback keeps the CPU busy for a random time up to the given
+   number of microseconds, so the percentiles have something to show.
+   Every second the statistics collected so far are printed.
+
+   Usage: testaudiostats [seconds] [max callback usec]
+
+   Run with SDL_AUDIODRIVER=disk to test without audio hardware.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static Uint32 max_busy_usec = 2000;
+static Uint32 seed = 1;
+
+static void SDLCALL
+Callback(void *userdata, Uint8 * stream, int len)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const Uint64 start = SDL_GetPerformanceCounter();
+    Uint64 busy;
+
+    /* A cheap random number generator is plenty here */
+    seed = seed * 1103515245 + 12345;
+    busy = ((seed >> 16) % (max_busy_usec + 1)) * freq / 1000000;
+
+    SDL_memset(stream, 0, len);
+    while (SDL_GetPerformanceCounter() - start < busy) {
+        /* Keep the CPU busy */
+    }
+}
+
+static void
+PrintStats(SDL_AudioDeviceID device)
+{
+    SDL_AudioDeviceStats stats;
+
+    if (SDL_GetAudioDeviceStats(device, &stats) < 0) {
+        fprintf(stderr, "Couldn't get statistics: %s\n", SDL_GetError());
+        return;
+    }
+    printf("%u callbacks, usec p50 %u p90 %u p99 %u max %u\n",
+           stats.callbacks, stats.callback_usec_p50, stats.callback_usec_p90,
+           stats.callback_usec_p99, stats.callback_usec_max);
+    printf("  %u missed deadlines, %u late wakeups, %u underruns,"
+           " convert avg %u max %u usec, latency %u frames\n",
+           stats.missed_deadlines, stats.late_wakeups, stats.underruns,
+           stats.convert_usec_avg, stats.convert_usec_max, stats.latency);
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_AudioSpec wanted, spec;
+    SDL_AudioDeviceStats stats;
+    SDL_AudioDeviceID device;
+    int seconds = 5;
+    int i;
+
+    if (argc > 1) {
+        seconds = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        max_busy_usec = (Uint32) atoi(argv[2]);
+    }
+
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    SDL_zero(wanted);
+    wanted.freq = 44100;
+    wanted.format = AUDIO_S16SYS;
+    wanted.channels = 2;
+    wanted.samples = 1024;
+    wanted.callback = Callback;
+    device = SDL_OpenAudioDevice(NULL, 0, &wanted, &spec, 0);
+    if (device == 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+    printf("Using audio driver: %s, %d Hz, %d sample buffers\n",
+           SDL_GetCurrentAudioDriver(), spec.freq, spec.samples);
+
+    SDL_EnableAudioDeviceStats(device, 1);
+    SDL_PauseAudioDevice(device, 0);
+    for (i = 0; i < seconds; ++i) {
+        SDL_Delay(1000);
+        PrintStats(device);
+    }
+    SDL_PauseAudioDevice(device, 1);
+
+    SDL_GetAudioDeviceStats(device, &stats);
+    SDL_CloseAudioDevice(device);
+    SDL_Quit();
+    return (stats.callbacks > 0) ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
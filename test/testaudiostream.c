@@ -0,0 +1,260 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program for SDL_AudioStream.
+
+   With no arguments, a tone is pushed through streams between several
+   formats and rates in randomly sized pieces, and the output is checked
+   for its length and against the ideal tone.  With a wave file, an output
+   file and a rate, the file is converted offline and the speed reported.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "SDL.h"
+
+#define TONE        440.0
+#define SECONDS     2
+#define CHANNELS    2
+#define EDGE        512         /* frames skipped at each end when checking */
+
+static const struct
+{
+    SDL_AudioFormat src_format;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    int dst_rate;
+} cases[] = {
+    { AUDIO_F32SYS, 44100, AUDIO_F32SYS, 48000 },
+    { AUDIO_S16SYS, 48000, AUDIO_S16SYS, 44100 },
+    { AUDIO_S16SYS, 22050, AUDIO_F32SYS, 48000 },
+    { AUDIO_F32SYS, 48000, AUDIO_S16SYS, 8000 },
+    { AUDIO_U8, 11025, AUDIO_S16SYS, 44100 },
+    { AUDIO_S16SYS, 44100, AUDIO_S32SYS, 44100 },
+};
+
+static double
+GetSample(const Uint8 * buf, SDL_AudioFormat format, int i)
+{
+    switch (format) {
+    case AUDIO_U8:
+        return (((const Uint8 *) buf)[i] - 128) / 128.0;
+    case AUDIO_S16SYS:
+        return ((const Sint16 *) buf)[i] / 32768.0;
+    case AUDIO_S32SYS:
+        return ((const Sint32 *) buf)[i] / 2147483648.0;
+    default:
+        return ((const float *) buf)[i];
+    }
+}
+
+static void
+PutSample(Uint8 * buf, SDL_AudioFormat format, int i, double sample)
+{
+    switch (format) {
+    case AUDIO_U8:
+        ((Uint8 *) buf)[i] = (Uint8) (128 + (int) (sample * 127.0));
+        break;
+    case AUDIO_S16SYS:
+        ((Sint16 *) buf)[i] = (Sint16) (sample * 32767.0);
+        break;
+    case AUDIO_S32SYS:
+        ((Sint32 *) buf)[i] = (Sint32) (sample * 2147483647.0);
+        break;
+    default:
+        ((float *) buf)[i] = (float) sample;
+        break;
+    }
+}
+
+static int
+RunCase(SDL_AudioFormat src_format, int src_rate,
+        SDL_AudioFormat dst_format, int dst_rate)
+{
+    const int src_framesize = (SDL_AUDIO_BITSIZE(src_format) / 8) * CHANNELS;
+    const int dst_framesize = (SDL_AUDIO_BITSIZE(dst_format) / 8) * CHANNELS;
+    const int src_frames = src_rate * SECONDS;
+    const int dst_frames = dst_rate * SECONDS;
+    SDL_AudioStream *stream;
+    Uint8 *src, *dst;
+    int i, len, want, got, total;
+    double error, worst;
+
+    stream = SDL_NewAudioStream(src_format, CHANNELS, src_rate,
+                                dst_format, CHANNELS, dst_rate);
+    if (stream == NULL) {
+        fprintf(stderr, "SDL_NewAudioStream() failed: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    src = (Uint8 *) SDL_malloc(src_frames * src_framesize);
+    dst = (Uint8 *) SDL_malloc((dst_frames + 1) * dst_framesize);
+    for (i = 0; i < src_frames; ++i) {
+        const double sample = 0.5 * sin(2.0 * M_PI * TONE * i / src_rate);
+        PutSample(src, src_format, i * CHANNELS + 0, sample);
+        PutSample(src, src_format, i * CHANNELS + 1, -sample);
+    }
+
+    /* Put and get in random sizes, including partial frames */
+    total = 0;
+    for (i = 0; i < src_frames * src_framesize; i += len) {
+        len = 1 + (rand() % 3000);
+        if (len > src_frames * src_framesize - i) {
+            len = src_frames * src_framesize - i;
+        }
+        if (SDL_AudioStreamPut(stream, src + i, len) < 0) {
+            fprintf(stderr, "SDL_AudioStreamPut() failed: %s\n", SDL_GetError());
+            return -1;
+        }
+        want = (rand() % 500) * dst_framesize;
+        if (total + want > dst_frames * dst_framesize) {
+            want = 0;
+        }
+        got = SDL_AudioStreamGet(stream, dst + total, want);
+        if (got < 0) {
+            fprintf(stderr, "SDL_AudioStreamGet() failed: %s\n", SDL_GetError());
+            return -1;
+        }
+        total += got;
+    }
+    SDL_AudioStreamFlush(stream);
+    total += SDL_AudioStreamGet(stream, dst + total,
+                                (dst_frames + 1) * dst_framesize - total);
+
+    /* Compare with the ideal tone, ignoring the edges */
+    worst = 0.0;
+    for (i = EDGE; i < dst_frames - EDGE; ++i) {
+        const double ideal = 0.5 * sin(2.0 * M_PI * TONE * i / dst_rate);
+        error = SDL_fabs(GetSample(dst, dst_format, i * CHANNELS) - ideal);
+        worst = SDL_max(worst, error);
+        error = SDL_fabs(GetSample(dst, dst_format, i * CHANNELS + 1) + ideal);
+        worst = SDL_max(worst, error);
+    }
+
+    printf("%04x %6d -> %04x %6d: %d of %d frames, worst error %f\n",
+           src_format, src_rate, dst_format, dst_rate,
+           total / dst_framesize, dst_frames, worst);
+
+    SDL_FreeAudioStream(stream);
+    SDL_free(src);
+    SDL_free(dst);
+
+    /* 8-bit samples are only good to 1/128 */
+    if (total != dst_frames * dst_framesize || worst > 0.02) {
+        fprintf(stderr, "FAILED\n");
+        return -1;
+    }
+    return 0;
+}
+
+static int
+ConvertFile(const char *in, const char *out, int rate)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream;
+    Uint8 *data, *converted;
+    Uint32 len;
+    int total, got;
+    Uint64 start, end;
+    FILE *io;
+    SDL_RWops *rw;
+    Uint32 bitsize;
+    int blockalign, avgbytes;
+
+    if (SDL_LoadWAV(in, &spec, &data, &len) == NULL) {
+        fprintf(stderr, "failed to load %s: %s\n", in, SDL_GetError());
+        return -1;
+    }
+    stream = SDL_NewAudioStream(spec.format, spec.channels, spec.freq,
+                                spec.format, spec.channels, rate);
+    if (stream == NULL) {
+        fprintf(stderr, "SDL_NewAudioStream() failed: %s\n", SDL_GetError());
+        SDL_FreeWAV(data);
+        return -1;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    if (SDL_AudioStreamPut(stream, data, len) < 0 ||
+        SDL_AudioStreamFlush(stream) < 0) {
+        fprintf(stderr, "conversion failed: %s\n", SDL_GetError());
+        return -1;
+    }
+    total = SDL_AudioStreamAvailable(stream);
+    converted = (Uint8 *) SDL_malloc(total);
+    got = SDL_AudioStreamGet(stream, converted, total);
+    end = SDL_GetPerformanceCounter();
+    printf("Converted %u bytes to %d bytes in %f ms\n", (unsigned) len, got,
+           (double) (end - start) * 1000.0 / SDL_GetPerformanceFrequency());
+
+    /* write out a WAV header... */
+    io = fopen(out, "wb");
+    if (io == NULL) {
+        fprintf(stderr, "fopen('%s') failed\n", out);
+        return -1;
+    }
+    rw = SDL_RWFromFP(io, SDL_TRUE);
+    bitsize = SDL_AUDIO_BITSIZE(spec.format);
+    blockalign = (bitsize / 8) * spec.channels;
+    avgbytes = rate * blockalign;
+    SDL_WriteLE32(rw, 0x46464952);      /* RIFF */
+    SDL_WriteLE32(rw, got + 36);
+    SDL_WriteLE32(rw, 0x45564157);      /* WAVE */
+    SDL_WriteLE32(rw, 0x20746D66);      /* fmt */
+    SDL_WriteLE32(rw, 16);      /* chunk size */
+    SDL_WriteLE16(rw, 1);       /* uncompressed */
+    SDL_WriteLE16(rw, spec.channels);
+    SDL_WriteLE32(rw, rate);
+    SDL_WriteLE32(rw, avgbytes);
+    SDL_WriteLE16(rw, blockalign);
+    SDL_WriteLE16(rw, bitsize);
+    SDL_WriteLE32(rw, 0x61746164);      /* data */
+    SDL_WriteLE32(rw, got);
+    SDL_RWwrite(rw, converted, got, 1);
+    SDL_RWclose(rw);
+
+    SDL_free(converted);
+    SDL_FreeAudioStream(stream);
+    SDL_FreeWAV(data);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int i, failed = 0;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    if (argc == 4) {
+        failed = (ConvertFile(argv[1], argv[2], atoi(argv[3])) < 0);
+    } else if (argc == 1) {
+        for (i = 0; i < SDL_arraysize(cases); ++i) {
+            if (RunCase(cases[i].src_format, cases[i].src_rate,
+                        cases[i].dst_format, cases[i].dst_rate) < 0) {
+                failed = 1;
+            }
+        }
+    } else {
+        fprintf(stderr, "USAGE: %s [in.wav out.wav newfreq]\n", argv[0]);
+        failed = 1;
+    }
+
+    SDL_Quit();
+    return (failed ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
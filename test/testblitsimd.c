@@ -0,0 +1,331 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program for the SSE2 and AVX2 blitters.
+
+   Blits between the 32-bit RGB formats with every combination of blend
+   mode, color modulation, alpha modulation and colorkey, both unscaled
+   and scaled, once for each CPU feature tier SDL_HINT_BLIT_CPU_FEATURES
+   allows, and checks that every tier gives the same pixels as plain C.
+   Then a few common blits are timed at each tier.
+
+   Usage: testblitsimd [width height iterations]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "testsurface.h"
+
+static const struct
+{
+    const char *name;
+    const char *features;
+} tiers[] = {
+    { "C", "0" },
+    { "SSE2", "8" },
+    { "AVX2", "72" },
+};
+
+static const Uint32 src_formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGR888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_BGRA8888,
+};
+
+static const Uint32 dst_formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGR888,
+};
+
+static const SDL_BlendMode blendmodes[] = {
+    SDL_BLENDMODE_NONE,
+    SDL_BLENDMODE_BLEND,
+    SDL_BLENDMODE_ADD,
+    SDL_BLENDMODE_MOD,
+};
+
+/* Blits timed at each tier */
+static const struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_BlendMode blendmode;
+    SDL_bool modulate;
+    SDL_bool colorkey;
+    SDL_bool scaled;
+} benchmarks[] = {
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_NONE, SDL_FALSE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_BLENDMODE_NONE, SDL_FALSE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, SDL_FALSE, SDL_TRUE, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_TRUE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_TRUE, SDL_FALSE },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_ADD, SDL_TRUE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_MOD, SDL_TRUE, SDL_FALSE, SDL_FALSE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_NONE, SDL_FALSE, SDL_FALSE, SDL_TRUE },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_BLENDMODE_NONE, SDL_FALSE, SDL_FALSE, SDL_TRUE },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_FALSE, SDL_TRUE },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, SDL_TRUE, SDL_FALSE, SDL_TRUE },
+};
+
+static SDL_bool
+HaveTier(int tier)
+{
+    switch (tier) {
+    case 1:
+        return SDL_HasSSE2();
+    case 2:
+        return SDL_HasAVX2();
+    }
+    return SDL_TRUE;
+}
+
+static void
+SetTier(int tier)
+{
+    SDL_SetHintWithPriority(SDL_HINT_BLIT_CPU_FEATURES,
+                            tiers[tier].features, SDL_HINT_OVERRIDE);
+}
+
+/* A surface full of random pixels, with plenty of fully transparent and
+   fully opaque ones, and some matching the colorkey */
+static SDL_Surface *
+CreateSurface(Uint32 format, int w, int h, Uint32 key)
+{
+    SDL_Surface *surface = CreateRandomSurface(format, w, h);
+    int x, y;
+
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) surface->pixels + y * surface->pitch);
+        for (x = 0; x < w; ++x) {
+            switch (Random() % 8) {
+            case 0:
+                row[x] &= 0x00FFFFFF;
+                break;
+            case 1:
+                row[x] |= 0xFF000000;
+                break;
+            case 2:
+                row[x] = key;
+                break;
+            case 3:
+                /* Only the unused or alpha bits differ from the key */
+                row[x] = key ^ 0x01000000;
+                break;
+            }
+        }
+    }
+    return surface;
+}
+
+static SDL_Surface *
+CopySurface(SDL_Surface * surface)
+{
+    SDL_Surface *copy = SDL_ConvertSurface(surface, surface->format, 0);
+    if (copy == NULL) {
+        fprintf(stderr, "Couldn't copy surface: %s\n", SDL_GetError());
+        exit(1);
+    }
+    return copy;
+}
+
+static void
+SetupBlit(SDL_Surface * src, SDL_BlendMode blendmode, SDL_bool colormod,
+          SDL_bool alphamod, SDL_bool colorkey, Uint32 key)
+{
+    SDL_SetSurfaceBlendMode(src, blendmode);
+    if (colormod) {
+        SDL_SetSurfaceColorMod(src, 200, 100, 37);
+    }
+    if (alphamod) {
+        SDL_SetSurfaceAlphaMod(src, 150);
+    }
+    if (colorkey) {
+        SDL_SetColorKey(src, 1, key);
+    }
+}
+
+static void
+Blit(SDL_Surface * src, SDL_Surface * dst, SDL_Rect * dstrect,
+     SDL_bool scaled)
+{
+    if (scaled) {
+        SDL_BlitScaled(src, NULL, dst, dstrect);
+    } else {
+        SDL_BlitSurface(src, NULL, dst, dstrect);
+    }
+}
+
+static int
+CheckTiers(void)
+{
+    const int w = 37, h = 9;
+    int failures = 0, tests = 0;
+    int s, d, b, i, tier;
+
+    for (s = 0; s < SDL_arraysize(src_formats); ++s)
+    for (d = 0; d < SDL_arraysize(dst_formats); ++d)
+    for (b = 0; b < SDL_arraysize(blendmodes); ++b)
+    for (i = 0; i < 16; ++i) {
+        const SDL_bool colormod = (i & 1) ? SDL_TRUE : SDL_FALSE;
+        const SDL_bool alphamod = (i & 2) ? SDL_TRUE : SDL_FALSE;
+        const SDL_bool colorkey = (i & 4) ? SDL_TRUE : SDL_FALSE;
+        const SDL_bool scaled = (i & 8) ? SDL_TRUE : SDL_FALSE;
+        const Uint32 key = Random();
+        SDL_Surface *src = CreateSurface(src_formats[s], w, h, key);
+        SDL_Surface *dst = CreateSurface(dst_formats[d], w + 8, h + 2, key);
+        SDL_Rect dstrect;
+        SDL_Surface *reference = NULL;
+
+        /* Scaled up across and down the other way */
+        dstrect.x = 3;
+        dstrect.y = 1;
+        dstrect.w = scaled ? w + 4 : w;
+        dstrect.h = scaled ? h - 2 : h;
+
+        for (tier = 0; tier < SDL_arraysize(tiers); ++tier) {
+            SDL_Surface *tsrc, *tdst;
+
+            if (!HaveTier(tier)) {
+                continue;
+            }
+            SetTier(tier);
+
+            /* New surfaces, so the blitter is chosen again */
+            tsrc = CopySurface(src);
+            tdst = CopySurface(dst);
+            SetupBlit(tsrc, blendmodes[b], colormod, alphamod, colorkey, key);
+            Blit(tsrc, tdst, &dstrect, scaled);
+            SDL_FreeSurface(tsrc);
+
+            if (reference == NULL) {
+                reference = tdst;
+                continue;
+            }
+            ++tests;
+            if (SDL_memcmp(reference->pixels, tdst->pixels,
+                           tdst->h * tdst->pitch) != 0) {
+                printf("%s -> %s, blend mode %d%s%s%s%s: %s differs from C\n",
+                       SDL_GetPixelFormatName(src_formats[s]),
+                       SDL_GetPixelFormatName(dst_formats[d]), blendmodes[b],
+                       colormod ? ", color mod" : "",
+                       alphamod ? ", alpha mod" : "",
+                       colorkey ? ", colorkey" : "",
+                       scaled ? ", scaled" : "", tiers[tier].name);
+                ++failures;
+            }
+            SDL_FreeSurface(tdst);
+        }
+        SDL_FreeSurface(reference);
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+    }
+    printf("%d blits compared, %d differ\n", tests, failures);
+    return failures;
+}
+
+static void
+Benchmark(int w, int h, int iterations)
+{
+    int i, n, tier;
+
+    printf("Blitting %dx%d, %d times\n", w, h, iterations);
+    for (i = 0; i < SDL_arraysize(benchmarks); ++i) {
+        const Uint32 key = Random();
+        /* Scaled blits read a source a bit smaller than the destination */
+        const int sw = benchmarks[i].scaled ? w * 3 / 4 : w;
+        const int sh = benchmarks[i].scaled ? h * 3 / 4 : h;
+        SDL_Surface *src = CreateSurface(benchmarks[i].src_format, sw, sh, key);
+        SDL_Surface *dst = CreateSurface(benchmarks[i].dst_format, w, h, key);
+        SDL_Rect dstrect;
+        char name[128];
+
+        SDL_snprintf(name, sizeof (name), "%s -> %s%s%s%s%s",
+                     SDL_GetPixelFormatName(benchmarks[i].src_format) + 16,
+                     SDL_GetPixelFormatName(benchmarks[i].dst_format) + 16,
+                     benchmarks[i].blendmode == SDL_BLENDMODE_BLEND ? " blend" :
+                     benchmarks[i].blendmode == SDL_BLENDMODE_ADD ? " add" :
+                     benchmarks[i].blendmode == SDL_BLENDMODE_MOD ? " mod" : "",
+                     benchmarks[i].modulate ? " modulate" : "",
+                     benchmarks[i].colorkey ? " key" : "",
+                     benchmarks[i].scaled ? " scaled" : "");
+        printf("%-44s", name);
+        dstrect.x = 0;
+        dstrect.y = 0;
+        dstrect.w = w;
+        dstrect.h = h;
+
+        for (tier = 0; tier < SDL_arraysize(tiers); ++tier) {
+            SDL_Surface *tsrc;
+            Uint64 start, elapsed;
+
+            if (!HaveTier(tier)) {
+                continue;
+            }
+            SetTier(tier);
+            tsrc = CopySurface(src);
+            SetupBlit(tsrc, benchmarks[i].blendmode, benchmarks[i].modulate,
+                      benchmarks[i].modulate, benchmarks[i].colorkey, key);
+
+            /* The first blit picks the blitter */
+            Blit(tsrc, dst, &dstrect, benchmarks[i].scaled);
+            start = SDL_GetPerformanceCounter();
+            for (n = 0; n < iterations; ++n) {
+                Blit(tsrc, dst, &dstrect, benchmarks[i].scaled);
+            }
+            elapsed = SDL_GetPerformanceCounter() - start;
+            printf("  %s %7.1f Mpix/s", tiers[tier].name,
+                   (double) w * h * iterations / 1e6 /
+                   ((double) elapsed / SDL_GetPerformanceFrequency()));
+            SDL_FreeSurface(tsrc);
+        }
+        printf("\n");
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int w = 1024, h = 768, iterations = 20;
+    int failures;
+
+    if (argc > 3) {
+        w = atoi(argv[1]);
+        h = atoi(argv[2]);
+        iterations = atoi(argv[3]);
+    }
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    failures = CheckTiers();
+    if (w > 0 && h > 0 && iterations > 0) {
+        Benchmark(w, h, iterations);
+    }
+
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,138 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for blits split across threads.
+
+   Blits a large surface with a few common format and blend mode
+   combinations, on one thread and then on more and more threads with
+   SDL_HINT_BLIT_THREADS, and checks that every thread count gives the same
+   pixels as one thread.
+
+   Usage: testblitthreads [width height iterations]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "testsurface.h"
+
+static const struct
+{
+    const char *name;
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_BlendMode blendmode;
+    SDL_bool modulate;
+} blits[] = {
+    { "ARGB8888 -> RGB888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_NONE, SDL_FALSE },
+    { "ARGB8888 -> RGB888 blend", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_FALSE },
+    { "ARGB8888 -> RGB888 blend modulate", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_TRUE },
+    { "RGBA8888 -> ARGB8888 blend", SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, SDL_FALSE },
+    { "RGB565 -> RGB888", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_NONE, SDL_FALSE },
+};
+
+/* Blit 'iterations' times with the given number of threads, returns the
+   pixels per second and leaves the result of the last blit in 'dst' */
+static double
+Blit(SDL_Surface * src, SDL_Surface * dst, const SDL_Surface * original,
+     int threads, int iterations)
+{
+    Uint64 start, elapsed;
+    char hint[16];
+    int i;
+
+    SDL_snprintf(hint, sizeof (hint), "%d", threads);
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, hint);
+
+    /* The first blit starts the worker threads */
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    /* One more from the original destination pixels for the comparison */
+    SDL_memcpy(dst->pixels, original->pixels, dst->h * dst->pitch);
+    SDL_BlitSurface(src, NULL, dst, NULL);
+
+    return (double) src->w * src->h * iterations /
+        ((double) elapsed / SDL_GetPerformanceFrequency());
+}
+
+int
+main(int argc, char *argv[])
+{
+    int w = 3840, h = 2160, iterations = 10;
+    int max_threads, failures = 0;
+    int i, threads;
+
+    if (argc > 3) {
+        w = atoi(argv[1]);
+        h = atoi(argv[2]);
+        iterations = atoi(argv[3]);
+    }
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    /* At least two, so the split is tested on any machine */
+    max_threads = SDL_max(SDL_GetCPUCount(), 2);
+    printf("Blitting %dx%d, %d times, %d CPUs\n", w, h, iterations,
+           SDL_GetCPUCount());
+
+    for (i = 0; i < SDL_arraysize(blits); ++i) {
+        SDL_Surface *src = CreateRandomSurface(blits[i].src_format, w, h);
+        SDL_Surface *original = CreateRandomSurface(blits[i].dst_format, w, h);
+        SDL_Surface *reference =
+            CreateRandomSurface(blits[i].dst_format, w, h);
+        SDL_Surface *dst = CreateRandomSurface(blits[i].dst_format, w, h);
+        double single = 0.0;
+
+        SDL_SetSurfaceBlendMode(src, blits[i].blendmode);
+        if (blits[i].modulate) {
+            SDL_SetSurfaceColorMod(src, 200, 100, 37);
+            SDL_SetSurfaceAlphaMod(src, 150);
+        }
+
+        printf("%-36s", blits[i].name);
+        for (threads = 1; threads <= max_threads; threads *= 2) {
+            SDL_Surface *target = (threads == 1) ? reference : dst;
+            const double rate = Blit(src, target, original, threads,
+                                     iterations);
+
+            if (threads == 1) {
+                single = rate;
+            } else if (SDL_memcmp(reference->pixels, dst->pixels,
+                                  dst->h * dst->pitch) != 0) {
+                printf("\n  %d threads don't match one thread!\n", threads);
+                ++failures;
+            }
+            printf("  %d: %7.1f Mpix/s x%.2f", threads, rate / 1e6,
+                   rate / single);
+        }
+        printf("\n");
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(original);
+        SDL_FreeSurface(reference);
+        SDL_FreeSurface(dst);
+    }
+
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
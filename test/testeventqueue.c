@@ -0,0 +1,152 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program to measure event queue throughput with several threads
+   pushing events while the main thread polls them.  With a batch size
+   greater than 1 the writers use SDL_PushEvents().
+
+   Run with SDL_VIDEODRIVER=dummy to benchmark without a display.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_WRITERS     4
+#define MAX_WRITERS         64
+#define EVENTS_PER_WRITER   250000
+#define MAX_BATCH           256
+
+typedef struct
+{
+    int index;
+    int waits;
+} WriterData;
+
+static SDL_atomic_t writersRunning;
+static int batch_size = 1;
+
+static int
+EventWriter(void *_data)
+{
+    WriterData *data = (WriterData *) _data;
+    SDL_Event events[MAX_BATCH];
+    int i, j, count, added;
+
+    for (i = 0; i < EVENTS_PER_WRITER; i += count) {
+        count = SDL_min(batch_size, EVENTS_PER_WRITER - i);
+        for (j = 0; j < count; ++j) {
+            SDL_zero(events[j]);
+            events[j].type = SDL_USEREVENT;
+            events[j].user.code = data->index;
+            events[j].user.data1 = (void *) (uintptr_t) (i + j);
+        }
+        for (j = 0; j < count; j += added) {
+            added = SDL_PushEvents(&events[j], count - j);
+            if (added <= 0) {
+                /* The queue is full, let the reader catch up */
+                ++data->waits;
+                added = 0;
+                SDL_Delay(0);
+            }
+        }
+    }
+    SDL_AtomicAdd(&writersRunning, -1);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    WriterData writerData[MAX_WRITERS];
+    SDL_Thread *threads[MAX_WRITERS];
+    int next[MAX_WRITERS];
+    int num_writers = DEFAULT_WRITERS;
+    int total, expected, errors, polls;
+    Uint32 start, end;
+    SDL_Event event;
+    int i;
+
+    if (argv[1]) {
+        num_writers = atoi(argv[1]);
+    }
+    if (argv[1] && argv[2]) {
+        batch_size = atoi(argv[2]);
+    }
+    if (num_writers < 1 || num_writers > MAX_WRITERS ||
+        batch_size < 1 || batch_size > MAX_BATCH) {
+        fprintf(stderr, "Usage: %s [writers (1-%d)] [batch size (1-%d)]\n",
+                argv[0], MAX_WRITERS, MAX_BATCH);
+        return (1);
+    }
+
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    printf("Starting %d writers, %d events each in batches of %d\n",
+           num_writers, EVENTS_PER_WRITER, batch_size);
+
+    start = SDL_GetTicks();
+
+    SDL_zero(writerData);
+    SDL_zero(next);
+    SDL_AtomicSet(&writersRunning, num_writers);
+    for (i = 0; i < num_writers; ++i) {
+        char name[64];
+        SDL_snprintf(name, sizeof (name), "EventWriter%d", i);
+        writerData[i].index = i;
+        threads[i] = SDL_CreateThread(EventWriter, name, &writerData[i]);
+    }
+
+    /* Read until every writer is done and the queue is empty */
+    expected = num_writers * EVENTS_PER_WRITER;
+    total = 0;
+    errors = 0;
+    polls = 0;
+    while (total < expected) {
+        ++polls;
+        while (SDL_PollEvent(&event)) {
+            int index;
+
+            if (event.type != SDL_USEREVENT) {
+                continue;
+            }
+            index = event.user.code;
+            if ((int) (uintptr_t) event.user.data1 != next[index]) {
+                ++errors;
+            }
+            next[index] = (int) (uintptr_t) event.user.data1 + 1;
+            ++total;
+        }
+        if (SDL_AtomicGet(&writersRunning) == 0 && !SDL_HasEvents(SDL_USEREVENT, SDL_USEREVENT)) {
+            break;
+        }
+    }
+
+    end = SDL_GetTicks();
+
+    for (i = 0; i < num_writers; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+        printf("Writer %d wrote %d events, had %d waits\n", i, EVENTS_PER_WRITER, writerData[i].waits);
+    }
+    printf("Read %d of %d events in %d polling passes, %d out of order\n", total, expected, polls, errors);
+    printf("Finished in %f sec, %.0f events/sec\n", (end - start) / 1000.f,
+           (end > start) ? (total * 1000.0 / (end - start)) : 0.0);
+
+    SDL_Quit();
+    return (total == expected && errors == 0) ? 0 : 1;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,199 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for SDL_MixAudioFormat() mixing many voices into one buffer.
+
+   Each native S16 and F32 case is also run through a copy of the plain
+   C mixing loop, and SDL's output is checked against it sample by sample.
+
+   Usage: testmixaudio [voices]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define DEFAULT_VOICES  32
+#define MAX_VOICES      256
+#define SAMPLES         (4096 * 2)
+#define ITERATIONS      100
+
+static int num_voices = DEFAULT_VOICES;
+
+/* The scalar mixing loops from SDL_mixer.c */
+static void
+ReferenceMix(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+             Uint32 len, int volume)
+{
+    if (format == AUDIO_S16SYS) {
+        const Sint16 *src16 = (const Sint16 *) src;
+        Sint16 *dst16 = (Sint16 *) dst;
+        Sint16 src1;
+        int dst_sample;
+
+        len /= 2;
+        while (len--) {
+            src1 = *src16++;
+            src1 = (src1 * volume) / SDL_MIX_MAXVOLUME;
+            dst_sample = src1 + *dst16;
+            if (dst_sample > 32767) {
+                dst_sample = 32767;
+            } else if (dst_sample < -32768) {
+                dst_sample = -32768;
+            }
+            *dst16++ = (Sint16) dst_sample;
+        }
+    } else {
+        const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+        const float fvolume = (float) volume;
+        const float *src32 = (const float *) src;
+        float *dst32 = (float *) dst;
+        float src1;
+        double dst_sample;
+
+        len /= 4;
+        while (len--) {
+            src1 = ((*src32++ * fvolume) * fmaxvolume);
+            dst_sample = ((double) src1) + ((double) *dst32);
+            if (dst_sample > 3.402823466e+38F) {
+                dst_sample = 3.402823466e+38F;
+            } else if (dst_sample < -3.402823466e+38F) {
+                dst_sample = -3.402823466e+38F;
+            }
+            *dst32++ = (float) dst_sample;
+        }
+    }
+}
+
+static double
+SamplesPerSecond(Uint64 elapsed)
+{
+    if (elapsed == 0) {
+        return 0.0;
+    }
+    return ((double) SAMPLES * num_voices * ITERATIONS *
+            SDL_GetPerformanceFrequency()) / elapsed;
+}
+
+static int
+RunMix(SDL_AudioFormat format, const char *name, int volume, Uint8 ** voices)
+{
+    const int size = (SDL_AUDIO_BITSIZE(format) / 8);
+    const Uint32 len = SAMPLES * size;
+    Uint8 *mixed = (Uint8 *) SDL_malloc(len);
+    Uint8 *reference = (Uint8 *) SDL_malloc(len);
+    Uint64 start, sdl_time = 0, c_time = 0;
+    int i, j, mismatches = 0;
+
+    if (!mixed || !reference) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+
+    for (i = 0; i < ITERATIONS; ++i) {
+        SDL_memset(mixed, 0, len);
+        start = SDL_GetPerformanceCounter();
+        for (j = 0; j < num_voices; ++j) {
+            SDL_MixAudioFormat(mixed, voices[j], format, len, volume);
+        }
+        sdl_time += SDL_GetPerformanceCounter() - start;
+
+        SDL_memset(reference, 0, len);
+        start = SDL_GetPerformanceCounter();
+        for (j = 0; j < num_voices; ++j) {
+            ReferenceMix(reference, voices[j], format, len, volume);
+        }
+        c_time += SDL_GetPerformanceCounter() - start;
+    }
+
+    /* Compare bit patterns, a NaN never equals itself */
+    for (i = 0; i < SAMPLES; ++i) {
+        if (SDL_memcmp(mixed + i * size, reference + i * size, size) != 0) {
+            ++mismatches;
+        }
+    }
+
+    printf("%s volume %3d: SDL %8.1f Msamples/sec, C loop %8.1f Msamples/sec, %d mismatches\n",
+           name, volume, SamplesPerSecond(sdl_time) / 1000000.0,
+           SamplesPerSecond(c_time) / 1000000.0, mismatches);
+
+    SDL_free(mixed);
+    SDL_free(reference);
+    return mismatches;
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const int volumes[] = { SDL_MIX_MAXVOLUME, 100, 37 };
+    Uint8 *voices16[MAX_VOICES];
+    Uint8 *voices32[MAX_VOICES];
+    int failures = 0;
+    int i, j;
+
+    if (argv[1]) {
+        num_voices = atoi(argv[1]);
+    }
+    if (num_voices < 1 || num_voices > MAX_VOICES) {
+        fprintf(stderr, "Usage: %s [voices (1-%d)]\n", argv[0], MAX_VOICES);
+        return (1);
+    }
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    printf("CPU: SSE2 %s, AVX2 %s\n", SDL_HasSSE2() ? "yes" : "no",
+           SDL_HasAVX2() ? "yes" : "no");
+    printf("Mixing %d voices of %d samples, %d passes\n",
+           num_voices, SAMPLES, ITERATIONS);
+
+    /* Loud random voices, so the sums clip often */
+    for (i = 0; i < num_voices; ++i) {
+        Sint16 *s16 = (Sint16 *) SDL_malloc(SAMPLES * sizeof (Sint16));
+        float *f32 = (float *) SDL_malloc(SAMPLES * sizeof (float));
+        if (!s16 || !f32) {
+            fprintf(stderr, "Out of memory\n");
+            return (1);
+        }
+        for (j = 0; j < SAMPLES; ++j) {
+            s16[j] = (Sint16) ((rand() & 0xFFFF) - 32768);
+            f32[j] = s16[j] / 8192.0f;
+        }
+        voices16[i] = (Uint8 *) s16;
+        voices32[i] = (Uint8 *) f32;
+    }
+    /* Make sure huge and invalid float values are handled the same way */
+    ((float *) voices32[0])[1] = 3.0e+38f;
+    ((float *) voices32[0])[2] = -3.0e+38f;
+    ((float *) voices32[0])[3] = (float) SDL_sqrt(-1.0);
+
+    for (i = 0; i < SDL_arraysize(volumes); ++i) {
+        if (RunMix(AUDIO_S16SYS, "S16", volumes[i], voices16) != 0) {
+            ++failures;
+        }
+        if (RunMix(AUDIO_F32SYS, "F32", volumes[i], voices32) != 0) {
+            ++failures;
+        }
+    }
+
+    for (i = 0; i < num_voices; ++i) {
+        SDL_free(voices16[i]);
+        SDL_free(voices32[i]);
+    }
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
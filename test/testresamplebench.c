@@ -0,0 +1,187 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program to compare the audio resamplers selected by the
+   SDL_AUDIO_RESAMPLING_MODE hint, for speed and for quality.
+
+   Throughput is how many seconds of stereo audio get converted per second.
+   Quality is measured with a pure tone: for a tone the output can carry,
+   the level of everything except that tone (noise, distortion and images);
+   for a tone above the output's Nyquist frequency, the level of whatever
+   aliased through.  Lower is better for both, 0 dB is the tone's level.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "SDL.h"
+
+#define CHANNELS    2
+#define SECONDS     1
+#define ITERATIONS  20
+#define MEASURE_EDGE 512    /* frames skipped at each end when measuring */
+
+static const char *modes[] = { "fast", "medium", "best" };
+
+static const struct
+{
+    int src_rate;
+    int dst_rate;
+    double tone;            /* in Hz */
+} cases[] = {
+    { 44100, 48000, 1000.0 },
+    { 44100, 48000, 15000.0 },
+    { 48000, 44100, 15000.0 },
+    { 48000, 22050, 5000.0 },
+    { 48000, 22050, 16000.0 },
+    { 22050, 44100, 8000.0 },
+    { 11025, 48000, 4000.0 },
+};
+
+static double
+ToDecibels(double ratio)
+{
+    if (ratio <= 1e-20) {
+        return -200.0;
+    }
+    return 10.0 * log10(ratio);
+}
+
+/* Returns the level of the left channel in dB, relative to the tone's
+   level, after removing the tone's frequency when it's below Nyquist. */
+static double
+MeasureError(const float *samples, int frames, int rate, double tone)
+{
+    const double w = 2.0 * M_PI * tone / rate;
+    double ss = 0.0, cc = 0.0, sc = 0.0, ys = 0.0, yc = 0.0;
+    double a = 0.0, b = 0.0, det;
+    double residual = 0.0;
+    int i;
+
+    if (frames <= 2 * MEASURE_EDGE) {
+        return 0.0;
+    }
+
+    if (tone < rate / 2) {
+        /* Least squares fit of a*sin + b*cos at the tone's frequency */
+        for (i = MEASURE_EDGE; i < frames - MEASURE_EDGE; ++i) {
+            const double s = sin(w * i), c = cos(w * i);
+            const double y = samples[i * CHANNELS];
+            ss += s * s;
+            cc += c * c;
+            sc += s * c;
+            ys += y * s;
+            yc += y * c;
+        }
+        det = ss * cc - sc * sc;
+        if (det != 0.0) {
+            a = (ys * cc - yc * sc) / det;
+            b = (yc * ss - ys * sc) / det;
+        }
+    }
+
+    for (i = MEASURE_EDGE; i < frames - MEASURE_EDGE; ++i) {
+        const double y = samples[i * CHANNELS];
+        const double e = y - (a * sin(w * i) + b * cos(w * i));
+        residual += e * e;
+    }
+
+    /* The tone has an amplitude of 0.5, so its mean square is 0.125 */
+    return ToDecibels((residual / (frames - 2 * MEASURE_EDGE)) / 0.125);
+}
+
+static int
+RunCase(const char *mode, int src_rate, int dst_rate, double tone)
+{
+    SDL_AudioCVT cvt;
+    const int frames = src_rate * SECONDS;
+    const int len = frames * CHANNELS * sizeof(float);
+    float *src;
+    Uint8 *buf;
+    Uint64 start, elapsed;
+    double error, speed;
+    int i;
+
+    SDL_SetHint(SDL_HINT_AUDIO_RESAMPLING_MODE, mode);
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, CHANNELS, src_rate,
+                          AUDIO_F32SYS, CHANNELS, dst_rate) < 0) {
+        fprintf(stderr, "SDL_BuildAudioCVT() failed: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    src = (float *) SDL_malloc(len);
+    buf = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    if (!src || !buf) {
+        fprintf(stderr, "Out of memory\n");
+        SDL_free(src);
+        SDL_free(buf);
+        return -1;
+    }
+    for (i = 0; i < frames; ++i) {
+        const float sample = (float) (0.5 * sin(2.0 * M_PI * tone * i / src_rate));
+        src[i * CHANNELS + 0] = sample;
+        src[i * CHANNELS + 1] = sample;
+    }
+
+    cvt.buf = buf;
+    cvt.len = len;
+    elapsed = 0;
+    for (i = 0; i < ITERATIONS; ++i) {
+        SDL_memcpy(buf, src, len);
+        start = SDL_GetPerformanceCounter();
+        SDL_ConvertAudio(&cvt);
+        elapsed += SDL_GetPerformanceCounter() - start;
+    }
+    speed = (elapsed > 0) ? ((double) ITERATIONS * SECONDS *
+                             SDL_GetPerformanceFrequency() / elapsed) : 0.0;
+
+    error = MeasureError((const float *) buf,
+                         cvt.len_cvt / (CHANNELS * sizeof(float)),
+                         dst_rate, tone);
+
+    printf("%6d -> %6d  %7.0f Hz  %-6s  %8.1fx realtime  %7.1f dB\n",
+           src_rate, dst_rate, tone, mode, speed, error);
+
+    SDL_free(src);
+    SDL_free(buf);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i, j;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    printf("Resampling %d second(s) of %d channel float audio, %d passes\n",
+           SECONDS, CHANNELS, ITERATIONS);
+    printf("  from ->     to     tone  mode           speed       error\n");
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        for (j = 0; j < SDL_arraysize(modes); ++j) {
+            if (RunCase(modes[j], cases[i].src_rate, cases[i].dst_rate,
+                        cases[i].tone) < 0) {
+                SDL_Quit();
+                return (1);
+            }
+        }
+    }
+
+    SDL_Quit();
+    return (0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,382 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test and benchmark for rotated copies with the software renderer.
+
+   Checks SDL_RenderCopyEx() against SDL_RenderCopy() with no rotation,
+   a half turn against flipping both ways, a quarter turn against the
+   texture turned by hand, and sprites hanging off the target against the
+   same sprites on a bigger one.  Then draws frames of rotated sprites.
+
+   Usage: testspriterotate [sprites frames]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "testsurface.h"
+
+#define SPRITE_SIZE 64
+
+/* Random pixels, copied rather than blended */
+static SDL_Surface *
+CreateSurface(Uint32 format, int w, int h)
+{
+    SDL_Surface *surface = CreateRandomSurface(format, w, h);
+
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+    return surface;
+}
+
+/* A texture in the surface's own format, which SDL_CreateTextureFromSurface()
+   wouldn't keep for 16 bit surfaces */
+static SDL_Texture *
+CreateTexture(SDL_Renderer * renderer, SDL_Surface * surface)
+{
+    SDL_Texture *texture = SDL_CreateTexture(renderer,
+                                             surface->format->format,
+                                             SDL_TEXTUREACCESS_STATIC,
+                                             surface->w, surface->h);
+
+    if (!texture ||
+        SDL_UpdateTexture(texture, NULL, surface->pixels,
+                          surface->pitch) < 0) {
+        fprintf(stderr, "Couldn't create texture: %s\n", SDL_GetError());
+        exit(1);
+    }
+    return texture;
+}
+
+static SDL_Renderer *
+CreateRenderer(SDL_Surface * target, SDL_Surface * pixels,
+               SDL_Texture ** texture)
+{
+    SDL_Renderer *renderer = SDL_CreateSoftwareRenderer(target);
+
+    if (!renderer) {
+        fprintf(stderr, "Couldn't create renderer: %s\n", SDL_GetError());
+        exit(1);
+    }
+    *texture = CreateTexture(renderer, pixels);
+    return renderer;
+}
+
+/* Compare a w by h area of two ARGB8888 surfaces */
+static int
+CompareArea(SDL_Surface * a, int ax, int ay, SDL_Surface * b, int bx, int by,
+            int w, int h)
+{
+    int x, y, errors = 0;
+
+    for (y = 0; y < h; ++y) {
+        const Uint32 *rowa = (const Uint32 *) ((Uint8 *) a->pixels +
+                                               (ay + y) * a->pitch) + ax;
+        const Uint32 *rowb = (const Uint32 *) ((Uint8 *) b->pixels +
+                                               (by + y) * b->pitch) + bx;
+        for (x = 0; x < w; ++x) {
+            if (rowa[x] != rowb[x]) {
+                ++errors;
+            }
+        }
+    }
+    return errors;
+}
+
+/* An ARGB8888 copy of a surface with only the bits another format keeps */
+static SDL_Surface *
+Quantize(SDL_Surface * surface, Uint32 format)
+{
+    SDL_Surface *temp = SDL_ConvertSurfaceFormat(surface, format, 0);
+    SDL_Surface *result;
+
+    if (temp == NULL) {
+        fprintf(stderr, "Couldn't convert surface: %s\n", SDL_GetError());
+        exit(1);
+    }
+    result = SDL_ConvertSurfaceFormat(temp, surface->format->format, 0);
+    if (result == NULL) {
+        fprintf(stderr, "Couldn't convert surface: %s\n", SDL_GetError());
+        exit(1);
+    }
+    SDL_FreeSurface(temp);
+    return result;
+}
+
+/* An ARGB8888 copy of a 16 bit surface, expanded with SDL_GetRGBA() */
+static SDL_Surface *
+Expand(SDL_Surface * surface)
+{
+    SDL_Surface *result = CreateSurface(SDL_PIXELFORMAT_ARGB8888, surface->w,
+                                        surface->h);
+    int x, y;
+
+    for (y = 0; y < surface->h; ++y) {
+        const Uint16 *src = (const Uint16 *) ((Uint8 *) surface->pixels +
+                                              y * surface->pitch);
+        Uint32 *dst = (Uint32 *) ((Uint8 *) result->pixels +
+                                  y * result->pitch);
+        for (x = 0; x < surface->w; ++x) {
+            Uint8 r, g, b, a;
+
+            SDL_GetRGBA(src[x], surface->format, &r, &g, &b, &a);
+            dst[x] = SDL_MapRGBA(result->format, r, g, b, a);
+        }
+    }
+    return result;
+}
+
+static int
+Check(const char *what, int errors)
+{
+    if (errors) {
+        printf("%s: %d pixels differ\n", what, errors);
+        return 1;
+    }
+    return 0;
+}
+
+static int
+TestRotate(Uint32 texture_format, SDL_BlendMode blendMode,
+           const char *quality)
+{
+    const Uint32 format = SDL_PIXELFORMAT_ARGB8888;
+    SDL_Surface *pixels = CreateSurface(texture_format, SPRITE_SIZE,
+                                        SPRITE_SIZE);
+    const char *name = SDL_GetPixelFormatName(texture_format);
+    SDL_Surface *background = CreateSurface(format, 240, 220);
+    SDL_Surface *a = CreateSurface(format, 200, 200);
+    SDL_Surface *b = CreateSurface(format, 240, 220);
+    SDL_Renderer *ra, *rb;
+    SDL_Texture *ta, *tb;
+    SDL_Rect rect = { 40, 50, SPRITE_SIZE, SPRITE_SIZE };
+    SDL_Rect bigrect = { 0, 0, 150, 90 };
+    char what[128];
+    int x, y, errors, failures = 0;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, quality);
+    ra = CreateRenderer(a, pixels, &ta);
+    rb = CreateRenderer(b, pixels, &tb);
+    SDL_SetTextureBlendMode(ta, blendMode);
+    SDL_SetTextureBlendMode(tb, blendMode);
+    SDL_SetTextureColorMod(tb, 250, 200, 100);
+    SDL_SetTextureColorMod(ta, 250, 200, 100);
+
+#define RESET(surface) \
+    SDL_BlitSurface(background, NULL, surface, NULL)
+
+    /* No rotation is a plain copy */
+    RESET(a);
+    RESET(b);
+    SDL_RenderCopyEx(ra, ta, NULL, &rect, 0.0, NULL, SDL_FLIP_NONE);
+    SDL_RenderCopy(rb, tb, NULL, &rect);
+    SDL_snprintf(what, sizeof(what), "%s %s %d: no rotation", name, quality,
+                 blendMode);
+    failures += Check(what, CompareArea(a, 0, 0, b, 0, 0, 200, 200));
+
+    /* A half turn is flipping both ways */
+    RESET(a);
+    RESET(b);
+    SDL_RenderCopyEx(ra, ta, NULL, &rect, 180.0, NULL, SDL_FLIP_NONE);
+    SDL_RenderCopyEx(rb, tb, NULL, &rect, 0.0, NULL,
+                     SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
+    SDL_snprintf(what, sizeof(what), "%s %s %d: half turn", name, quality,
+                 blendMode);
+    failures += Check(what, CompareArea(a, 0, 0, b, 0, 0, 200, 200));
+
+    /* A quarter turn clockwise, against turning the texture by hand */
+    if (texture_format == format && blendMode == SDL_BLENDMODE_NONE) {
+        SDL_SetTextureColorMod(ta, 255, 255, 255);
+        RESET(a);
+        SDL_RenderCopyEx(ra, ta, NULL, &rect, 90.0, NULL, SDL_FLIP_NONE);
+        errors = 0;
+        for (y = 0; y < SPRITE_SIZE; ++y) {
+            for (x = 0; x < SPRITE_SIZE; ++x) {
+                const Uint32 *src = (const Uint32 *) pixels->pixels;
+                const Uint32 *dst = (const Uint32 *) a->pixels;
+                if (dst[(rect.y + y) * a->w + rect.x + x] !=
+                    src[(SPRITE_SIZE - 1 - x) * SPRITE_SIZE + y]) {
+                    ++errors;
+                }
+            }
+        }
+        SDL_snprintf(what, sizeof(what), "%s %s %d: quarter turn", name,
+                     quality, blendMode);
+        failures += Check(what, errors);
+        SDL_SetTextureColorMod(ta, 250, 200, 100);
+    }
+
+    /* Stretched and hanging off the top left, against a target that's
+       big enough for all of it */
+    {
+        SDL_Rect visible = { 20, 10, 200, 200 };
+
+        SDL_BlitSurface(background, &visible, a, NULL);
+        RESET(b);
+        bigrect.x = -20;
+        bigrect.y = -10;
+        SDL_RenderCopyEx(ra, ta, NULL, &bigrect, 33.0, NULL,
+                         SDL_FLIP_VERTICAL);
+        bigrect.x = 0;
+        bigrect.y = 0;
+        SDL_RenderCopyEx(rb, tb, NULL, &bigrect, 33.0, NULL,
+                         SDL_FLIP_VERTICAL);
+        SDL_snprintf(what, sizeof(what), "%s %s %d: clipped", name,
+                     quality, blendMode);
+        failures += Check(what, CompareArea(a, 0, 0, b, 20, 10, 200, 200));
+    }
+
+    /* 16 bit textures are filtered as if they were ARGB8888, and lose the
+       bits they don't have afterwards */
+    if (texture_format != format && blendMode == SDL_BLENDMODE_NONE) {
+        SDL_Surface *argb = Expand(pixels);
+        SDL_Texture *targb = CreateTexture(rb, argb);
+        SDL_Surface *qa, *qb;
+
+        SDL_SetTextureBlendMode(targb, SDL_BLENDMODE_NONE);
+        SDL_SetTextureColorMod(ta, 255, 255, 255);
+        RESET(a);
+        RESET(b);
+        SDL_RenderCopyEx(ra, ta, NULL, &bigrect, 33.0, NULL, SDL_FLIP_NONE);
+        SDL_RenderCopyEx(rb, targb, NULL, &bigrect, 33.0, NULL,
+                         SDL_FLIP_NONE);
+        qa = Quantize(a, texture_format);
+        qb = Quantize(b, texture_format);
+        SDL_snprintf(what, sizeof(what), "%s %s %d: against ARGB8888", name,
+                     quality, blendMode);
+        failures += Check(what, CompareArea(qa, 0, 0, qb, 0, 0, 200, 200));
+        SDL_FreeSurface(qa);
+        SDL_FreeSurface(qb);
+        SDL_DestroyTexture(targb);
+        SDL_FreeSurface(argb);
+    }
+
+#undef RESET
+
+    SDL_DestroyRenderer(ra);
+    SDL_DestroyRenderer(rb);
+    SDL_FreeSurface(pixels);
+    SDL_FreeSurface(background);
+    SDL_FreeSurface(a);
+    SDL_FreeSurface(b);
+    return failures;
+}
+
+/* Returns sprites drawn per second.  With a second texture format, sprites
+   alternate between a texture of each format. */
+static double
+Benchmark(Uint32 target_format, Uint32 format1, Uint32 format2,
+          SDL_BlendMode blendMode, const char *quality, int sprites,
+          int frames)
+{
+    SDL_Surface *target = CreateSurface(target_format, 1024, 768);
+    SDL_Surface *pixels[2];
+    SDL_Renderer *renderer;
+    SDL_Texture *textures[2];
+    Uint64 start, elapsed;
+    int count = format2 ? 2 : 1;
+    int frame, i;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, quality);
+    renderer = SDL_CreateSoftwareRenderer(target);
+    if (!renderer) {
+        fprintf(stderr, "Couldn't create renderer: %s\n", SDL_GetError());
+        exit(1);
+    }
+    for (i = 0; i < count; ++i) {
+        pixels[i] = CreateSurface(i ? format2 : format1, SPRITE_SIZE,
+                                  SPRITE_SIZE);
+        textures[i] = CreateTexture(renderer, pixels[i]);
+        SDL_SetTextureBlendMode(textures[i], blendMode);
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (frame = 0; frame < frames; ++frame) {
+        SeedRandom(1);
+        for (i = 0; i < sprites; ++i) {
+            SDL_Rect rect;
+
+            rect.x = (int) (Random() % (1024 + SPRITE_SIZE)) - SPRITE_SIZE;
+            rect.y = (int) (Random() % (768 + SPRITE_SIZE)) - SPRITE_SIZE;
+            rect.w = SPRITE_SIZE;
+            rect.h = SPRITE_SIZE;
+            SDL_RenderCopyEx(renderer, textures[i % count], NULL, &rect,
+                             (double) (Random() % 3600) / 10.0, NULL,
+                             (SDL_RendererFlip) (Random() % 4));
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+    for (i = 0; i < count; ++i) {
+        SDL_FreeSurface(pixels[i]);
+    }
+    return (double) sprites * frames /
+        ((double) elapsed / SDL_GetPerformanceFrequency());
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const struct
+    {
+        const char *name;
+        Uint32 target_format;
+        Uint32 format1, format2;
+        SDL_BlendMode blendMode;
+        const char *quality;
+    } benchmarks[] = {
+        { "ARGB8888 copy", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, 0, SDL_BLENDMODE_NONE, "nearest" },
+        { "ARGB8888 blend", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, 0, SDL_BLENDMODE_BLEND, "nearest" },
+        { "ARGB8888 blend linear", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, 0, SDL_BLENDMODE_BLEND, "linear" },
+        { "RGB565 blend", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888, 0, SDL_BLENDMODE_BLEND, "nearest" },
+        { "Mixed blend linear", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, "linear" },
+    };
+    int sprites = 10000, frames = 5;
+    int failures = 0;
+    int i;
+
+    if (argc > 2) {
+        sprites = atoi(argv[1]);
+        frames = atoi(argv[2]);
+    }
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    failures += TestRotate(SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, "nearest");
+    failures += TestRotate(SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, "nearest");
+    failures += TestRotate(SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, "linear");
+    failures += TestRotate(SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, "linear");
+    failures += TestRotate(SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, "linear");
+    printf("%s\n", failures ? "Rotation tests FAILED" : "Rotation tests passed");
+
+    printf("Drawing %d %dx%d sprites, %d frames\n", sprites, SPRITE_SIZE,
+           SPRITE_SIZE, frames);
+    for (i = 0; i < SDL_arraysize(benchmarks); ++i) {
+        const double rate = Benchmark(benchmarks[i].target_format,
+                                      benchmarks[i].format1,
+                                      benchmarks[i].format2,
+                                      benchmarks[i].blendMode,
+                                      benchmarks[i].quality, sprites, frames);
+        printf("%-24s %9.0f sprites/s %7.2f ms/frame\n", benchmarks[i].name,
+               rate, sprites * 1000.0 / rate);
+    }
+
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,368 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test and benchmark for the nearest and bilinear stretch blits.
+
+   Checks that SDL_SoftStretch() still picks the same pixels as the
+   original 16.16 stepping, that SDL_SoftStretchLinear() is close to an
+   exact bilinear filter and gives the same pixels with and without SSE2,
+   and that the software renderer's filtered copies blend correctly.  Then
+   times a few common stretches.
+
+   Usage: teststretch [iterations]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "testsurface.h"
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_RGB555,
+    SDL_PIXELFORMAT_ARGB4444,
+    SDL_PIXELFORMAT_ARGB1555,
+};
+
+static const struct
+{
+    int src_w, src_h;
+    int dst_w, dst_h;
+} sizes[] = {
+    { 64, 64, 64, 64 },
+    { 37, 23, 100, 61 },
+    { 100, 61, 37, 23 },
+    { 1, 1, 17, 9 },
+    { 320, 200, 1000, 3 },
+    { 256, 256, 512, 512 },
+};
+
+/* Let the stretches use SSE2, or only C */
+static void
+SetSIMD(SDL_bool simd)
+{
+    SDL_SetHint(SDL_HINT_BLIT_CPU_FEATURES,
+                (simd && SDL_HasSSE2()) ? "8" : "0");
+}
+
+static Uint32
+GetPixel(SDL_Surface * surface, int x, int y)
+{
+    const Uint8 *row = (const Uint8 *) surface->pixels + y * surface->pitch;
+
+    switch (surface->format->BytesPerPixel) {
+    case 2:
+        return ((const Uint16 *) row)[x];
+    case 4:
+        return ((const Uint32 *) row)[x];
+    default:
+        return 0;
+    }
+}
+
+/* Compare the bits of each pixel that belong to a channel */
+static int
+ComparePixels(SDL_Surface * a, SDL_Surface * b)
+{
+    const SDL_PixelFormat *fmt = a->format;
+    const Uint32 mask = fmt->Rmask | fmt->Gmask | fmt->Bmask | fmt->Amask;
+    int x, y;
+
+    for (y = 0; y < a->h; ++y) {
+        for (x = 0; x < a->w; ++x) {
+            if ((GetPixel(a, x, y) & mask) != (GetPixel(b, x, y) & mask)) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+CompareRows(SDL_Surface * a, SDL_Surface * b)
+{
+    const int bytes = a->w * a->format->BytesPerPixel;
+    int y;
+
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *) a->pixels + y * a->pitch,
+                       (Uint8 *) b->pixels + y * b->pitch, bytes) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* SDL_SoftStretch() has always picked source pixels like this */
+static int
+CheckNearest(Uint32 format, int src_w, int src_h, int dst_w, int dst_h)
+{
+    SDL_Surface *src = CreateRandomSurface(format, src_w, src_h);
+    SDL_Surface *dst = CreateRandomSurface(format, dst_w, dst_h);
+    const int incx = (src_w << 16) / dst_w;
+    const int incy = (src_h << 16) / dst_h;
+    int x, y, errors = 0;
+
+    SDL_SoftStretch(src, NULL, dst, NULL);
+    for (y = 0; y < dst_h; ++y) {
+        for (x = 0; x < dst_w; ++x) {
+            const int sx = (int) (((Sint64) x * incx) >> 16);
+            const int sy = (int) (((Sint64) y * incy) >> 16);
+            if (GetPixel(dst, x, y) != GetPixel(src, sx, sy)) {
+                ++errors;
+            }
+        }
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return errors;
+}
+
+static double
+SourceCoordinate(int i, int src_w, int dst_w, int *x0, int *x1)
+{
+    double pos = (i + 0.5) * src_w / dst_w - 0.5;
+
+    if (pos < 0.0) {
+        pos = 0.0;
+    }
+    *x0 = (int) pos;
+    if (*x0 >= src_w - 1) {
+        *x0 = *x1 = src_w - 1;
+        return 0.0;
+    }
+    *x1 = *x0 + 1;
+    return pos - *x0;
+}
+
+/* Compare a 32-bit stretch with an exact bilinear filter, returns the
+   largest difference in any channel */
+static int
+CheckLinear(SDL_Surface * src, SDL_Surface * dst)
+{
+    int x, y, c, diff = 0;
+
+    for (y = 0; y < dst->h; ++y) {
+        int y0, y1;
+        const double fy = SourceCoordinate(y, src->h, dst->h, &y0, &y1);
+
+        for (x = 0; x < dst->w; ++x) {
+            int x0, x1;
+            const double fx = SourceCoordinate(x, src->w, dst->w, &x0, &x1);
+            const Uint32 p = GetPixel(dst, x, y);
+
+            for (c = 0; c < 32; c += 8) {
+                const double top =
+                    ((GetPixel(src, x0, y0) >> c) & 0xFF) * (1.0 - fx) +
+                    ((GetPixel(src, x1, y0) >> c) & 0xFF) * fx;
+                const double bottom =
+                    ((GetPixel(src, x0, y1) >> c) & 0xFF) * (1.0 - fx) +
+                    ((GetPixel(src, x1, y1) >> c) & 0xFF) * fx;
+                const int exact = (int) (top * (1.0 - fy) + bottom * fy + 0.5);
+                diff = SDL_max(diff, SDL_abs(exact - (int) ((p >> c) & 0xFF)));
+            }
+        }
+    }
+    return diff;
+}
+
+static int
+TestStretch(void)
+{
+    int failures = 0;
+    int i, j;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        const char *name = SDL_GetPixelFormatName(formats[i]);
+
+        for (j = 0; j < SDL_arraysize(sizes); ++j) {
+            const int src_w = sizes[j].src_w, src_h = sizes[j].src_h;
+            const int dst_w = sizes[j].dst_w, dst_h = sizes[j].dst_h;
+            SDL_Surface *src = CreateRandomSurface(formats[i], src_w, src_h);
+            SDL_Surface *c = CreateRandomSurface(formats[i], dst_w, dst_h);
+            SDL_Surface *simd = CreateRandomSurface(formats[i], dst_w, dst_h);
+            int errors;
+
+            errors = CheckNearest(formats[i], src_w, src_h, dst_w, dst_h);
+            if (errors) {
+                printf("%s %dx%d -> %dx%d: %d nearest pixels are wrong\n",
+                       name, src_w, src_h, dst_w, dst_h, errors);
+                ++failures;
+            }
+
+            SetSIMD(SDL_FALSE);
+            SDL_SoftStretchLinear(src, NULL, c, NULL);
+            SetSIMD(SDL_TRUE);
+            SDL_SoftStretchLinear(src, NULL, simd, NULL);
+            if (CompareRows(c, simd) != 0) {
+                printf("%s %dx%d -> %dx%d: linear C and SIMD don't match\n",
+                       name, src_w, src_h, dst_w, dst_h);
+                ++failures;
+            }
+            if (src_w == dst_w && src_h == dst_h &&
+                ComparePixels(src, c) != 0) {
+                printf("%s %dx%d: linear stretch to the same size isn't a copy\n",
+                       name, src_w, src_h);
+                ++failures;
+            }
+            if (SDL_BYTESPERPIXEL(formats[i]) == 4) {
+                const int diff = CheckLinear(src, c);
+                if (diff > 2) {
+                    printf("%s %dx%d -> %dx%d: linear is off by %d\n",
+                           name, src_w, src_h, dst_w, dst_h, diff);
+                    ++failures;
+                }
+            }
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(c);
+            SDL_FreeSurface(simd);
+        }
+    }
+    return failures;
+}
+
+/* The software renderer's filtered copies, with and without blending,
+   against stretching the texture by hand */
+static int
+TestRenderer(void)
+{
+    const SDL_Rect dstrect = { 25, 20, 150, 120 };
+    SDL_Rect whole = { 0, 0, 150, 120 };
+    SDL_Surface *texture_pixels =
+        CreateRandomSurface(SDL_PIXELFORMAT_ARGB8888, 50, 40);
+    SDL_Surface *target =
+        CreateRandomSurface(SDL_PIXELFORMAT_ARGB8888, 200, 200);
+    SDL_Surface *scaled =
+        CreateRandomSurface(SDL_PIXELFORMAT_ARGB8888, 150, 120);
+    SDL_Surface *expected =
+        CreateRandomSurface(SDL_PIXELFORMAT_ARGB8888, 200, 200);
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    int blend, failures = 0;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+    renderer = SDL_CreateSoftwareRenderer(target);
+    texture = SDL_CreateTextureFromSurface(renderer, texture_pixels);
+    if (!renderer || !texture) {
+        printf("Couldn't create renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+    SDL_SoftStretchLinear(texture_pixels, NULL, scaled, &whole);
+
+    for (blend = 0; blend < 2; ++blend) {
+        SDL_Rect rect = dstrect;
+
+        SDL_memcpy(expected->pixels, target->pixels,
+                   target->h * target->pitch);
+        SDL_SetSurfaceBlendMode(scaled, blend ? SDL_BLENDMODE_BLEND :
+                                SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(scaled, NULL, expected, &rect);
+
+        SDL_SetTextureBlendMode(texture, blend ? SDL_BLENDMODE_BLEND :
+                                SDL_BLENDMODE_NONE);
+        SDL_RenderCopy(renderer, texture, NULL, &dstrect);
+        if (CompareRows(target, expected) != 0) {
+            printf("Filtered RenderCopy() %s doesn't match\n",
+                   blend ? "with blending" : "without blending");
+            ++failures;
+        }
+    }
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    SDL_FreeSurface(texture_pixels);
+    SDL_FreeSurface(target);
+    SDL_FreeSurface(scaled);
+    SDL_FreeSurface(expected);
+    return failures;
+}
+
+/* Returns millions of destination pixels per second */
+static double
+Benchmark(Uint32 format, int src_w, int src_h, int dst_w, int dst_h,
+          SDL_bool linear, SDL_bool simd, int iterations)
+{
+    SDL_Surface *src = CreateRandomSurface(format, src_w, src_h);
+    SDL_Surface *dst = CreateRandomSurface(format, dst_w, dst_h);
+    Uint64 start, elapsed;
+    int i;
+
+    SetSIMD(simd);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (linear) {
+            SDL_SoftStretchLinear(src, NULL, dst, NULL);
+        } else {
+            SDL_SoftStretch(src, NULL, dst, NULL);
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return (double) dst_w * dst_h * iterations / 1e6 /
+        ((double) elapsed / SDL_GetPerformanceFrequency());
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const struct
+    {
+        Uint32 format;
+        int src_w, src_h;
+        int dst_w, dst_h;
+    } benchmarks[] = {
+        { SDL_PIXELFORMAT_ARGB8888, 640, 360, 1920, 1080 },
+        { SDL_PIXELFORMAT_ARGB8888, 1920, 1080, 1280, 720 },
+        { SDL_PIXELFORMAT_RGB565, 640, 360, 1920, 1080 },
+    };
+    int iterations = (argc > 1) ? atoi(argv[1]) : 10;
+    int failures = 0;
+    int i;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    failures += TestStretch();
+    failures += TestRenderer();
+    printf("%s\n", failures ? "Stretch tests FAILED" : "Stretch tests passed");
+
+    for (i = 0; i < SDL_arraysize(benchmarks); ++i) {
+        const Uint32 format = benchmarks[i].format;
+        const int src_w = benchmarks[i].src_w, src_h = benchmarks[i].src_h;
+        const int dst_w = benchmarks[i].dst_w, dst_h = benchmarks[i].dst_h;
+
+        printf("%-22s %4dx%-4d -> %4dx%-4d  nearest %7.1f  linear C %7.1f"
+               "  linear SIMD %7.1f Mpix/s\n",
+               SDL_GetPixelFormatName(format), src_w, src_h, dst_w, dst_h,
+               Benchmark(format, src_w, src_h, dst_w, dst_h, SDL_FALSE, SDL_FALSE,
+                         iterations),
+               Benchmark(format, src_w, src_h, dst_w, dst_h, SDL_TRUE, SDL_FALSE,
+                         iterations),
+               Benchmark(format, src_w, src_h, dst_w, dst_h, SDL_TRUE, SDL_TRUE,
+                         iterations));
+    }
+
+    SDL_Quit();
+    return (failures ? 1 : 0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
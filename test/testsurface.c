@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Repeatable random numbers and surfaces for the blit and render tests */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "testsurface.h"
+
+static Uint32 random_seed = 1;
+
+void
+SeedRandom(Uint32 seed)
+{
+    random_seed = seed;
+}
+
+Uint32
+Random(void)
+{
+    /* The low bits of the generator repeat quickly, swap them to the top */
+    random_seed = random_seed * 1103515245 + 12345;
+    return (random_seed >> 16) | (random_seed << 16);
+}
+
+SDL_Surface *
+CreateRandomSurface(Uint32 format, int w, int h)
+{
+    SDL_Surface *surface;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+    int bpp, i;
+
+    SDL_PixelFormatEnumToMasks(format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+    surface = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
+    if (surface == NULL) {
+        fprintf(stderr, "Couldn't create surface: %s\n", SDL_GetError());
+        exit(1);
+    }
+    for (i = 0; i < surface->h * surface->pitch; ++i) {
+        ((Uint8 *) surface->pixels)[i] = (Uint8) Random();
+    }
+    return surface;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
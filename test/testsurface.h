@@ -0,0 +1,26 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Repeatable random numbers and surfaces for the blit and render tests */
+
+#include "SDL.h"
+
+/* Start the random numbers over from a given seed, they start at 1 */
+extern void SeedRandom(Uint32 seed);
+
+/* The next 32 bit random number */
+extern Uint32 Random(void);
+
+/* A surface of the given format full of random bytes, exits on failure */
+extern SDL_Surface *CreateRandomSurface(Uint32 format, int w, int h);
+
+/* vi: set ts=4 sw=4 expandtab: */
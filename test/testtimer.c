@@ -14,26 +14,22 @@
    platform
 */
 
-#if 1 /* FIXME: Rework this using the 2.0 API */
-#include <stdio.h>
-
-int main(int argc, char *argv[])
-{
-    printf("FIXME\n");
-    return 0;
-}
-#else
 #include <stdlib.h>
 #include <stdio.h>
 
 #include "SDL.h"
 
 #define DEFAULT_RESOLUTION	1
+#define STRESS_TIMERS       100000
+#define PRECISION_SAMPLES   200
 
 static int ticks = 0;
+static SDL_atomic_t fired;
+static Uint64 samples[PRECISION_SAMPLES];
+static SDL_atomic_t num_samples;
 
 static Uint32 SDLCALL
-ticktock(Uint32 interval)
+ticktock(Uint32 interval, void *param)
 {
     ++ticks;
     return (interval);
@@ -46,6 +42,141 @@ callback(Uint32 interval, void *param)
     return interval;
 }
 
+static Uint32 SDLCALL
+oneshot(Uint32 interval, void *param)
+{
+    SDL_AtomicIncRef(&fired);
+    return 0;
+}
+
+static Uint32 SDLCALL
+sample(Uint32 interval, void *param)
+{
+    int i = SDL_AtomicGet(&num_samples);
+    if (i == PRECISION_SAMPLES) {
+        return 0;
+    }
+    samples[i] = SDL_GetPerformanceCounter();
+    SDL_AtomicIncRef(&num_samples);
+    return interval;
+}
+
+static void
+precision_test(Uint32 interval)
+{
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    double expected = (double) interval / 1000.0;
+    double error, total_error = 0.0, max_error = 0.0;
+    int i;
+
+    printf("Measuring the period of a %d ms timer...\n", interval);
+    SDL_AtomicSet(&num_samples, 0);
+    SDL_AddTimer(interval, sample, NULL);
+    while (SDL_AtomicGet(&num_samples) < PRECISION_SAMPLES) {
+        SDL_Delay(interval);
+    }
+
+    for (i = 1; i < PRECISION_SAMPLES; ++i) {
+        error = (double) (samples[i] - samples[i-1]) / freq - expected;
+        if (error < 0.0) {
+            error = -error;
+        }
+        total_error += error;
+        if (error > max_error) {
+            max_error = error;
+        }
+    }
+    printf("Period error: average %f ms, maximum %f ms, total drift %f ms\n",
+           total_error * 1000.0 / (PRECISION_SAMPLES - 1), max_error * 1000.0,
+           ((double) (samples[PRECISION_SAMPLES-1] - samples[0]) / freq -
+            expected * (PRECISION_SAMPLES - 1)) * 1000.0);
+}
+
+static Uint32 SDLCALL
+slowpoke(Uint32 interval, void *param)
+{
+    SDL_Delay(50);
+    return interval;
+}
+
+static void
+dispatch_test(void)
+{
+    SDL_TimerID slow, fast[10];
+    SDL_TimerStats stats;
+    int i;
+
+    printf("Running a slow timer alongside 10 fast timers for 2 seconds...\n");
+    SDL_GetTimerStats(&stats, SDL_TRUE);
+    slow = SDL_AddTimer(10, slowpoke, NULL);
+    for (i = 0; i < SDL_arraysize(fast); ++i) {
+        fast[i] = SDL_AddTimer(5, ticktock, NULL);
+    }
+    SDL_Delay(2000);
+    SDL_RemoveTimer(slow);
+    for (i = 0; i < SDL_arraysize(fast); ++i) {
+        SDL_RemoveTimer(fast[i]);
+    }
+
+    if (SDL_GetTimerStats(&stats, SDL_TRUE) < 0) {
+        fprintf(stderr, "Couldn't get timer stats: %s\n", SDL_GetError());
+        return;
+    }
+    printf("%d callbacks on %d thread(s), latency: 50%% < %d us, 90%% < %d us, 99%% < %d us, max %d us\n",
+           stats.dispatched, stats.num_threads, stats.latency_p50,
+           stats.latency_p90, stats.latency_p99, stats.latency_max);
+}
+
+static void
+stress_test(void)
+{
+    SDL_TimerID *ids;
+    Uint32 start, now;
+    int i, canceled;
+
+    ids = (SDL_TimerID *) SDL_malloc(STRESS_TIMERS * sizeof(*ids));
+    if (!ids) {
+        fprintf(stderr, "Out of memory\n");
+        return;
+    }
+
+    printf("Creating and canceling %d timers...\n", STRESS_TIMERS);
+    start = SDL_GetTicks();
+    for (i = 0; i < STRESS_TIMERS; ++i) {
+        ids[i] = SDL_AddTimer(10000 + (i % 1000), oneshot, NULL);
+        if (!ids[i]) {
+            fprintf(stderr, "Could not create timer %d: %s\n", i, SDL_GetError());
+            break;
+        }
+    }
+    now = SDL_GetTicks();
+    printf("Created %d timers in %d ms\n", i, now - start);
+
+    start = SDL_GetTicks();
+    canceled = 0;
+    for (i = STRESS_TIMERS; i--; ) {
+        if (ids[i] && SDL_RemoveTimer(ids[i])) {
+            ++canceled;
+        }
+    }
+    now = SDL_GetTicks();
+    printf("Canceled %d timers in %d ms\n", canceled, now - start);
+
+    printf("Running %d one-shot timers...\n", STRESS_TIMERS);
+    SDL_AtomicSet(&fired, 0);
+    start = SDL_GetTicks();
+    for (i = 0; i < STRESS_TIMERS; ++i) {
+        SDL_AddTimer(1 + (i % 100), oneshot, NULL);
+    }
+    while (SDL_AtomicGet(&fired) < STRESS_TIMERS) {
+        SDL_Delay(1);
+    }
+    now = SDL_GetTicks();
+    printf("%d one-shot timers fired in %d ms\n", SDL_AtomicGet(&fired), now - start);
+
+    SDL_free(ids);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -66,14 +197,14 @@ main(int argc, char *argv[])
     if (desired == 0) {
         desired = DEFAULT_RESOLUTION;
     }
-    SDL_SetTimer(desired, ticktock);
+    t1 = SDL_AddTimer(desired, ticktock, NULL);
 
     /* Wait 10 seconds */
     printf("Waiting 10 seconds\n");
     SDL_Delay(10 * 1000);
 
     /* Stop the timer */
-    SDL_SetTimer(0, NULL);
+    SDL_RemoveTimer(t1);
 
     /* Print the results */
     if (ticks) {
@@ -106,9 +237,13 @@ main(int argc, char *argv[])
     SDL_RemoveTimer(t2);
     SDL_RemoveTimer(t3);
 
+    precision_test(5);
+    dispatch_test();
+    stress_test();
+
     start = SDL_GetPerformanceCounter();
     for (i = 0; i < 1000000; ++i) {
-        ticktock(0);
+        ticktock(0, NULL);
     }
     now = SDL_GetPerformanceCounter();
     printf("1 million iterations of ticktock took %f ms\n", (double)((now - start)*1000) / SDL_GetPerformanceFrequency());
@@ -116,6 +251,5 @@ main(int argc, char *argv[])
     SDL_Quit();
     return (0);
 }
-#endif
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,171 @@
+/*
+  Copyright (C) 1997-2012 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for SDL_LoadWAV_RW() decoding, mostly for ADPCM files.
+
+   The file is loaded into memory and its data chunk repeated to make a
+   long track, which is then decoded from memory over and over, first
+   with one thread and then with one per CPU (at least two).  Both have to decode to
+   the same bytes.
+
+   Usage: testwavedecode [file] [repeats] [iterations]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static Uint8 *
+LoadFile(const char *file, Uint32 * len)
+{
+    SDL_RWops *rw = SDL_RWFromFile(file, "rb");
+    Uint8 *buf;
+    long size;
+
+    if (rw == NULL) {
+        return NULL;
+    }
+    size = SDL_RWseek(rw, 0, RW_SEEK_END);
+    SDL_RWseek(rw, 0, RW_SEEK_SET);
+    buf = (Uint8 *) SDL_malloc(size);
+    if (buf && SDL_RWread(rw, buf, size, 1) != 1) {
+        SDL_free(buf);
+        buf = NULL;
+    }
+    SDL_RWclose(rw);
+    *len = (Uint32) size;
+    return buf;
+}
+
+/* Make a WAVE file with the data chunk repeated, everything else as is */
+static Uint8 *
+RepeatData(const Uint8 * wav, Uint32 len, int repeats, Uint32 * newlen)
+{
+    Uint32 pos = 12, chunklen = 0, i;
+    Uint8 *out;
+
+    while (pos + 8 <= len) {
+        chunklen = SDL_SwapLE32(*(Uint32 *) (wav + pos + 4));
+        if (SDL_memcmp(wav + pos, "data", 4) == 0) {
+            break;
+        }
+        pos += 8 + chunklen + (chunklen & 1);
+    }
+    if (pos + 8 + chunklen > len) {
+        return NULL;
+    }
+
+    *newlen = pos + 8 + chunklen * repeats;
+    out = (Uint8 *) SDL_malloc(*newlen);
+    if (out == NULL) {
+        return NULL;
+    }
+    SDL_memcpy(out, wav, pos + 8);
+    for (i = 0; i < (Uint32) repeats; ++i) {
+        SDL_memcpy(out + pos + 8 + i * chunklen, wav + pos + 8, chunklen);
+    }
+    *(Uint32 *) (out + 4) = SDL_SwapLE32(*newlen - 8);
+    *(Uint32 *) (out + pos + 4) = SDL_SwapLE32(chunklen * repeats);
+    return out;
+}
+
+static Uint8 *
+Decode(const Uint8 * wav, Uint32 len, int iterations, Uint32 * audio_len,
+       double *seconds)
+{
+    SDL_AudioSpec spec;
+    Uint8 *audio = NULL;
+    Uint64 start = SDL_GetPerformanceCounter();
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        if (audio) {
+            SDL_FreeWAV(audio);
+        }
+        if (!SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, len), 1, &spec,
+                            &audio, audio_len)) {
+            fprintf(stderr, "Couldn't decode: %s\n", SDL_GetError());
+            return NULL;
+        }
+    }
+    *seconds = (double) (SDL_GetPerformanceCounter() - start) /
+        SDL_GetPerformanceFrequency();
+    return audio;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *file = (argc > 1) ? argv[1] : "sample.wav";
+    int repeats = (argc > 2) ? atoi(argv[2]) : 64;
+    int iterations = (argc > 3) ? atoi(argv[3]) : 10;
+    Uint8 *file_data, *wav, *single, *threaded;
+    Uint32 file_len, len, single_len, threaded_len;
+    double single_sec, threaded_sec;
+    char threads[16];
+    int status = 0;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    file_data = LoadFile(file, &file_len);
+    if (file_data == NULL) {
+        fprintf(stderr, "Couldn't load %s: %s\n", file, SDL_GetError());
+        SDL_Quit();
+        return (1);
+    }
+    wav = RepeatData(file_data, file_len, repeats, &len);
+    if (wav == NULL) {
+        fprintf(stderr, "%s has no data chunk\n", file);
+        SDL_Quit();
+        return (1);
+    }
+
+    SDL_SetHint(SDL_HINT_AUDIO_WAVE_THREADS, "1");
+    single = Decode(wav, len, iterations, &single_len, &single_sec);
+
+    /* Use at least two threads so the split is tested on any machine */
+    SDL_snprintf(threads, sizeof (threads), "%d",
+                 SDL_max(SDL_GetCPUCount(), 2));
+    SDL_SetHint(SDL_HINT_AUDIO_WAVE_THREADS, threads);
+    threaded = Decode(wav, len, iterations, &threaded_len, &threaded_sec);
+
+    if (single == NULL || threaded == NULL) {
+        status = 1;
+    } else {
+        printf("%s x%d: %u bytes encoded, %u bytes decoded\n",
+               file, repeats, len, single_len);
+        printf("1 thread:   %8.2f ms per load, %8.1f MB/s\n",
+               single_sec * 1000.0 / iterations,
+               single_len * (double) iterations / single_sec / 1e6);
+        printf("%s threads: %8.2f ms per load, %8.1f MB/s\n", threads,
+               threaded_sec * 1000.0 / iterations,
+               threaded_len * (double) iterations / threaded_sec / 1e6);
+        if (single_len != threaded_len ||
+            SDL_memcmp(single, threaded, single_len) != 0) {
+            printf("Threaded decoding doesn't match!\n");
+            status = 1;
+        }
+    }
+
+    SDL_FreeWAV(single);
+    SDL_FreeWAV(threaded);
+    SDL_free(wav);
+    SDL_free(file_data);
+    SDL_Quit();
+    return (status);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */